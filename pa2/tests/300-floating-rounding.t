@@ -0,0 +1,12 @@
+0.1 0.2 0.3 1.1 2.2 3.3 0.1f 0.2f 0.3f 1.1f 3.4028234e38f 1e10f 1e-10f
+9007199254740993 9007199254740993.0 9007199254740995 9007199254740994.999999999999999999999
+2.2250738585072011e-308 2.2250738585072012e-308 2.2250738585072014e-308
+4.9406564584124654e-324 2.4703282292062327e-324 2.4703282292062328e-324 1e-324 5e-324
+1.7976931348623157e308 1.7976931348623158e308 1.797693134862315808e308 1e309 1e-400
+1.401298464e-45f 7.006492321624085e-46f 7.006492321624087e-46f 1.17549435e-38f 3.4028236e38f 1e39f 1e-50f
+123456789012345678901234567890. 1234567890123456789012345678901234567890e-20 .000000000000000000000000000000000000001
+8.98846567431158e307 179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368.0
+1.00000005960464477539062500000000000000000000000000000000000000000001f 1.000000059604644775390625f 1.0000000596046447753906249999999999999f
+0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000494065645841246544 
+6.02214076e23 6.62607015e-34 3.141592653589793238462643383279502884197 2.718281828459045235360287f
+1.e5 1e+5 1E-5 1.5e-5f 00012.5000e0 0e999999 0.0e-99999 1e99999999999999999999
@@ -0,0 +1,8 @@
+0 00 007 09 0128 08.5 0128e1 01e5 09e-1 00.5
+0X1 0Xff 0xFfu 0x 0xg 0x_x 09_x 1_x 0x1_x 123456789012345678901234567890_x
+1f 1F 1u 1U 1l 1L 1ll 1LL 1ul 1lu 1uLL 1LLu 1lL 1lul 1uu 1uLl
+2147483647 2147483648 4294967295 4294967296 9223372036854775807 9223372036854775808 9223372036854775808u 18446744073709551615u 18446744073709551616u
+0x7FFFFFFF 0x80000000 0xFFFFFFFF 0x100000000 0x7FFFFFFFFFFFFFFF 0x8000000000000000 0xFFFFFFFFFFFFFFFF 0x10000000000000000
+017777777777 020000000000 037777777777 0777777777777777777777 01000000000000000000000 01777777777777777777777 02000000000000000000000
+2147483648l 2147483648ll 0x80000000l 0x80000000ll 0x8000000000000000l 0x8000000000000000ll 9223372036854775808l 9223372036854775808ll
+0x00000000000000000000000000000001 000000000000000000000000000000001
@@ -0,0 +1 @@
+"a\0b" "c"; u"x" "\U0001F600y" "é"; "\U0001F600" U"ß" "z"; L"a" "bé" L"c"; u8"x" "yé"; "a"_x "b"; "a" "b"_y "c"_y; "long string that spills out of the inline payload" u"and is widened to utf16 é"; R"(raw\n)" "tail"
@@ -50,6 +50,15 @@ for my $test (sort @tests)
 		print "TEST FAIL\n";
 		exit(1);
 	}
+	elsif (-e "$testbase.errors" and `grep "^Parsing error" $mytest.stdout` ne `cat $testbase.errors`)
+	{
+		# the parse errors recog reports must be the ones listed
+		print "ERROR: Parse errors differ from $testbase.errors\n";
+		print "\n";
+		print "To see the differences:\n\n    \$ grep \"^Parsing error\" $mytest.stdout | diff $testbase.errors -\n\n";
+		print "TEST FAIL\n";
+		exit(1);
+	}
 	elsif ($reftest_exit_status_data =~ /EXIT_FAILURE/ or ($reftest_data eq $mytest_data))
 	{
 		$npass++;
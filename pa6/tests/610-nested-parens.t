@@ -0,0 +1 @@
+void f() { x = ((((((((((((a)))))))))))); }
@@ -0,0 +1,120 @@
+int v0 = ((((a)))) b;
+int f1(int a) { return ((((a + 1)))); }
+int f2(int a) { return ((((a + 2)))); }
+int f3(int a) { return ((((a + 3)))); }
+int f4(int a) { return ((((a + 4)))); }
+int f5(int a) { return ((((a + 5)))); }
+int f6(int a) { return ((((a + 6)))); }
+int f7(int a) { return ((((a + 7)))); }
+int f8(int a) { return ((((a + 8)))); }
+int f9(int a) { return ((((a + 9)))); }
+int f10(int a) { return ((((a + 10)))); }
+int f11(int a) { return ((((a + 11)))); }
+int f12(int a) { return ((((a + 12)))); }
+int f13(int a) { return ((((a + 13)))); }
+int f14(int a) { return ((((a + 14)))); }
+int f15(int a) { return ((((a + 15)))); }
+int f16(int a) { return ((((a + 16)))); }
+int f17(int a) { return ((((a + 17)))); }
+int f18(int a) { return ((((a + 18)))); }
+int f19(int a) { return ((((a + 19)))); }
+int f20(int a) { return ((((a + 20)))); }
+int f21(int a) { return ((((a + 21)))); }
+int f22(int a) { return ((((a + 22)))); }
+int f23(int a) { return ((((a + 23)))); }
+int f24(int a) { return ((((a + 24)))); }
+int f25(int a) { return ((((a + 25)))); }
+int f26(int a) { return ((((a + 26)))); }
+int f27(int a) { return ((((a + 27)))); }
+int f28(int a) { return ((((a + 28)))); }
+int f29(int a) { return ((((a + 29)))); }
+int f30(int a) { return ((((a + 30)))); }
+int f31(int a) { return ((((a + 31)))); }
+int f32(int a) { return ((((a + 32)))); }
+int f33(int a) { return ((((a + 33)))); }
+int f34(int a) { return ((((a + 34)))); }
+int f35(int a) { return ((((a + 35)))); }
+int f36(int a) { return ((((a + 36)))); }
+int f37(int a) { return ((((a + 37)))); }
+int f38(int a) { return ((((a + 38)))); }
+int f39(int a) { return ((((a + 39)))); }
+int f40(int a) { return ((((a + 40)))); }
+int f41(int a) { return ((((a + 41)))); }
+int f42(int a) { return ((((a + 42)))); }
+int f43(int a) { return ((((a + 43)))); }
+int f44(int a) { return ((((a + 44)))); }
+int f45(int a) { return ((((a + 45)))); }
+int f46(int a) { return ((((a + 46)))); }
+int f47(int a) { return ((((a + 47)))); }
+int f48(int a) { return ((((a + 48)))); }
+int f49(int a) { return ((((a + 49)))); }
+int f50(int a) { return ((((a + 50)))); }
+int f51(int a) { return ((((a + 51)))); }
+int f52(int a) { return ((((a + 52)))); }
+int f53(int a) { return ((((a + 53)))); }
+int f54(int a) { return ((((a + 54)))); }
+int f55(int a) { return ((((a + 55)))); }
+int f56(int a) { return ((((a + 56)))); }
+int f57(int a) { return ((((a + 57)))); }
+int f58(int a) { return ((((a + 58)))); }
+int f59(int a) { return ((((a + 59)))); }
+int v60 = ((((a)))) b;
+int f61(int a) { return ((((a + 61)))); }
+int f62(int a) { return ((((a + 62)))); }
+int f63(int a) { return ((((a + 63)))); }
+int f64(int a) { return ((((a + 64)))); }
+int f65(int a) { return ((((a + 65)))); }
+int f66(int a) { return ((((a + 66)))); }
+int f67(int a) { return ((((a + 67)))); }
+int f68(int a) { return ((((a + 68)))); }
+int f69(int a) { return ((((a + 69)))); }
+int f70(int a) { return ((((a + 70)))); }
+int f71(int a) { return ((((a + 71)))); }
+int f72(int a) { return ((((a + 72)))); }
+int f73(int a) { return ((((a + 73)))); }
+int f74(int a) { return ((((a + 74)))); }
+int f75(int a) { return ((((a + 75)))); }
+int f76(int a) { return ((((a + 76)))); }
+int f77(int a) { return ((((a + 77)))); }
+int f78(int a) { return ((((a + 78)))); }
+int f79(int a) { return ((((a + 79)))); }
+int f80(int a) { return ((((a + 80)))); }
+int f81(int a) { return ((((a + 81)))); }
+int f82(int a) { return ((((a + 82)))); }
+int f83(int a) { return ((((a + 83)))); }
+int f84(int a) { return ((((a + 84)))); }
+int f85(int a) { return ((((a + 85)))); }
+int f86(int a) { return ((((a + 86)))); }
+int f87(int a) { return ((((a + 87)))); }
+int f88(int a) { return ((((a + 88)))); }
+int f89(int a) { return ((((a + 89)))); }
+int f90(int a) { return ((((a + 90)))); }
+int f91(int a) { return ((((a + 91)))); }
+int f92(int a) { return ((((a + 92)))); }
+int f93(int a) { return ((((a + 93)))); }
+int f94(int a) { return ((((a + 94)))); }
+int f95(int a) { return ((((a + 95)))); }
+int f96(int a) { return ((((a + 96)))); }
+int f97(int a) { return ((((a + 97)))); }
+int f98(int a) { return ((((a + 98)))); }
+int f99(int a) { return ((((a + 99)))); }
+int f100(int a) { return ((((a + 100)))); }
+int f101(int a) { return ((((a + 101)))); }
+int f102(int a) { return ((((a + 102)))); }
+int f103(int a) { return ((((a + 103)))); }
+int f104(int a) { return ((((a + 104)))); }
+int f105(int a) { return ((((a + 105)))); }
+int f106(int a) { return ((((a + 106)))); }
+int f107(int a) { return ((((a + 107)))); }
+int f108(int a) { return ((((a + 108)))); }
+int f109(int a) { return ((((a + 109)))); }
+int f110(int a) { return ((((a + 110)))); }
+int f111(int a) { return ((((a + 111)))); }
+int f112(int a) { return ((((a + 112)))); }
+int f113(int a) { return ((((a + 113)))); }
+int f114(int a) { return ((((a + 114)))); }
+int f115(int a) { return ((((a + 115)))); }
+int f116(int a) { return ((((a + 116)))); }
+int f117(int a) { return ((((a + 117)))); }
+int f118(int a) { return ((((a + 118)))); }
+int v119 = ((((a)))) b;
@@ -816,79 +816,79 @@ class PPCtrlExprEvaluator
 
             if (_idx->ltype == FT_SIGNED_CHAR)
             {
-                char *v = (char*)_idx->data;
+                const char* v = (const char*)_idx->data();
                 term1 = *v;
             }
             else if (_idx->ltype == FT_SHORT_INT)
             {
-                short int* v = (short int*)_idx->data;
+                const short int* v = (const short int*)_idx->data();
                 term1 = *v;
             }
             else if (_idx->ltype == FT_INT)
             {
-                int *v = (int*)_idx->data;
+                const int* v = (const int*)_idx->data();
                 term1 = *v;
             }
             else if (_idx->ltype == FT_LONG_INT)
             {
-                long int* v = (long int*)_idx->data;
+                const long int* v = (const long int*)_idx->data();
                 term1 = *v;
 
             }
             else if (_idx->ltype == FT_LONG_LONG_INT)
             {   
-                long long int* v = (long long int*)_idx->data;
+                const long long int* v = (const long long int*)_idx->data();
                 term1 = *v;
             }
             else if (_idx->ltype == FT_UNSIGNED_CHAR)
             {
-                unsigned char* v = (unsigned char*)_idx->data;
+                const unsigned char* v = (const unsigned char*)_idx->data();
                 term1 = *v;
                 term1.setUnsigned(true);
             }
             else if (_idx->ltype == FT_UNSIGNED_SHORT_INT)
             {
-                unsigned short int* v = (unsigned short int*)_idx->data;
+                const unsigned short int* v = (const unsigned short int*)_idx->data();
                 term1 = *v;
                 term1.setUnsigned(true);
             }
             else if (_idx->ltype == FT_UNSIGNED_INT)
             {
-                unsigned int* v = (unsigned int*)_idx->data;
+                const unsigned int* v = (const unsigned int*)_idx->data();
                 term1 = *v;
                 term1.setUnsigned(true);
             }
             else if (_idx->ltype == FT_UNSIGNED_LONG_INT)
             {
-                unsigned long int* v = (unsigned long int*)_idx->data;
+                const unsigned long int* v = (const unsigned long int*)_idx->data();
                 term1 = *v;
                 term1.setUnsigned(true);
             }
             else if (_idx->ltype == FT_UNSIGNED_LONG_LONG_INT)
             {
-                unsigned long long int* v = (unsigned long long int*)_idx->data;
+                const unsigned long long int* v = (const unsigned long long int*)_idx->data();
                 term1 = *v;
                 term1.setUnsigned(true);
             }
             else if (_idx->ltype == FT_WCHAR_T)
             {
-                wchar_t* v = (wchar_t*)_idx->data;
+                const wchar_t* v = (const wchar_t*)_idx->data();
                 term1 = *v;
             }
             else if (_idx->ltype == FT_CHAR)
             {
-                char* v = (char*)_idx->data;
+                const char* v = (const char*)_idx->data();
                 term1 = *v;
             }
             else if (_idx->ltype == FT_CHAR16_T)
             {
-                char16_t* v = (char16_t*)_idx->data;
+                const char16_t* v = (const char16_t*)_idx->data();
                 term1 = *v;
                 term1.setUnsigned(true);
             }
             else if (_idx->ltype == FT_CHAR32_T)
             {
-                char32_t* v = (char32_t*)_idx->data;
+                const char32_t* v = (const char32_t*)_idx->data();
                 term1 = *v;
                 term1.setUnsigned(true);
             }
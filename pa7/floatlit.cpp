@@ -0,0 +1,744 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <cassert>
+
+
+// Correctly rounded conversion of decimal floating literals (2.14.4) to
+// float, double and long double, independent of the locale and without heap
+// allocation.
+//
+// The literal is scanned once into a significand `w` of at most 19 digits and
+// a power of ten `q`.  Values that are exact in the target type take one
+// multiplication (Clinger's fast path), the rest of float and double go
+// through the Eisel-Lemire algorithm on 128-bit powers of five.  When that
+// cannot decide (dropped digits, or a product too close to a halfway point),
+// and for long double in general, a close estimate is settled by comparing
+// the exact decimal value against the neighbouring halfway points using big
+// integers.
+
+
+// fixed capacity unsigned big integer, little endian 32-bit limbs
+class FloatLitBigInt
+{
+  public:
+    // 44800 bits: 12000 decimal digits against 5^17000, the long double worst case
+    enum { LIMBS = 1400 };
+
+    FloatLitBigInt()
+        : _n(0)
+    {
+    }
+
+    explicit FloatLitBigInt(uint64_t v)
+    {
+        set(v);
+    }
+
+    FloatLitBigInt(const FloatLitBigInt& o)
+        : _n(o._n)
+    {
+        memcpy(_d, o._d, _n * sizeof(uint32_t));
+    }
+
+    FloatLitBigInt& operator= (const FloatLitBigInt& o)
+    {
+        _n = o._n;
+        memcpy(_d, o._d, _n * sizeof(uint32_t));
+        return *this;
+    }
+
+    void set(uint64_t v)
+    {
+        _n = 0;
+        while (v)
+        {
+            _d[_n++] = (uint32_t)v;
+            v >>= 32;
+        }
+    }
+
+    // this = this * m + a
+    void mulAdd(uint32_t m, uint32_t a)
+    {
+        uint64_t carry = a;
+        for (int i=0; i<_n; i++)
+        {
+            uint64_t t = (uint64_t)_d[i] * m + carry;
+            _d[i] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        if (carry)
+        {
+            assert(_n < LIMBS);
+            _d[_n++] = (uint32_t)carry;
+        }
+    }
+
+    void mulPow5(int n)
+    {
+        static const uint32_t pow5[13] = {
+            1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125,
+            9765625, 48828125, 244140625
+        };
+        for (; n >= 13; n -= 13)
+        {
+            mulAdd(1220703125u, 0);
+        }
+        if (n > 0)
+        {
+            mulAdd(pow5[n], 0);
+        }
+    }
+
+    // this = a * b
+    void mul(const FloatLitBigInt& a, const FloatLitBigInt& b)
+    {
+        assert(this != &a && this != &b);
+        _n = a._n + b._n;
+        assert(_n <= LIMBS);
+        memset(_d, 0, _n * sizeof(uint32_t));
+        for (int i=0; i<a._n; i++)
+        {
+            uint64_t carry = 0;
+            for (int j=0; j<b._n; j++)
+            {
+                uint64_t t = (uint64_t)a._d[i] * b._d[j] + _d[i+j] + carry;
+                _d[i+j] = (uint32_t)t;
+                carry = t >> 32;
+            }
+            _d[i+b._n] = (uint32_t)carry;
+        }
+        trim();
+    }
+
+    // this = this / d, returns the remainder
+    uint32_t divSmall(uint32_t d)
+    {
+        uint64_t rem = 0;
+        for (int i=_n-1; i>=0; i--)
+        {
+            uint64_t t = (rem << 32) | _d[i];
+            _d[i] = (uint32_t)(t / d);
+            rem = t % d;
+        }
+        trim();
+        return (uint32_t)rem;
+    }
+
+    void shiftLeft(int bits)
+    {
+        if (_n == 0)
+        {
+            return;
+        }
+        int words = bits / 32;
+        int b = bits % 32;
+        assert(_n + words + 1 <= LIMBS);
+        if (b)
+        {
+            _d[_n] = 0;
+            for (int i=_n; i>0; i--)
+            {
+                _d[i] = (_d[i] << b) | (_d[i-1] >> (32 - b));
+            }
+            _d[0] <<= b;
+            _n++;
+        }
+        if (words)
+        {
+            memmove(_d + words, _d, _n * sizeof(uint32_t));
+            memset(_d, 0, words * sizeof(uint32_t));
+            _n += words;
+        }
+        trim();
+    }
+
+    void shiftRight(int bits)
+    {
+        int words = bits / 32;
+        int b = bits % 32;
+        if (words >= _n)
+        {
+            _n = 0;
+            return;
+        }
+        memmove(_d, _d + words, (_n - words) * sizeof(uint32_t));
+        _n -= words;
+        if (b)
+        {
+            for (int i=0; i<_n-1; i++)
+            {
+                _d[i] = (_d[i] >> b) | (_d[i+1] << (32 - b));
+            }
+            _d[_n-1] >>= b;
+        }
+        trim();
+    }
+
+    int bitLength() const
+    {
+        return _n ? 32 * (_n - 1) + (32 - __builtin_clz(_d[_n-1])) : 0;
+    }
+
+    // limb `i` counted from the least significant one, zero beyond the top
+    uint32_t limb(int i) const
+    {
+        return (i < _n) ? _d[i] : 0;
+    }
+
+    static int compare(const FloatLitBigInt& a, const FloatLitBigInt& b)
+    {
+        if (a._n != b._n)
+        {
+            return (a._n < b._n) ? -1 : 1;
+        }
+        for (int i=a._n-1; i>=0; i--)
+        {
+            if (a._d[i] != b._d[i])
+            {
+                return (a._d[i] < b._d[i]) ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+  private:
+    void trim()
+    {
+        while (_n > 0 && _d[_n-1] == 0)
+        {
+            _n--;
+        }
+    }
+
+    int      _n;
+    uint32_t _d[LIMBS];
+};
+
+
+// 5^q for q in [-342, 308], as 128-bit significands with the top bit set:
+// truncated for q >= 0, for q < 0 the reciprocal rounded as in Lemire's
+// "Number Parsing at a Gigabyte per Second".  Built once on first use.
+class FloatLitPowersOfFive
+{
+  public:
+    enum { MIN_Q = -342, MAX_Q = 308 };
+
+    static const uint64_t* at(int q)
+    {
+        static const FloatLitPowersOfFive table;
+        return table._t + 2 * (q - MIN_Q);
+    }
+
+  private:
+    FloatLitPowersOfFive()
+    {
+        // floor(2^L / 5^n) for growing n by exact repeated division;
+        // L covers the largest scale 2 * bitlen(5^342) + 128
+        const int L = 1728;
+        FloatLitBigInt pow5(1);
+        FloatLitBigInt recip(1);
+        recip.shiftLeft(L);
+        for (int n=1; n<=-MIN_Q; n++)
+        {
+            pow5.mulAdd(5, 0);
+            recip.divSmall(5);
+            int z = pow5.bitLength();
+            int b = (n <= 27) ? z + 127 : 2 * z + 128;
+            FloatLitBigInt c(recip);
+            c.shiftRight(L - b);
+            c.mulAdd(1, 1);
+            if (c.bitLength() > 128)
+            {
+                c.shiftRight(c.bitLength() - 128);
+            }
+            store(-n, c);
+        }
+
+        pow5.set(1);
+        for (int q=0; q<=MAX_Q; q++)
+        {
+            if (q > 0)
+            {
+                pow5.mulAdd(5, 0);
+            }
+            FloatLitBigInt c(pow5);
+            int bits = c.bitLength();
+            if (bits < 128)
+            {
+                c.shiftLeft(128 - bits);
+            }
+            else
+            {
+                c.shiftRight(bits - 128);
+            }
+            store(q, c);
+        }
+    }
+
+    void store(int q, const FloatLitBigInt& c)
+    {
+        uint64_t* t = _t + 2 * (q - MIN_Q);
+        t[0] = ((uint64_t)c.limb(3) << 32) | c.limb(2);
+        t[1] = ((uint64_t)c.limb(1) << 32) | c.limb(0);
+    }
+
+    uint64_t _t[2 * (MAX_Q - MIN_Q + 1)];
+};
+
+
+// parameters of a binary floating type, values are written as m * 2^k
+struct FloatLitFormat
+{
+    int mbits;          // explicit significand bits (p - 1)
+    int minExponent;    // negated exponent bias
+    int infPower;       // biased exponent of infinity
+    int minPow10;       // range of q handled by Eisel-Lemire, empty for none
+    int maxPow10;
+    int minRoundEven;   // range of q where w * 10^q can fall on a halfway point
+    int maxRoundEven;
+    int minExp2;        // k of the subnormals
+    int maxExp2;        // k of the largest finite value
+    int minMag;         // decimal magnitudes below round to zero
+    int maxMag;         // decimal magnitudes above overflow
+    int maxDigits;      // significant digits that can matter for rounding
+};
+
+static const FloatLitFormat FloatLitFloat      = { 23,   -127,   0xFF,  -65,  38, -17, 10,   -149,   104,   -46,   38,   120 };
+static const FloatLitFormat FloatLitDouble     = { 52,  -1023,  0x7FF, -342, 308,  -4, 23,  -1074,   971,  -324,  308,   800 };
+static const FloatLitFormat FloatLitLongDouble = { 63, -16383, 0x7FFF,    1,   0,   0,  0, -16445, 16320, -4951, 4932, 12000 };
+
+struct FloatLitValue
+{
+    uint64_t m;
+    int      k;
+    bool     inf;
+};
+
+
+class FloatLiteralDecoder
+{
+  public:
+    // [begin, end) is digit-sequence [. digit-sequence] [e|E [+|-] digit-sequence]
+    // or one of its shorter forms, as accepted by the pp-number scanner
+    FloatLiteralDecoder(const char* begin, const char* end)
+        : _digits(0), _w(0), _q(0), _mag(0), _truncated(false)
+    {
+        const char* p = begin;
+        int dexp = 0;
+        int nw = 0;
+        bool afterDot = false;
+        for (; p != end; p++)
+        {
+            char c = *p;
+            if (c == '.' && !afterDot)
+            {
+                afterDot = true;
+                continue;
+            }
+            if (c < '0' || c > '9')
+            {
+                break;
+            }
+            if (_digits == 0 && c == '0')
+            {
+                // leading zero
+                dexp -= afterDot;
+                continue;
+            }
+            if (_digits == 0)
+            {
+                _digits = p;
+            }
+            if (nw < 19)
+            {
+                _w = _w * 10 + (c - '0');
+                nw++;
+                dexp -= afterDot;
+            }
+            else
+            {
+                _truncated |= (c != '0');
+                dexp += !afterDot;
+            }
+        }
+        _mantEnd = p;
+
+        int exp = 0;
+        if (p != end && (*p == 'e' || *p == 'E'))
+        {
+            p++;
+            bool neg = false;
+            if (p != end && (*p == '+' || *p == '-'))
+            {
+                neg = (*p == '-');
+                p++;
+            }
+            for (; p != end && *p >= '0' && *p <= '9'; p++)
+            {
+                if (exp < 100000000)
+                {
+                    exp = exp * 10 + (*p - '0');
+                }
+            }
+            if (neg)
+            {
+                exp = -exp;
+            }
+        }
+        _q = dexp + exp;
+        _mag = _q + nw - 1;
+    }
+
+    float toFloat() const
+    {
+        static const float pow10[] = {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+        };
+        if (!_truncated && _w <= (1ull << 24) && _q >= -10 && _q <= 10)
+        {
+            return (_q < 0) ? (float)_w / pow10[-_q] : (float)_w * pow10[_q];
+        }
+        FloatLitValue v;
+        decode(FloatLitFloat, v);
+        return v.inf ? HUGE_VALF : ldexpf((float)v.m, v.k);
+    }
+
+    double toDouble() const
+    {
+        static const double pow10[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        if (!_truncated && _w <= (1ull << 53) && _q >= -22 && _q <= 22)
+        {
+            return (_q < 0) ? (double)_w / pow10[-_q] : (double)_w * pow10[_q];
+        }
+        FloatLitValue v;
+        decode(FloatLitDouble, v);
+        return v.inf ? HUGE_VAL : ldexp((double)v.m, v.k);
+    }
+
+    // assumes the x87 80-bit format with its default 64-bit precision
+    long double toLongDouble() const
+    {
+        static const long double pow10[] = {
+            1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L,
+            1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+            1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+        };
+        if (!_truncated && _q >= -27 && _q <= 27)
+        {
+            return (_q < 0) ? (long double)_w / pow10[-_q] : (long double)_w * pow10[_q];
+        }
+        FloatLitValue v;
+        decode(FloatLitLongDouble, v);
+        return v.inf ? HUGE_VALL : ldexpl((long double)v.m, v.k);
+    }
+
+  private:
+    void decode(const FloatLitFormat& f, FloatLitValue& v) const
+    {
+        v.m = 0;
+        v.k = f.minExp2;
+        v.inf = false;
+        if (_w == 0 || _mag < f.minMag)
+        {
+            return;
+        }
+        if (_mag > f.maxMag)
+        {
+            v.inf = true;
+            return;
+        }
+
+        if (_q >= f.minPow10 && _q <= f.maxPow10 && lemire(f, _w, v))
+        {
+            if (!_truncated)
+            {
+                return;
+            }
+            // the dropped digits put the value strictly between w and w+1
+            FloatLitValue up;
+            if (lemire(f, _w + 1, up) && up.inf == v.inf && up.m == v.m && up.k == v.k)
+            {
+                return;
+            }
+        }
+
+        estimate(f, v);
+        refine(f, v);
+    }
+
+    // Eisel-Lemire: correctly rounded w * 10^q, false when undecided
+    bool lemire(const FloatLitFormat& f, uint64_t w, FloatLitValue& v) const
+    {
+        int lz = __builtin_clzll(w);
+        w <<= lz;
+        const uint64_t* pow5 = FloatLitPowersOfFive::at(_q);
+        unsigned __int128 product = (unsigned __int128)w * pow5[0];
+        uint64_t hi = (uint64_t)(product >> 64);
+        uint64_t lo = (uint64_t)product;
+        uint64_t mask = ~0ull >> (f.mbits + 3);
+        if ((hi & mask) == mask)
+        {
+            unsigned __int128 second = (unsigned __int128)w * pow5[1];
+            uint64_t shi = (uint64_t)(second >> 64);
+            lo += shi;
+            hi += (shi > lo);
+        }
+        if (lo == ~0ull && (_q < -27 || _q > 55))
+        {
+            return false;
+        }
+
+        int upperbit = (int)(hi >> 63);
+        int shift = upperbit + 64 - f.mbits - 3;
+        uint64_t m = hi >> shift;
+        int power2 = (((152170 + 65536) * _q) >> 16) + 63 + upperbit - lz - f.minExponent;
+        v.inf = false;
+        if (power2 <= 0)
+        {
+            // subnormal, rounding up may carry into the smallest normal
+            v.k = f.minExp2;
+            if (-power2 + 1 >= 64)
+            {
+                v.m = 0;
+                return true;
+            }
+            m >>= -power2 + 1;
+            m += m & 1;
+            v.m = m >> 1;
+            return true;
+        }
+        if (lo <= 1 && _q >= f.minRoundEven && _q <= f.maxRoundEven && (m & 3) == 1 && (m << shift) == hi)
+        {
+            // exactly halfway: round to even
+            m &= ~1ull;
+        }
+        m += m & 1;
+        m >>= 1;
+        if (m >= (2ull << f.mbits))
+        {
+            m = 1ull << f.mbits;
+            power2++;
+        }
+        if (power2 >= f.infPower)
+        {
+            v.inf = true;
+            return true;
+        }
+        v.m = m;
+        v.k = power2 + f.minExponent - f.mbits;
+        return true;
+    }
+
+    // a candidate within a few units in the last place
+    void estimate(const FloatLitFormat& f, FloatLitValue& v) const
+    {
+        int p = f.mbits + 1;
+        long double x;
+        if (_q < -4800)
+        {
+            x = (long double)_w * powl(10.0L, _q + 100) * 1e-100L;
+        }
+        else if (_q > 4800)
+        {
+            x = (long double)_w * powl(10.0L, _q - 100) * 1e100L;
+        }
+        else
+        {
+            x = (long double)_w * powl(10.0L, _q);
+        }
+
+        v.inf = false;
+        if (x == 0)
+        {
+            v.m = 0;
+            v.k = f.minExp2;
+            return;
+        }
+        int ex = 0;
+        if (!std::isinf(x))
+        {
+            long double fr = frexpl(x, &ex);
+            v.m = (uint64_t)ldexpl(fr, p);
+            v.k = ex - p;
+        }
+        if (std::isinf(x) || v.k > f.maxExp2)
+        {
+            v.m = maxMant(f);
+            v.k = f.maxExp2;
+        }
+        else if (v.k < f.minExp2)
+        {
+            int s = f.minExp2 - v.k;
+            v.m = (s >= 64) ? 0 : v.m >> s;
+            v.k = f.minExp2;
+        }
+    }
+
+    // move the candidate to the correctly rounded value
+    void refine(const FloatLitFormat& f, FloatLitValue& v) const
+    {
+        // the literal is x * 2^e2 / y, sticky if nonzero digits were dropped
+        FloatLitBigInt x;
+        FloatLitBigInt y(1);
+        int e2 = 0;
+        bool sticky = false;
+        loadDigits(f.maxDigits, x, e2, sticky);
+        if (e2 >= 0)
+        {
+            x.mulPow5(e2);
+        }
+        else
+        {
+            y.mulPow5(-e2);
+        }
+
+        for (;;)
+        {
+            int c = compareHalfway(x, e2, y, sticky, v);
+            if (c > 0 || (c == 0 && (v.m & 1)))
+            {
+                if (!next(f, v))
+                {
+                    v.inf = true;
+                    return;
+                }
+                if (c == 0)
+                {
+                    return;
+                }
+                continue;
+            }
+            if (c == 0 || v.m == 0)
+            {
+                return;
+            }
+
+            FloatLitValue below = v;
+            prev(f, below);
+            c = compareHalfway(x, e2, y, sticky, below);
+            if (c < 0)
+            {
+                v = below;
+                continue;
+            }
+            if (c == 0 && !(below.m & 1))
+            {
+                v = below;
+            }
+            return;
+        }
+    }
+
+    // compare the literal with the point halfway between v and its successor
+    static int compareHalfway(const FloatLitBigInt& x, int e2, const FloatLitBigInt& y, bool sticky, const FloatLitValue& v)
+    {
+        // halfway = (2m + 1) * 2^(k-1)
+        FloatLitBigInt half;
+        half.set(v.m);
+        half.shiftLeft(1);
+        half.mulAdd(1, 1);
+
+        FloatLitBigInt lhs(x);
+        FloatLitBigInt rhs;
+        rhs.mul(half, y);
+        int d = e2 - (v.k - 1);
+        if (d >= 0)
+        {
+            lhs.shiftLeft(d);
+        }
+        else
+        {
+            rhs.shiftLeft(-d);
+        }
+        int c = FloatLitBigInt::compare(lhs, rhs);
+        return (c == 0 && sticky) ? 1 : c;
+    }
+
+    static uint64_t maxMant(const FloatLitFormat& f)
+    {
+        return ~0ull >> (63 - f.mbits);
+    }
+
+    // false on overflow
+    static bool next(const FloatLitFormat& f, FloatLitValue& v)
+    {
+        if (v.m == maxMant(f))
+        {
+            v.m = 1ull << f.mbits;
+            v.k++;
+            return v.k <= f.maxExp2;
+        }
+        v.m++;
+        return true;
+    }
+
+    static void prev(const FloatLitFormat& f, FloatLitValue& v)
+    {
+        if (v.m == (1ull << f.mbits) && v.k > f.minExp2)
+        {
+            v.m = maxMant(f);
+            v.k--;
+        }
+        else
+        {
+            v.m--;
+        }
+    }
+
+    // the first `maxDigits` significant digits as an integer scaled by 10^e10
+    void loadDigits(int maxDigits, FloatLitBigInt& d, int& e10, bool& sticky) const
+    {
+        static const uint32_t pow10[10] = {
+            1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+        };
+        d.set(0);
+        sticky = false;
+        int n = 0;
+        uint32_t chunk = 0;
+        int chunkLen = 0;
+        for (const char* p = _digits; p != _mantEnd; p++)
+        {
+            if (*p == '.')
+            {
+                continue;
+            }
+            if (n == maxDigits)
+            {
+                if (*p != '0')
+                {
+                    sticky = true;
+                    break;
+                }
+                continue;
+            }
+            chunk = chunk * 10 + (*p - '0');
+            chunkLen++;
+            n++;
+            if (chunkLen == 9)
+            {
+                d.mulAdd(pow10[9], chunk);
+                chunk = 0;
+                chunkLen = 0;
+            }
+        }
+        if (chunkLen)
+        {
+            d.mulAdd(pow10[chunkLen], chunk);
+        }
+        e10 = _mag - (n - 1);
+    }
+
+    const char* _digits;      // first significant digit
+    const char* _mantEnd;     // end of the digits and the point
+    uint64_t    _w;           // first 19 significant digits
+    int         _q;           // the literal is about _w * 10^_q
+    int         _mag;         // decimal exponent of the first significant digit
+    bool        _truncated;   // nonzero digits did not fit into _w
+};
@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <algorithm>
+#include <cstdint>
 
 using namespace std;
 
@@ -17,6 +18,59 @@ using namespace std;
 // }
 
 
+// TerminalSet: a set of terminal ids as a bitset
+class TerminalSet {
+  public:
+    explicit TerminalSet(unsigned size = 0)
+        : _words((size + 63) / 64, 0)
+    {
+    }
+
+    bool has(unsigned t) const
+    {
+        return (_words[t / 64] >> (t % 64)) & 1;
+    }
+
+    void insert(unsigned t)
+    {
+        _words[t / 64] |= uint64_t(1) << (t % 64);
+    }
+
+    // true if `s` had anything new
+    bool add(const TerminalSet& s)
+    {
+        bool grown = false;
+        for (unsigned i=0; i<_words.size(); i++) {
+            uint64_t w = _words[i] | s._words[i];
+            grown |= (w != _words[i]);
+            _words[i] = w;
+        }
+        return grown;
+    }
+
+    void intersect(const TerminalSet& s)
+    {
+        for (unsigned i=0; i<_words.size(); i++) {
+            _words[i] &= s._words[i];
+        }
+    }
+
+    set<string> names(const vector<string>& terminalNames) const
+    {
+        set<string> s;
+        for (unsigned t=0; t<terminalNames.size(); t++) {
+            if (has(t)) {
+                s.insert(terminalNames[t]);
+            }
+        }
+        return s;
+    }
+
+  private:
+    vector<uint64_t> _words;
+};
+
+
 class RuleTerm {
   public:
     enum RuleTermType {
@@ -29,31 +83,40 @@ class RuleTerm {
     string           name;
     RuleTermType     type;
     vector<RuleTerm> terms;
+    int              rule;          // id of a nonterminal, or -1
+    int              terminal;      // id of a terminal, or -1
 
-    void dump() {
+    // the term as written in the grammar
+    string str() const {
+        string s;
         if (terms.size() > 0) {
-            cout << "(";
+            s += "(";
             for (unsigned i=0; i<terms.size(); i++) {
-                terms[i].dump();
+                s += terms[i].str();
                 if (i<terms.size()-1) {
-                    cout << " ";
+                    s += " ";
                 }
             }
-            cout << ")";
+            s += ")";
         }
         else {
-            cout << name;
+            s += name;
         }
         
         if (type == PLUS) {
-            cout << "+";
+            s += "+";
         }
         else if (type == STAR) {
-            cout << "*";
+            s += "*";
         }    
         else if (type == QUES) {
-            cout << "?";
+            s += "?";
         }
+        return s;
+    }
+
+    void dump() {
+        cout << str();
     }
 
 
@@ -102,6 +165,10 @@ struct deriveSort {
 class GramGen 
 {
   public:
+    GramGen()
+        : tableBackend(false)
+    {
+    }
 
     string match() {
         string r = *mit;
@@ -191,317 +258,324 @@ class GramGen
     }
 
 
-    bool can_be_empty(Rule& rule) 
+    // Grammar analysis.  Terminals and nonterminals are resolved to ids
+    // once (RuleTerm::rule, RuleTerm::terminal), the FIRST and FOLLOW sets
+    // are TerminalSets, and both are computed by worklists that revisit a
+    // rule only when something it depends on has grown.
+
+    // the id of terminal `name`, 0 is "$", the end of the input
+    unsigned terminalId(const string& name)
     {
-        if (rule.canBeEmpty >= 0) 
-        {
-            return rule.canBeEmpty == 0 ? false : true;
+        map<string, unsigned>::iterator it = terminalIds.find(name);
+        if (it != terminalIds.end()) {
+            return it->second;
         }
+        terminalNames.push_back(name);
+        return terminalIds[name] = terminalNames.size() - 1;
+    }
 
-        for (unsigned i=0; i<rule.derives.size() ; i++) 
-        {
-            bool canBeEmpty = true;
-
-            for (unsigned j=0; j<rule.derives[i].size(); j++)
-            {
-                canBeEmpty = canBeEmpty && can_be_empty( rule.derives[i][j] ); 
-            }
-
-            if (canBeEmpty == true) 
-            {
-                rule.canBeEmpty = 1;
-                return true;
+    void resolve(RuleTerm& term)
+    {
+        term.rule = -1;
+        term.terminal = -1;
+        if (term.terms.size() > 0) {
+            for (unsigned i=0; i<term.terms.size(); i++) {
+                resolve(term.terms[i]);
             }
         }
-        rule.canBeEmpty = 0;
-        return false;
+        else if (isNonTerminal(term.name)) {
+            term.rule = ruleIds[term.name];
+        }
+        else {
+            term.terminal = terminalId(term.name);
+        }
     }
 
-
-    bool can_be_empty(RuleTerm& term)
+    void resolveSymbols()
     {
-        if (term.type == RuleTerm::NONE)
-        {
-            for (unsigned i=0; i<rules.size() ; i++) 
-            {
-                if (rules[i]->name == term.name) 
-                {
-                    return can_be_empty( *rules[i] );
-                }        
-            }
-            return false;
-        }
-        else if (term.type == RuleTerm::STAR || term.type == RuleTerm::QUES)
-        {
-            return true;
+        terminalNames.clear();
+        terminalIds.clear();
+        terminalId("$");
+        ruleIds.clear();
+        for (unsigned i=0; i<rules.size(); i++) {
+            ruleIds[rules[i]->name] = i;
         }
-        else // if (term.type == RuleTerm::PLUS)
-        {
-            if (term.terms.size() == 0) 
-            {
-                for (unsigned i=0; i<rules.size() ; i++) 
-                {
-                    if (rules[i]->name == term.name) 
-                    {
-                        return can_be_empty( *rules[i] );
-                    }        
-                }
-                return false;
-            }
-            else 
-            {
-                for (unsigned i=0; i<term.terms.size(); i++) 
-                {
-                    if ( can_be_empty( term.terms[i] ) == false) 
-                    {
-                        return false;
-                    } 
+        for (unsigned i=0; i<rules.size(); i++) {
+            for (unsigned j=0; j<rules[i]->derives.size(); j++) {
+                for (unsigned k=0; k<rules[i]->derives[j].size(); k++) {
+                    resolve(rules[i]->derives[j][k]);
                 }
-                return true;
             }
         }
     }
 
-
-    void update_empty()
+    // the rules whose derives mention the rule `r`, for the FIRST worklist
+    void addUsers(RuleTerm& term, unsigned user, vector< set<unsigned> >& users)
     {
-        for (unsigned i=0; i<rules.size(); i++) 
-        {
-            can_be_empty( *rules[i] );
-            if (rules[i]->canBeEmpty != 0) {
-                cout << "// can be emppty " << rules[i]->name  << endl;;
-            }
+        if (term.rule >= 0) {
+            users[term.rule].insert(user);
+        }
+        for (unsigned i=0; i<term.terms.size(); i++) {
+            addUsers(term.terms[i], user, users);
         }
     }
 
-
-    set<string> find_FIRST(RuleTerm& term) 
+    bool nullable(RuleTerm& term)
     {
-        if (term.type == RuleTerm::NONE) 
-        {
-            if ( isNonTerminal(term.name) ) {
-                map<string, Rule*>::iterator mit = this->nonTerminalMap.find( term.name );
-                return find_FIRST( *(mit->second) );
-            }
-            else {
-                // terminal
-                set<string> s;
-                s.insert( term.name );
-                return s;
-            }
+        if (term.type == RuleTerm::QUES || term.type == RuleTerm::STAR) {
+            return true;
         }
-        else if ( term.type == RuleTerm::QUES || term.type == RuleTerm::PLUS || term.type == RuleTerm::STAR) 
-        {
-            set<string> s;
-            if (term.type == RuleTerm::QUES || term.type == RuleTerm::STAR)
-            {
-                s.insert("$");
-            }
-
-            if (term.terms.size() == 0) 
-            {
-                if ( isNonTerminal(term.name) ) {
-                    map<string, Rule*>::iterator mit = this->nonTerminalMap.find( term.name );
-                    set<string> s0 = find_FIRST( *(mit->second) );
-                    s.insert(s0.begin(), s0.end());
-                }
-                else {
-                    // terminal
-                    s.insert( term.name );
-                }
-            } 
-            else 
-            {
-                for (unsigned i=0; i<term.terms.size() ; i++) 
-                {
-                    set<string> s1 = find_FIRST( term.terms[i]);
-                    s.insert(s1.begin(), s1.end());
-                    if (s1.find("$") == s1.end()) {
-                        break; 
-                    }
-                }
-            }
-            return s;
+        if (term.terms.size() > 0) {
+            return nullable(term.terms);
         }
-
-        return set<string>();
+        return term.rule >= 0 && ruleNullable[term.rule];
     }
 
-
-    set<string> find_FIRST(vector<RuleTerm>& deriveTerms) 
+    bool nullable(vector<RuleTerm>& terms)
     {
-        set<string> rslt;
-
-        for (unsigned i=0; i<deriveTerms.size(); i++) {
-            set<string> s = find_FIRST( deriveTerms[i] );
-            set<string>::iterator emptyIt = s.find("$");
-            bool has_empty = (emptyIt != s.end()) ? true : false;
-            
-            if ( has_empty  && i < deriveTerms.size()-1) {
-                // we can not know whether we could keep "$" in the set or not
-                // until the last term of the derive
-                s.erase( emptyIt ); 
-            }
-
-            rslt.insert(s.begin(), s.end());
-            if ( has_empty == false ) {  // when this term has no "$"
-                break;
+        for (unsigned i=0; i<terms.size(); i++) {
+            if (!nullable(terms[i])) {
+                return false;
             }
         }
-        return rslt;
+        return true;
     }
 
-
-    set<string> find_FIRST( Rule& rule ) 
+    // adds FIRST(term) to `first`, the empty string left out
+    void addFirst(RuleTerm& term, TerminalSet& first)
     {
-        if (rule.firstTokens.size() > 0) {
-            return rule.firstTokens;
+        if (term.terms.size() > 0) {
+            addFirst(term.terms, first);
         }
-
-        set<string> rslt;
-        for (unsigned j=0; j<rule.derives.size(); j++) {
-            set<string> s = find_FIRST( rule.derives[j] ); 
-            rslt.insert(s.begin(), s.end());
+        else if (term.rule >= 0) {
+            first.add(ruleFirst[term.rule]);
+        }
+        else {
+            first.insert(term.terminal);
         }
-        return rslt;
     }
 
- 
-    void create_FIRST() 
+    void addFirst(vector<RuleTerm>& terms, TerminalSet& first)
     {
-        for (unsigned i=0; i<rules.size(); i++) 
-        {
-            set<string> s = find_FIRST( *rules[i] );        
-            rules[i]->firstTokens = s;
-
-            // dump for debug
-            cout <<  rules[i]->name << " TOKENS: " << endl;
-            for (set<string>::iterator sit = s.begin(); sit != s.end(); ++sit)
-            {
-                cout << "  " << *sit;
+        for (unsigned i=0; i<terms.size(); i++) {
+            addFirst(terms[i], first);
+            if (!nullable(terms[i])) {
+                break;
             }
-            cout << endl << endl;;
         }
     }
 
-
-    set<string> create_FOLLOW( RuleTerm& term, set<string> follow_tokens ) 
+    // FIRST of a derive as a set of names, with "$" if it can be empty
+    set<string> firstNames(vector<RuleTerm>& terms)
     {
-        if (term.terms.size() > 0) 
-        {
-            // multiple term
-            for (int i=(int)term.terms.size()-1; i>=0 ; --i) 
-            {
-                follow_tokens = create_FOLLOW( term.terms[i], follow_tokens );
-            } 
-            return follow_tokens;
+        TerminalSet first(terminalNames.size());
+        addFirst(terms, first);
+        set<string> names = first.names(terminalNames);
+        if (nullable(terms)) {
+            names.insert("$");
         }
-        else 
-        {
-            // single term
-            if ( isNonTerminal( term.name ) ) 
-            {
-                Rule* rule = nonTerminalMap.find( term.name )->second;
-                rule->followTokens.insert( follow_tokens.begin(), follow_tokens.end());
+        return names;
+    }
 
-                set<string> first = rule->firstTokens;
-                if (first.find("$") != first.end()) 
-                {
-                    first.insert( follow_tokens.begin() , follow_tokens.end() );
-                    first.erase( "$" );
+    void create_FIRST()
+    {
+        unsigned nrules = rules.size();
+        ruleNullable.assign(nrules, false);
+        ruleFirst.assign(nrules, TerminalSet(terminalNames.size()));
+
+        vector< set<unsigned> > users(nrules);
+        for (unsigned i=0; i<nrules; i++) {
+            for (unsigned j=0; j<rules[i]->derives.size(); j++) {
+                for (unsigned k=0; k<rules[i]->derives[j].size(); k++) {
+                    addUsers(rules[i]->derives[j][k], i, users);
                 }
-                return first;
             }
-            else 
-            {
-                if (term.type == RuleTerm::QUES || term.type == RuleTerm::STAR) 
-                {
-                    follow_tokens.insert( term.name );
+        }
+
+        vector<unsigned> work;
+        vector<bool> queued(nrules, true);
+        for (unsigned i=nrules; i-->0; ) {
+            work.push_back(i);
+        }
+        while (!work.empty())
+        {
+            unsigned r = work.back();
+            work.pop_back();
+            queued[r] = false;
+
+            bool grown = false;
+            for (unsigned j=0; j<rules[r]->derives.size(); j++) {
+                vector<RuleTerm>& derive = rules[r]->derives[j];
+                if (!ruleNullable[r] && nullable(derive)) {
+                    ruleNullable[r] = true;
+                    grown = true;
                 }
-                else {
-                    follow_tokens.clear();
-                    follow_tokens.insert(term.name);
+                TerminalSet first(terminalNames.size());
+                addFirst(derive, first);
+                grown |= ruleFirst[r].add(first);
+            }
+            if (grown) {
+                for (set<unsigned>::iterator it=users[r].begin(); it!=users[r].end(); ++it) {
+                    if (!queued[*it]) {
+                        queued[*it] = true;
+                        work.push_back(*it);
+                    }
                 }
-                return follow_tokens;
             }
         }
-    }
-
 
-    void create_FOLLOW_iteration() 
-    {
-        // the first rule is the root, "translation-unit"
-
-        for (unsigned i=0; i<rules.size(); i++) 
+        for (unsigned i=0; i<nrules; i++)
         {
-            for (unsigned j=0; j<rules[i]->derives.size() ; j++) 
-            {
-                // for each derive scan token one by one
-                set<string> follow = find_FIRST( rules[i]->derives[j].back() );
-                follow.erase( "$" );
-
-                for (int k=(int)rules[i]->derives[j].size() -2; k>=0; k--) 
-                {
-                    follow = create_FOLLOW( rules[i]->derives[j][k] , follow);
-                }
+            rules[i]->canBeEmpty = ruleNullable[i];
+            rules[i]->firstTokens = ruleFirst[i].names(terminalNames);
+            if (ruleNullable[i]) {
+                rules[i]->firstTokens.insert("$");
             }
-
+            dumpTokens(rules[i]->name + " TOKENS: ", rules[i]->firstTokens);
         }
+    }
 
-        rules[0]->followTokens.insert("$");
-
-        for (unsigned i=0 ; i<rules.size() ; i++) 
+    // dump for debug
+    void dumpTokens(const string& title, const set<string>& s)
+    {
+        cout << title << endl;
+        for (set<string>::const_iterator sit = s.begin(); sit != s.end(); ++sit)
         {
-            for (unsigned j=0; j<rules[i]->derives.size() ; j++) 
-            {
-                set<string> follow = rules[i]->followTokens; 
-                for (int k=(int)rules[i]->derives[j].size()-1; k>=0; k--) 
-                {
-                    follow = create_FOLLOW( rules[i]->derives[j][k] , follow);
-                }
-            } 
+            cout << "  " << *sit;
         }
+        cout << endl << endl;
+    }
 
+    // What may follow a term: the terminals in `first`, and if `owner` is
+    // set also FOLLOW of the rule being scanned.
+    struct FollowContext {
+        TerminalSet first;
+        bool        owner;
+    };
 
+    // scans `terms` from the back: the sets every nonterminal in them gets
+    // go to ruleFollow, FOLLOW(rule) -> FOLLOW(nonterminal) edges to
+    // `inherits`; returns what may follow the term before
+    FollowContext scanFollow(vector<RuleTerm>& terms, FollowContext after, unsigned rule, vector< set<unsigned> >& inherits)
+    {
+        for (unsigned i=terms.size(); i-->0; )
+        {
+            RuleTerm& term = terms[i];
+            bool repeats = (term.type == RuleTerm::STAR || term.type == RuleTerm::PLUS);
 
-    }
-
+            TerminalSet first(terminalNames.size());
+            addFirst(term, first);
 
-    void create_FOLLOW() {
-        int follow_token_count = -1;
+            // a repeated term may be followed by itself
+            FollowContext inside = after;
+            if (repeats) {
+                inside.first.add(first);
+            }
 
-        while (1) {
-            create_FOLLOW_iteration();
-            int count = 0;
-            for (unsigned i=0; i<rules.size(); i++) {
-                count += rules[i]->followTokens.size(); 
+            if (term.terms.size() > 0) {
+                scanFollow(term.terms, inside, rule, inherits);
             }
-            if (follow_token_count == -1) {
-                follow_token_count = count;
+            else if (term.rule >= 0) {
+                ruleFollow[term.rule].add(inside.first);
+                if (inside.owner) {
+                    inherits[rule].insert(term.rule);
+                }
             }
-            else if (count == follow_token_count) {
-                break;
+
+            if (nullable(term)) {
+                after.first.add(first);
             }
             else {
-                follow_token_count = count;
+                after.first = first;
+                after.owner = false;
+            }
+        }
+        return after;
+    }
+
+    void create_FOLLOW()
+    {
+        unsigned nrules = rules.size();
+        ruleFollow.assign(nrules, TerminalSet(terminalNames.size()));
+        ruleFollow[0].insert(terminalId("$"));
+
+        // inherits[a] holds the rules that FOLLOW(a) flows into
+        vector< set<unsigned> > inherits(nrules);
+        for (unsigned i=0; i<nrules; i++) {
+            for (unsigned j=0; j<rules[i]->derives.size(); j++) {
+                FollowContext end = { TerminalSet(terminalNames.size()), true };
+                scanFollow(rules[i]->derives[j], end, i, inherits);
             }
         }
 
-        // dump for debug
-        for (unsigned i=0 ; i<rules.size() ; i++) 
+        vector<unsigned> work;
+        vector<bool> queued(nrules, true);
+        for (unsigned i=nrules; i-->0; ) {
+            work.push_back(i);
+        }
+        while (!work.empty())
         {
-            set<string> s = rules[i]->followTokens;
-            cout <<  rules[i]->name << " FOLLOW TOKENS: " << endl;
-            for (set<string>::iterator sit = s.begin(); sit != s.end(); ++sit)
-            {
-                cout << "  " << *sit;
+            unsigned r = work.back();
+            work.pop_back();
+            queued[r] = false;
+            for (set<unsigned>::iterator it=inherits[r].begin(); it!=inherits[r].end(); ++it) {
+                if (ruleFollow[*it].add(ruleFollow[r]) && !queued[*it]) {
+                    queued[*it] = true;
+                    work.push_back(*it);
+                }
             }
-            cout << endl << endl;;
-        }            
+        }
 
+        for (unsigned i=0; i<nrules; i++) {
+            rules[i]->followTokens = ruleFollow[i].names(terminalNames);
+            dumpTokens(rules[i]->name + " FOLLOW TOKENS: ", rules[i]->followTokens);
+        }
+    }
 
+    // LL(1) conflicts: terminals that start more than one alternative of a
+    // rule, or start one and follow the rule where another can be empty
+    void reportConflicts(ostream& out)
+    {
+        unsigned nconflicts = 0;
+        unsigned nrules = 0;
+        for (unsigned i=0; i<rules.size(); i++)
+        {
+            Rule* rule = rules[i];
+            vector<TerminalSet> firsts;
+            for (unsigned j=0; j<rule->derives.size(); j++) {
+                TerminalSet first(terminalNames.size());
+                addFirst(rule->derives[j], first);
+                if (nullable(rule->derives[j])) {
+                    first.add(ruleFollow[i]);
+                }
+                firsts.push_back(first);
+            }
+
+            stringstream lines;
+            for (unsigned j=0; j<firsts.size(); j++) {
+                for (unsigned k=j+1; k<firsts.size(); k++) {
+                    TerminalSet both = firsts[j];
+                    both.intersect(firsts[k]);
+                    set<string> names = both.names(terminalNames);
+                    if (names.empty()) {
+                        continue;
+                    }
+                    lines << "  alternatives " << j << " and " << k << ":";
+                    for (set<string>::iterator it=names.begin(); it!=names.end(); ++it) {
+                        lines << " " << *it;
+                    }
+                    lines << endl;
+                    nconflicts++;
+                }
+            }
+            if (!lines.str().empty()) {
+                out << rule->name << endl << lines.str();
+                nrules++;
+            }
+        }
+        out << nconflicts << " LL(1) conflicts in " << nrules << " of " << rules.size() << " rules" << endl;
     }
-    
+
     void parse(vector<string> ts) 
     {
         tokens = ts;
@@ -527,13 +601,22 @@ class GramGen
             nonTerminalMap[rule->name] = rule;
         }
 
-        update_empty();
-        create_FIRST();  // should be after "update_empty", referring to its result
+        resolveSymbols();
+        create_FIRST();
         create_FOLLOW();
 
+        ofstream report("conflicts.txt");
+        reportConflicts(report);
+
         // start to generate code
         //
-	    generateCode(); 
+        if (tableBackend) {
+            generateTables();
+        }
+        else {
+	        generateCode(); 
+        }
+        generateAstTypes();
     }
 
 
@@ -570,12 +653,12 @@ class GramGen
         if ( isNonTerminal( token ) ) 
         {
             tmpss << "parse__" << replaceStr( token , '-' , '_') << "();"; 
-            code << indent << "CppAstPtr " << rID << " = " << tmpss.str() << endl;
+            code << indent << "CppAstRef " << rID << " = " << tmpss.str() << endl;
 
             map<string,Rule*>::iterator mit = this->nonTerminalMap.find( token );
             if (mit->second->canBeEmpty == 0)    
             {
-                code << indent << "if (" << rID << "->size()==0) {" << endl;
+                code << indent << "if (_ast.size(" << rID << ")==0) {" << endl;
                 code << indent << "    break;" << endl;
                 code << indent << "}" << endl;
             }
@@ -583,8 +666,8 @@ class GramGen
         else 
         {
             tmpss << "match(" << generateTokenName( token ) << ");"; 
-            code << indent << "CppAstPtr " << rID << " = " << tmpss.str() << endl;
-            code << indent << "if (" << rID << "->size()==0) {" << endl;
+            code << indent << "CppAstRef " << rID << " = " << tmpss.str() << endl;
+            code << indent << "if (_ast.size(" << rID << ")==0) {" << endl;
             code << indent << "    break;" << endl;
             code << indent << "}" << endl;
         }
@@ -614,7 +697,7 @@ class GramGen
                 tmpss << "match(" << generateTokenName( token ) << ");"; 
             }
 
-            code << indent << "CppAstPtr " << rID << " = " << tmpss.str() << endl;
+            code << indent << "CppAstRef " << rID << " = " << tmpss.str() << endl;
         }
         else if (ruleTerm.type == RuleTerm::PLUS)
         {
@@ -638,29 +721,23 @@ class GramGen
             string ptrStr = rID;
             ptrStr += "_ptr";
 
-            string idxStr = "idx_";
-            idxStr += rID;
-
-            code << indent << "CompAst* " << ptrStr << " = new CompAst();" << endl;
-            code << indent << "int " << idxStr << " = 0;" << endl;
-            code << indent << "CppAstPtr firstPtr = " << tmpss.str() << endl;
+            code << indent << "CppAstBuilder " << ptrStr << "( _ast );" << endl;
+            code << indent << "CppAstRef firstPtr = " << tmpss.str() << endl;
             if (canBeEmpty == 0) {
-                code << indent << "if (firstPtr->size() == 0) {" << endl;
+                code << indent << "if (_ast.size(firstPtr) == 0) {" << endl;
                 code << indent << "    break;" << endl;
                 code << indent << "}" << endl;
             }
-            code << indent << ptrStr << "->astMap[to_string(" << idxStr << ")] = firstPtr;" << endl;
-            code << indent << idxStr << "++;" << endl;
+            code << indent << ptrStr << ".add( firstPtr );" << endl;
             code << indent << "while (true) {" << endl;
-            code << indent << "    CppAstPtr iterPtr = " << tmpss.str() << endl;
-            code << indent << "    if (iterPtr->size() == 0) {" << endl; 
+            code << indent << "    CppAstRef iterPtr = " << tmpss.str() << endl;
+            code << indent << "    if (_ast.size(iterPtr) == 0) {" << endl; 
             code << indent << "         break;" << endl; 
             code << indent << "    }" << endl; 
-            code << indent << "    " << ptrStr << "->astMap[to_string(" << idxStr << ")] = iterPtr;" << endl; 
-            code << indent << "    "<< idxStr << "++;" << endl; 
+            code << indent << "    " << ptrStr << ".add( iterPtr );" << endl; 
             code << indent << "    continue;" << endl; 
             code << indent << "}" << endl;
-            code << indent << "CppAstPtr "<< rID << "(" << ptrStr << ");" << endl;
+            code << indent << "CppAstRef "<< rID << " = " << ptrStr << ".finish();" << endl;
         }
         else if (ruleTerm.type == RuleTerm::STAR)
         {
@@ -679,21 +756,16 @@ class GramGen
             string ptrStr = rID;
             ptrStr += "_ptr";
 
-            string idxStr = "idx_";
-            idxStr += rID;
-
-            code << indent << "CompAst* " << ptrStr << " = new CompAst();" << endl;
-            code << indent << "int " << idxStr << " = 0;" << endl;
+            code << indent << "CppAstBuilder " << ptrStr << "( _ast );" << endl;
             code << indent << "while (true) {" << endl;
-            code << indent << "    CppAstPtr iterPtr = " << tmpss.str() << endl;
-            code << indent << "    if (iterPtr->size() == 0) {" << endl; 
+            code << indent << "    CppAstRef iterPtr = " << tmpss.str() << endl;
+            code << indent << "    if (_ast.size(iterPtr) == 0) {" << endl; 
             code << indent << "         break;" << endl; 
             code << indent << "    }" << endl; 
-            code << indent << "    " << ptrStr << "->astMap[to_string(" << idxStr << ")] = iterPtr;" << endl; 
-            code << indent << "    "<< idxStr << "++;" << endl; 
+            code << indent << "    " << ptrStr << ".add( iterPtr );" << endl; 
             code << indent << "    continue;" << endl; 
             code << indent << "}" << endl;
-            code << indent << "CppAstPtr "<< rID << "(" << ptrStr << ");" << endl;
+            code << indent << "CppAstRef "<< rID << " = " << ptrStr << ".finish();" << endl;
         }
 
         return code.str();
@@ -725,7 +797,7 @@ class GramGen
             sub_indent += "    ";
 
             // code << indent << "PtIt " << bakStr << " = _ptIt;" << endl; 
-            code << indent << "CompAst* " << ptrStr << " = new CompAst();"  << endl; 
+            code << indent << "CppAstBuilder " << ptrStr << "( _ast );"  << endl; 
             code << indent << "do {" << endl; 
             //code << indent << "for (int rich=0; rich<1 ; rich++) {" << endl; 
             for (unsigned i=0; i<ruleTerm.terms.size(); i++) 
@@ -740,7 +812,7 @@ class GramGen
 
             for (unsigned j=0; j<subIDs.size(); j++) 
             {
-                code << sub_indent << ptrStr << "->astMap[\"" << subIDs[j] << "\"] = " << subIDs[j] << ";" << endl;
+                code << sub_indent << ptrStr << ".add( " << subIDs[j] << " );" << endl;
             }
             // code << sub_indent <<  bakStr << " = _ptIt;" << endl;
             // code << sub_indent <<  "cout << \"BACKTO :\" <<  _ptIt->source << endl;" << endl;
@@ -748,7 +820,7 @@ class GramGen
             code << indent << "}" << endl; 
             code << indent << "while (false);" << endl; 
             // code << indent << "_ptIt = " << bakStr << ";" << endl;
-            code << indent << "CppAstPtr " << rID << "( " << ptrStr << " );" << endl;
+            code << indent << "CppAstRef " << rID << " = " << ptrStr << ".finish();" << endl;
 
         }
         else if (ruleTerm.type == RuleTerm::STAR)
@@ -768,7 +840,7 @@ class GramGen
             sub_indent += "    ";
 
             // code << indent << "PtIt " << bakStr << " = _ptIt;" << endl; 
-            code << indent << "CompAst* " << ptrStr << " = new CompAst();"  << endl; 
+            code << indent << "CppAstBuilder " << ptrStr << "( _ast );"  << endl; 
             code << indent << "while (true) {" << endl; 
             for (unsigned i=0; i<ruleTerm.terms.size(); i++) 
             {
@@ -782,13 +854,13 @@ class GramGen
 
             for (unsigned j=0; j<subIDs.size(); j++) 
             {
-                code << sub_indent << ptrStr << "->astMap[\"" << subIDs[j] << "\"] = " << subIDs[j] << ";" << endl;
+                code << sub_indent << ptrStr << ".add( " << subIDs[j] << " );" << endl;
             }
             // code << sub_indent <<  bakStr << " = _ptIt;" << endl; 
 
             code << indent << "}" << endl; 
             // code << indent << "_ptIt = " << bakStr << ";" << endl; 
-            code << indent <<  "cout << \"BACKTO :\" <<  _ptIt->source << endl;" << endl;
+            code << indent <<  "traceBackTo();" << endl;
 
             // if (ruleTerm.type == RuleTerm::PLUS)
             // {
@@ -796,7 +868,7 @@ class GramGen
             //     code << indent << "    break;"  << endl;
             //     code << indent << "}"  << endl;
             // }
-            code << indent << "CppAstPtr " << rID << "( " << ptrStr << " );" << endl;
+            code << indent << "CppAstRef " << rID << " = " << ptrStr << ".finish();" << endl;
         }
         else if (ruleTerm.type == RuleTerm::PLUS)
         {
@@ -815,7 +887,7 @@ class GramGen
             sub_indent += "    ";
 
             // code << indent << "PtIt " << bakStr << " = _ptIt;" << endl; 
-            code << indent << "CompAst* " << ptrStr << " = new CompAst();"  << endl; 
+            code << indent << "CppAstBuilder " << ptrStr << "( _ast );"  << endl; 
             code << indent << "while (true) {" << endl; 
             for (unsigned i=0; i<ruleTerm.terms.size(); i++) 
             {
@@ -829,21 +901,21 @@ class GramGen
 
             for (unsigned j=0; j<subIDs.size(); j++) 
             {
-                code << sub_indent << ptrStr << "->astMap[\"" << subIDs[j] << "\"] = " << subIDs[j] << ";" << endl;
+                code << sub_indent << ptrStr << ".add( " << subIDs[j] << " );" << endl;
             }
             // code << sub_indent <<  bakStr << " = _ptIt;" << endl; 
 
             code << indent << "}" << endl; 
             // code << indent << "_ptIt = " << bakStr << ";" << endl; 
-            code << indent <<  "cout << \"BACKTO :\" <<  _ptIt->source << endl;" << endl;
+            code << indent <<  "traceBackTo();" << endl;
 
             if (ruleTerm.type == RuleTerm::PLUS)
             {
-                code << indent << "if (" << ptrStr << "->size()==0) {"  << endl;
+                code << indent << "if (" << ptrStr << ".size()==0) {"  << endl;
                 code << indent << "    break;"  << endl;
                 code << indent << "}"  << endl;
             }
-            code << indent << "CppAstPtr " << rID << "( " << ptrStr << " );" << endl;
+            code << indent << "CppAstRef " << rID << " = " << ptrStr << ".finish();" << endl;
         }
 
 
@@ -851,6 +923,22 @@ class GramGen
     }
 
 
+    // `static const TokenSet first = ...` for a set of terminals, "$" left out
+    string generateCode_TokenSet(const string& name, set<string>& tokens, string indent)
+    {
+        stringstream ss;
+        ss << indent << "static const EPostTokenType " << name << "Types[] = {";
+        for (set<string>::iterator it=tokens.begin(); it!=tokens.end(); ++it)
+        {
+            if ( *it != "$" ) {
+                ss << " " << generateTokenName( *it ) << ",";
+            }
+        }
+        ss << " PT_WHITESPACE };" << endl;
+        ss << indent << "static const TokenSet " << name << " = tokenSet( " << name << "Types );" << endl;
+        return ss.str();
+    }
+
     string generateCode_First()
     {
         stringstream ss;
@@ -859,26 +947,10 @@ class GramGen
         {
             string nonTerminal = rules[i]->name;
             nonTerminal = replaceStr( nonTerminal, '-', '_');
-            ss << indent << "bool is_first_" << nonTerminal << " ( EPostTokenType type )" << endl;
+            ss << indent << "bool is_first_" << nonTerminal << " ()" << endl;
             ss << indent << "{" << endl;
-            ss << indent << indent << "if ("; 
-            for (set<string>::iterator it=rules[i]->firstTokens.begin() ; it!=rules[i]->firstTokens.end() ; ) 
-            {
-                if ( *it == "$" ) {
-                    ++it;
-                    continue;
-                }
-
-                ss << " matchType( " << generateTokenName( *it ) << ", type )";
-                ++it;
-                if (it != rules[i]->firstTokens.end()) {
-                    ss << " || ";
-                }
-            }
-            ss << ") {" << endl;
-            ss << indent << indent << indent << "return true;"<< endl;
-            ss << indent << indent << "}" << endl;
-            ss << indent << indent << "return false;"<< endl;
+            ss << generateCode_TokenSet( "first", rules[i]->firstTokens, indent + indent );
+            ss << indent << indent << "return matchSet( first );" << endl;
             ss << indent << "}" << endl;
             ss << endl;
         }
@@ -886,109 +958,538 @@ class GramGen
         return ss.str();
     }
 
-    string generateCode_FOLLOW()
+    // ids of the nonterminals, the keys of the packrat memo
+    string generateCode_RuleIds()
     {
         stringstream ss;
         string indent = "    ";
+        ss << indent << "enum RuleId {" << endl;
         for (unsigned i=0; i<rules.size(); i++)
         {
-            string nonTerminal = rules[i]->name;
-            nonTerminal = replaceStr( nonTerminal, '-', '_');
-            if (nonTerminal == "translation_unit") {
-                continue;
+            ss << indent << indent << "RULE_" << replaceStr( rules[i]->name, '-', '_') << "," << endl;
+        }
+        ss << indent << indent << "RULE_COUNT" << endl;
+        ss << indent << "};" << endl;
+        ss << endl;
+        return ss.str();
+    }
+
+    // the field of `term` in the view of a node, unique among `used`
+    string astFieldName(RuleTerm& term, unsigned k, set<string>& used)
+    {
+        string name;
+        if (term.terms.size() > 0) {
+            name = "group_" + to_string(k);
+        }
+        else if (isNonTerminal(term.name)) {
+            name = replaceStr(term.name, '-', '_');
+        }
+        else {
+            for (unsigned i=0; i<term.name.size(); i++) {
+                name += tolower(term.name[i]);
             }
-            ss << indent << "bool is_follow_" << nonTerminal << " ( EPostTokenType type )" << endl;
-            ss << indent << "{" << endl;
-            ss << indent << indent << "if ("; 
-            for (set<string>::iterator it=rules[i]->followTokens.begin() ; it!=rules[i]->followTokens.end() ; ) 
-            {
-                if ( *it == "$" ) {
-                    ++it;
-                    continue;
+        }
+        if (term.type == RuleTerm::STAR || term.type == RuleTerm::PLUS) {
+            name += "_list";
+        }
+        if (used.count(name)) {
+            name += "_" + to_string(k);
+        }
+        used.insert(name);
+        return name;
+    }
+
+    // `struct <name>` with a CppAstRef field per term
+    string generateCode_AstType(const string& name, const string& what, const string& ids, vector<RuleTerm>& terms)
+    {
+        stringstream ss, groups;
+        string indent = "    ";
+        set<string> used;
+
+        ss << indent << "// " << what << endl;
+        ss << indent << "struct " << name << " {" << endl;
+        ss << indent << indent << "enum { " << ids << "SLOTS = " << terms.size() << " };" << endl;
+        for (unsigned k=0; k<terms.size(); k++)
+        {
+            RuleTerm& term = terms[k];
+            string field = astFieldName(term, k, used);
+            string sub = name + "_" + to_string(k);
+
+            ss << indent << indent << "CppAstRef " << field << ";";
+            if (term.terms.size() > 0) {
+                if (term.type == RuleTerm::QUES) {
+                    ss << "  // " << sub << " or nothing";
                 }
-                ss << " matchType( " << generateTokenName( *it ) << ", type )";
-                ++it;
-                if (it != rules[i]->followTokens.end()) {
-                    ss << " || ";
+                else {
+                    ss << "  // " << sub << " per repetition";
                 }
+                groups << generateCode_AstType(sub, term.str() + " in " + name, "", term.terms);
+            }
+            else if (term.type == RuleTerm::QUES) {
+                ss << "  // or EMPTY_AST";
             }
-            ss << ") {" << endl;
-            ss << indent << indent << indent << "return true;"<< endl;
-            ss << indent << indent << "}" << endl;
-            ss << indent << indent << "return false;"<< endl;
-            ss << indent << "}" << endl;
             ss << endl;
         }
+        ss << indent << "};" << endl;
+        ss << endl;
+        return ss.str() + groups.str();
+    }
+
+    // Typed views of the AST, generated for both backends: a struct per
+    // rule alternative whose fields are the children of the nodes it makes
+    // (see CppAstArena::node), and one per parenthesized group, whose
+    // node holds a run of them
+    void generateAstTypes()
+    {
+        stringstream code;
+        code << "    // generated by gram_gen, the AST node of every rule alternative" << endl;
+        code << endl;
+        for (unsigned i=0; i<rules.size(); i++)
+        {
+            string nonTerminal = replaceStr( rules[i]->name, '-', '_');
+            for (unsigned j=0; j<rules[i]->derives.size(); j++)
+            {
+                vector<RuleTerm>& derive = rules[i]->derives[j];
+                string what = rules[i]->name + ":";
+                for (unsigned k=0; k<derive.size(); k++) {
+                    what += " " + derive[k].str();
+                }
+                stringstream ids;
+                ids << "RULE = RULE_" << nonTerminal << ", ALT = " << j << ", ";
+                code << generateCode_AstType("Ast_" + nonTerminal + "_" + to_string(j), what, ids.str(), derive);
+            }
+        }
 
+        ofstream myfile;
+        myfile.open("ast.cpp");
+        myfile << code.str();
+        myfile.close();
+    }
+
+    // FOLLOW of every rule in RuleId order, as PT_WHITESPACE terminated
+    // lists; the Recognizer synchronizes on them after an error
+    string generateCode_FOLLOW()
+    {
+        stringstream ss;
+        ss << "    static const EPostTokenType* followLists()" << endl;
+        ss << "    {" << endl;
+        ss << "        static const EPostTokenType lists[] = {" << endl;
+        for (unsigned i=0; i<rules.size(); i++)
+        {
+            ss << "            ";
+            for (set<string>::iterator it=rules[i]->followTokens.begin(); it!=rules[i]->followTokens.end(); ++it)
+            {
+                if ( *it != "$" ) {
+                    ss << generateTokenName( *it ) << ", ";
+                }
+            }
+            ss << "PT_WHITESPACE, // " << rules[i]->name << endl;
+        }
+        ss << "        };" << endl;
+        ss << "        return lists;" << endl;
+        ss << "    }" << endl << endl;
         return ss.str();
     }
 
 
+    // parse__X() and parse_body__X() for the rule X
+    string generateCode_Rule(Rule* rule)
+    {
+        stringstream code;
+        string nonTerminal = rule->name;
+        string indent1 = "    ";
+        string indent2 = "        ";
+        nonTerminal = replaceStr( nonTerminal, '-', '_'); 
+
+        // parse__X() checks FIRST and goes through the packrat memo,
+        // parse_body__X() does the actual (backtracking) work
+        code << indent1 << "CppAstRef parse__" << nonTerminal << " ()" << endl;
+        code << indent1 << "{" << endl;
+        code << indent1 << "    if ( !is_first_" << nonTerminal << "() ) {" << endl;
+        code << indent1 << "        return EMPTY_AST;" << endl;
+        code << indent1 << "    }" << endl;
+        code << indent1 << "    return memoize( RULE_" << nonTerminal << ", &Recognizer::parse_body__" << nonTerminal << " );" << endl;
+        code << indent1 << "}" << endl;
+        code << endl;
+        code << indent1 << "CppAstRef parse_body__" << nonTerminal << " ()" << endl;
+        code << indent1 << "{" << endl;
+        code << indent1 << "    Autocat ac( _trace, \"" << rule->name << "\" );" << endl;
+        code << indent1 << endl;
+        bool dispatch = rule->derives.size() > 1 && rule->derives.size() <= 64;
+        if (dispatch) {
+            code << generateCode_Dispatch(rule, indent2);
+        }
+        code << indent1 << "    PtIt bakPos = _ptIt;" << endl;
+
+        vector<unsigned> alts;
+        for (unsigned j=0; j<rule->derives.size() ; j++)
+        {
+            alts.push_back(j);
+        }
+        code << generateCode_Alts(rule, alts, 0, vector<string>(), "bakPos", dispatch, indent2);
+
+        code << indent1 << "    return EMPTY_AST;" << endl;
+        code << indent1 << "}" << endl;
+        code << endl << endl;
+        return code.str();
+    }
+
+    // The alternatives the current token can start: the FIRST set of every
+    // alternative, and whether it may match without a token (as the table
+    // backend counts it), go to Recognizer::dispatch(), which hands back a
+    // bit per alternative worth trying.
+    string generateCode_Dispatch(Rule* rule, string indent)
+    {
+        stringstream code;
+        string nonTerminal = replaceStr( rule->name, '-', '_');
+        unsigned nalts = rule->derives.size();
+
+        code << indent << "static const EPostTokenType altTypes[] = {" << endl;
+        for (unsigned j=0; j<nalts; j++)
+        {
+            set<string> first = firstNames(rule->derives[j]);
+            code << indent << "   ";
+            for (set<string>::iterator it=first.begin(); it!=first.end(); ++it) {
+                if (*it != "$") {
+                    code << " " << generateTokenName(*it) << ",";
+                }
+            }
+            code << " PT_WHITESPACE," << endl;
+        }
+        code << indent << "};" << endl;
+        code << indent << "static const bool altEmpty[] = {";
+        for (unsigned j=0; j<nalts; j++)
+        {
+            bool empty = true;
+            for (unsigned k=0; k<rule->derives[j].size(); k++) {
+                empty = empty && tableEmpty(rule->derives[j][k]);
+            }
+            code << " " << (empty ? "true" : "false") << (j+1 < nalts ? "," : "");
+        }
+        code << " };" << endl;
+        code << indent << "static const vector<TokenSet> altFirst = tokenSets( altTypes, " << nalts << " );" << endl;
+        code << indent << "uint64_t alts = dispatch( RULE_" << nonTerminal << ", altFirst, altEmpty );" << endl;
+        code << endl;
+        return code.str();
+    }
+
+    // whether the parse of `term` changes the open template argument
+    // lists, which backtracking to a shared prefix would not undo
+    bool touchesAngles(RuleTerm& term)
+    {
+        if (term.name == "ST_LT" || term.name == "ST_GT") {
+            return true;
+        }
+        for (unsigned i=0; i<term.terms.size(); i++) {
+            if (touchesAngles(term.terms[i])) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // whether the alternatives `a` and `b` can share their term `k`
+    bool sameTerm(Rule* rule, unsigned a, unsigned b, unsigned k)
+    {
+        vector<RuleTerm>& da = rule->derives[a];
+        vector<RuleTerm>& db = rule->derives[b];
+        return k < da.size() && k < db.size() && da[k].str() == db[k].str() && !touchesAngles(da[k]);
+    }
+
+    // Left factoring: `alts`, in grammar order, have the terms before
+    // `start` in common, already parsed into `ids`.  A run of neighbouring
+    // alternatives that go on alike parses their common terms once and
+    // then tries the rest of each from there; on failure the position goes
+    // back to `backPos`.  Every alternative still makes its own node.
+    // With `dispatch` only the alternatives in `alts` (generateCode_Dispatch)
+    // are tried.
+    string generateCode_Alts(Rule* rule, const vector<unsigned>& alts, unsigned start,
+                             const vector<string>& ids, const string& backPos, bool dispatch, string indent)
+    {
+        stringstream code;
+        string nonTerminal = replaceStr( rule->name, '-', '_');
+
+        unsigned a = 0;
+        while (a < alts.size())
+        {
+            unsigned j = alts[a];
+            vector<RuleTerm>& derive = rule->derives[j];
+            vector<string> termIds = ids;
+
+            unsigned e = a + 1;
+            while (e < alts.size() && sameTerm(rule, j, alts[e], start)) {
+                e++;
+            }
+            unsigned end = derive.size();
+            if (e - a > 1) {
+                end = start + 1;
+                bool same = true;
+                while (same) {
+                    for (unsigned b=a+1; b<e && same; b++) {
+                        same = sameTerm(rule, j, alts[b], end);
+                    }
+                    if (same) {
+                        end++;
+                    }
+                }
+                if (start == 0) {
+                    factoredAlts += e - a;
+                    factoredGroups++;
+                }
+                factoredTerms += (e - a - 1) * (end - start);
+            }
+
+            string outer = indent;
+            if (dispatch) {
+                unsigned long long mask = 0;
+                for (unsigned b=a; b<e; b++) {
+                    mask |= 1ull << alts[b];
+                }
+                code << indent << "if (alts & 0x" << hex << mask << dec << "ull) {" << endl;
+                indent += "    ";
+            }
+            string inner = indent + "    ";
 
+            code << indent << "do {" << endl;
+            for (unsigned k=start; k<end; k++)
+            {
+                stringstream tID;
+                tID << "t_" << j << "_" << k;
+                code << generateCodeTerm(tID.str(), derive[k], inner) << endl;
+                termIds.push_back( tID.str() );
+            }
+            if (e - a > 1)
+            {
+                stringstream forkPos;
+                forkPos << "forkPos_" << j << "_" << end;
+                code << inner << "PtIt " << forkPos.str() << " = _ptIt;" << endl;
+                vector<unsigned> run(alts.begin() + a, alts.begin() + e);
+                code << generateCode_Alts(rule, run, end, termIds, forkPos.str(), dispatch, inner);
+            }
+            else if (derive.size() > 0)
+            {
+                // all terms are done, prepare to return value
+                code << inner << "CppAstBuilder ret( _ast );" << endl;
+                for (vector<string>::iterator idIt = termIds.begin(); idIt != termIds.end(); idIt++)
+                {
+                    code << inner << "ret.add( " << *idIt << " );" << endl;
+                }
+                code << inner << "return ret.finish( RULE_" << nonTerminal << ", " << j << " );" << endl;
+            }
+            code << indent << "}" << endl;
+            code << indent << "while (false);" << endl;
+            code << indent << "_ptIt = " << backPos << ";" << endl;
+            code << indent << "traceBackTo();" << endl;
+            if (dispatch) {
+                indent = outer;
+                code << indent << "}" << endl;
+            }
+            a = e;
+        }
+        return code.str();
+    }
 
     void generateCode() 
     {
         stringstream code; 
 
+        factoredAlts = factoredGroups = factoredTerms = 0;
+        stringstream rulesCode;
+        for (unsigned i=0 ; i<rules.size(); i++) 
+        {
+            rulesCode << generateCode_Rule(rules[i]);
+        }
+
+        code << "    // generated by gram_gen; " << factoredAlts << " alternatives in " << factoredGroups
+             << " groups start alike and parse" << endl;
+        code << "    // their common terms once, " << factoredTerms << " terms in all" << endl;
+        code << endl;
+        cout << "left factoring: " << factoredAlts << " alternatives in " << factoredGroups << " groups, "
+             << factoredTerms << " terms shared" << endl;
+        code << generateCode_RuleIds();
         code << generateCode_First();
-        // code << generateCode_FOLLOW();
+        code << generateCode_FOLLOW();
 
-        for (unsigned i=0 ; i<rules.size(); i++) 
+        code << rulesCode.str();
+
+        ofstream myfile;
+        myfile.open("code.cpp");
+        myfile << code.str();
+        myfile.close();
+    }
+
+    // Table backend: the grammar as data for the engine in tableparse.cpp.
+    // Rules, alternatives and terms become rows of static arrays, and every
+    // rule and alternative gets its FIRST set, so that the engine only
+    // tries the alternatives that can start with the current token and
+    // backtracks only where several can (the LL(1) conflicts counted below).
+
+    // the FIRST sets, deduplicated; returns the index of `first`
+    int tableSet(set<string> first, vector< set<string> >& sets)
+    {
+        first.erase("$");
+        for (unsigned i=0; i<sets.size(); i++) {
+            if (sets[i] == first) {
+                return i;
+            }
+        }
+        sets.push_back(first);
+        return sets.size() - 1;
+    }
+
+    // can the generated code accept this term without consuming a token;
+    // a repeated group may, so it counts as empty
+    bool tableEmpty(RuleTerm& term)
+    {
+        if (term.type == RuleTerm::QUES || term.type == RuleTerm::STAR || term.terms.size() > 0) {
+            return true;
+        }
+        if (isNonTerminal(term.name)) {
+            return nonTerminalMap.find(term.name)->second->canBeEmpty != 0;
+        }
+        return false;
+    }
+
+    string tableTermRow(RuleTerm& term, int group)
+    {
+        static const char* repeats[] = { "TABLE_ONCE", "TABLE_PLUS", "TABLE_QUES", "TABLE_STAR" };
+        stringstream ss;
+        ss << "{ ";
+        if (group >= 0) {
+            ss << "TABLE_GROUP, " << repeats[term.type] << ", " << group << ", " << term.terms.size();
+        }
+        else if (isNonTerminal(term.name)) {
+            ss << "TABLE_RULE, " << repeats[term.type] << ", RULE_" << replaceStr(term.name, '-', '_') << ", 0";
+        }
+        else {
+            ss << "TABLE_TOKEN, " << repeats[term.type] << ", " << generateTokenName(term.name) << ", 0";
+        }
+        ss << " },";
+        return ss.str();
+    }
+
+    void generateTables()
+    {
+        vector< set<string> > sets;
+        stringstream ruleRows, altRows, termRows, groupRows;
+        int nalts = 0;
+        int nterms = 0;
+        int ngroupTerms = 0;
+        int conflicts = 0;
+        string indent = "            ";
+
+        for (unsigned i=0; i<rules.size(); i++)
         {
-            string nonTerminal = rules[i]->name;
-            string indent1 = "    ";
-            string indent2 = "        ";
-            string indent3 = "            ";
-            nonTerminal = replaceStr( nonTerminal, '-', '_'); 
-
-            code << indent1 << "CppAstPtr parse__" << nonTerminal << " ()" << endl;
-            code << indent1 << "{" << endl;
-            code << indent1 << "    if ( !is_first_" << nonTerminal << "(_ptIt->type) ) {" << endl;
-            code << indent1 << "        return CppAstPtr( new EmptyAst() );" << endl;
-            code << indent1 << "    }" << endl;
-            code << indent1 << "    Autocat ac( \"" << rules[i]->name << "\" );" << endl;
-            code << indent1 << endl;
-            code << indent1 << "    PtIt bakPos = _ptIt;" << endl;
-
-            for (unsigned j=0; j<rules[i]->derives.size() ; j++)
+            Rule* rule = rules[i];
+            ruleRows << indent << "{ \"" << rule->name << "\", " << nalts << ", " << rule->derives.size() << ", "
+                     << tableSet(rule->firstTokens, sets) << ", " << (rule->canBeEmpty != 0) << " },"
+                     << " // RULE_" << replaceStr(rule->name, '-', '_') << endl;
+
+            map<string, int> starts;
+            for (unsigned j=0; j<rule->derives.size(); j++)
             {
-                vector<string> termIds;
-                vector<RuleTerm> derive = rules[i]->derives[j]; 
+                vector<RuleTerm>& derive = rule->derives[j];
+                bool empty = true;
+                for (unsigned k=0; k<derive.size(); k++) {
+                    empty = empty && tableEmpty(derive[k]);
+                }
+                set<string> first = firstNames(derive);
+                for (set<string>::iterator sit=first.begin(); sit!=first.end(); ++sit) {
+                    if (*sit != "$" && ++starts[*sit] == 2) {
+                        conflicts++;
+                    }
+                }
+                altRows << indent << "{ " << nterms << ", " << derive.size() << ", " << tableSet(first, sets) << ", " << empty << " },"
+                        << " // " << rule->name << " " << j << endl;
+                nalts++;
 
-                code << indent1 << "    do {" << endl;
-                // code << indent1 << "    for (int rich=0; rich<1; rich++) {" << endl;
-                for (unsigned k=0; k<derive.size(); k++)  
+                for (unsigned k=0; k<derive.size(); k++)
                 {
-                    stringstream tID;  
-                    tID << "t_" << j << "_" << k; 
-                    code << generateCodeTerm(tID.str(), derive[k], indent3) << endl;
-                    termIds.push_back( tID.str() );
-
-                    // when the last term is done, prepare to return value
-                    //
-                    if (k==derive.size()-1) 
-                    {
-                        code << indent3 << "CompAst* ret = new CompAst();" << endl;;
-                        for (vector<string>::iterator idIt = termIds.begin(); idIt != termIds.end(); idIt++)
-                        {
-                            code << indent3 << "ret->astMap[\"" << *idIt << "\"] = " << *idIt << ";" << endl;
+                    stringstream tID;
+                    tID << "t_" << j << "_" << k;
+                    RuleTerm& term = derive[k];
+                    if (term.terms.size() == 0) {
+                        termRows << indent << tableTermRow(term, -1) << endl;
+                    }
+                    else {
+                        if (term.terms.size() > 8) {
+                            cout << "error!! more than 8 terms in a group of " << rule->name << endl;
+                            exit(1);
+                        }
+                        termRows << indent << tableTermRow(term, ngroupTerms) << endl;
+                        for (unsigned g=0; g<term.terms.size(); g++) {
+                            stringstream subID;
+                            subID << tID.str() << g;
+                            groupRows << indent << tableTermRow(term.terms[g], -1) << endl;
+                            ngroupTerms++;
                         }
-                        code << indent3 << "return CppAstPtr( ret );" << endl;;
                     }
+                    nterms++;
                 }
-                code << indent1 << "    }" << endl; 
-                code << indent1 << "    while (false);" << endl;
-                code << indent1 << "    _ptIt = bakPos;" << endl;
-                code << indent1 << "    cout << \"BACKTO :\" <<  _ptIt->source << endl;" << endl;
             }
+        }
 
-            code << indent1 << "    return CppAstPtr( new EmptyAst() );" << endl;
-            code << indent1 << "}" << endl;
-            code << endl << endl;
+        stringstream code;
+        code << "    // generated by gram_gen -table, the grammar for tableparse.cpp" << endl;
+        code << "    // " << rules.size() << " rules, " << nalts << " alternatives; " << conflicts
+             << " (rule, terminal) pairs start more than one alternative" << endl;
+        code << endl;
+        code << generateCode_RuleIds();
+
+        code << "    static const TableRule* tableRules()" << endl;
+        code << "    {" << endl;
+        code << "        static const TableRule rules[] = {" << endl;
+        code << ruleRows.str();
+        code << "        };" << endl;
+        code << "        return rules;" << endl;
+        code << "    }" << endl << endl;
+
+        code << "    static const TableAlt* tableAlts()" << endl;
+        code << "    {" << endl;
+        code << "        static const TableAlt alts[] = {" << endl;
+        code << altRows.str();
+        code << "        };" << endl;
+        code << "        return alts;" << endl;
+        code << "    }" << endl << endl;
+
+        code << "    static const TableTerm* tableTerms()" << endl;
+        code << "    {" << endl;
+        code << "        static const TableTerm terms[] = {" << endl;
+        code << termRows.str();
+        code << "        };" << endl;
+        code << "        return terms;" << endl;
+        code << "    }" << endl << endl;
+
+        code << "    static const TableTerm* tableGroupTerms()" << endl;
+        code << "    {" << endl;
+        code << "        static const TableTerm terms[] = {" << endl;
+        code << groupRows.str();
+        code << "        };" << endl;
+        code << "        return terms;" << endl;
+        code << "    }" << endl << endl;
+
+        // the sets as PT_WHITESPACE terminated lists, the engine turns them
+        // into bitsets once
+        code << "    static const EPostTokenType* tableSetLists()" << endl;
+        code << "    {" << endl;
+        code << "        static const EPostTokenType lists[] = {" << endl;
+        for (unsigned i=0; i<sets.size(); i++) {
+            code << indent;
+            for (set<string>::iterator sit=sets[i].begin(); sit!=sets[i].end(); ++sit) {
+                code << generateTokenName(*sit) << ", ";
+            }
+            code << "PT_WHITESPACE, // " << i << endl;
         }
+        code << "        };" << endl;
+        code << "        return lists;" << endl;
+        code << "    }" << endl << endl;
+
+        code << "    static const int TABLE_SETS = " << sets.size() << ";" << endl;
+        code << endl;
+        code << generateCode_FOLLOW();
 
         ofstream myfile;
-        myfile.open("code.cpp");
+        myfile.open("table.cpp");
         myfile << code.str();
         myfile.close();
     }
@@ -1015,15 +1516,29 @@ class GramGen
     
     
 
+    bool                      tableBackend;
     map<string, Rule*>        nonTerminalMap;         
     vector<string>            tokens;
     vector<string>::iterator  mit;
     vector<Rule*>             rules;
+
+    // grammar analysis, by rule and terminal id
+    map<string, unsigned>     ruleIds;
+    vector<string>            terminalNames;
+    map<string, unsigned>     terminalIds;
+    vector<bool>              ruleNullable;
+    vector<TerminalSet>       ruleFirst;
+    vector<TerminalSet>       ruleFollow;
+
+    // left factoring done by generateCode()
+    unsigned                  factoredAlts;
+    unsigned                  factoredGroups;
+    unsigned                  factoredTerms;
 };
 
 
 
-void process(string& gramTxt) {
+void process(string& gramTxt, bool tableBackend) {
     vector<string> tokens;
 
     string t = "";
@@ -1057,6 +1572,7 @@ void process(string& gramTxt) {
 
 
     GramGen gramgen;
+    gramgen.tableBackend = tableBackend;
     gramgen.parse( tokens );
     gramgen.dump();    
 
@@ -1069,18 +1585,21 @@ void process(string& gramTxt) {
 
 int main(int argc, char** args) {
     
+    // gram_gen [-table] <grammar>: writes code.cpp, or table.cpp with -table,
+    // and ast.cpp
+    bool tableBackend = (argc > 2 && string(args[1]) == "-table");
     if (argc < 2) {
         cout << "Usage: Input the grammar file." << endl;
     }
 
     fstream fs; 
-    fs.open(args[1], fstream::in);
+    fs.open(args[tableBackend ? 2 : 1], fstream::in);
     stringstream ss;
     ss << fs.rdbuf();
     string gramTxt = ss.str(); 
     fs.close();
 
-    process( gramTxt );
+    process( gramTxt, tableBackend );
 
     return 0;
 }
@@ -6,6 +6,12 @@
 
 #include <list>
 #include <string>
+#include <map>
+#include <set>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
 #include "utf8.cpp"
 #include "utf16.cpp"
 #include "pptoken.cpp"
@@ -138,6 +144,294 @@ const map<string, MacroPPTokenType> string2macroPPTokenTypeMap =
 };
 
 
+// the definition of a macro as a string, the same for the same definition
+// in any translation unit; "" if `dir` is 0, for a name not defined
+string MacroFingerprint(const Directive* dir)
+{
+    if (dir == 0)
+    {
+        return string();
+    }
+    ostringstream oss;
+    oss << (dir->type == Directive::FUN ? 'F' : 'O') << dir->paraNum;
+    for (unsigned i=0; i<dir->paramLst.size(); i++)
+    {
+        oss << ' ' << dir->paramLst[i].size() << ':' << dir->paramLst[i];
+    }
+    oss << " =";
+    for (unsigned i=0; i<dir->replaceLst.size(); i++)
+    {
+        const PPToken& p = dir->replaceLst[i];
+        oss << ' ' << p.type << ':' << p.utf8str.size() << ':' << p.utf8str
+            << p.srcfile.size() << ':' << p.srcfile << p.fileid.first << ',' << p.fileid.second;
+    }
+    return oss.str();
+}
+
+
+// HeaderEnv: what preprocessing an included header read of the state it
+// started in (the macros, the #pragma once files included before and the
+// names of the files), and which of it it changed.  Once the header
+// changed a part, reading it does not depend on the state before and is
+// not recorded.
+struct HeaderEnv
+{
+    map<string, string>     macros;         // MacroFingerprint of the definition read
+    map<PA5FileId, bool>    once;           // included before
+    map<PA5FileId, string>  fileNames;      // "" if none
+    set<string>             macrosSet;
+    set<PA5FileId>          onceSet;
+    set<PA5FileId>          fileNamesSet;
+
+    void readMacro(const string& name, const Directive* dir)
+    {
+        if (macrosSet.count(name) == 0 && macros.count(name) == 0)
+        {
+            macros[name] = MacroFingerprint(dir);
+        }
+    }
+
+    void readOnce(const PA5FileId& fileid, bool included)
+    {
+        if (onceSet.count(fileid) == 0 && once.count(fileid) == 0)
+        {
+            once[fileid] = included;
+        }
+    }
+
+    void readFileName(const PA5FileId& fileid, const string& name)
+    {
+        if (fileNamesSet.count(fileid) == 0 && fileNames.count(fileid) == 0)
+        {
+            fileNames[fileid] = name;
+        }
+    }
+
+    // the reads and changes of `inner`, a header included at this point
+    void merge(const HeaderEnv& inner)
+    {
+        for (map<string, string>::const_iterator it = inner.macros.begin(); it != inner.macros.end(); it++)
+        {
+            if (macrosSet.count(it->first) == 0)
+            {
+                macros.insert(*it);
+            }
+        }
+        for (map<PA5FileId, bool>::const_iterator it = inner.once.begin(); it != inner.once.end(); it++)
+        {
+            if (onceSet.count(it->first) == 0)
+            {
+                once.insert(*it);
+            }
+        }
+        for (map<PA5FileId, string>::const_iterator it = inner.fileNames.begin(); it != inner.fileNames.end(); it++)
+        {
+            if (fileNamesSet.count(it->first) == 0)
+            {
+                fileNames.insert(*it);
+            }
+        }
+        macrosSet.insert(inner.macrosSet.begin(), inner.macrosSet.end());
+        onceSet.insert(inner.onceSet.begin(), inner.onceSet.end());
+        fileNamesSet.insert(inner.fileNamesSet.begin(), inner.fileNamesSet.end());
+    }
+};
+
+
+// HeaderCache: the included headers preprocessed for a batch of
+// translation units.  A header gives the same lines and changes the state
+// the same way whenever its file and the state it reads are the same, so
+// a translation unit that includes it where another one did, under the
+// same definitions of the macros it tests or expands, takes the lines and
+// changes from here.  The lines are still rescanned by the includer, as
+// without the cache.  Entries are found by the path and a hash of the
+// content of the file, one for each state read, and keep the content
+// itself, so a hash collision is no hit; find() and add() may be called
+// from several threads at once.
+class HeaderCache
+{
+  public:
+    struct Entry
+    {
+        string                                   content;    // of the file
+        HeaderEnv                                env;
+        map<string, shared_ptr<Directive> >     macros;     // the changed ones after the header, null if undefined
+        map<PA5FileId, string>                   fileNames;  // the changed ones
+        list<MacroPPToken>                       lines;      // the tokens without their blackLst
+        vector< pair<size_t, string> >           painted;    // (token, macro) of the blackLsts
+        bool                                     pragmaOnce;
+    };
+
+    HeaderCache()
+        : _hits(0), _misses(0)
+    {
+    }
+
+    // an entry for `content` of the file at `path`, made in the state
+    // given; null if none
+    shared_ptr<const Entry> find(const string& path, const string& content, const map<string, Directive*>& macros,
+                                 const set<PA5FileId>& included, const map<PA5FileId, string>& fileNames)
+    {
+        vector< shared_ptr<const Entry> > candidates;
+        {
+            lock_guard<mutex> lock(_lock);
+            unordered_map<string, vector< shared_ptr<const Entry> > >::iterator it = _entries.find(key(path, content));
+            if (it != _entries.end())
+            {
+                candidates = it->second;
+            }
+        }
+        for (unsigned i=0; i<candidates.size(); i++)
+        {
+            if (candidates[i]->content == content && matches(*candidates[i], macros, included, fileNames))
+            {
+                _hits++;
+                return candidates[i];
+            }
+        }
+        _misses++;
+        return shared_ptr<const Entry>();
+    }
+
+    // what preprocessing `content` at `path` read and did; `macros` and
+    // `fileNames` as they are after it
+    void add(const string& path, const string& content, const HeaderEnv& env, const map<string, Directive*>& macros,
+             const map<PA5FileId, string>& fileNames, const list<MacroPPToken>& lines, bool pragmaOnce)
+    {
+        shared_ptr<Entry> entry(new Entry);
+        entry->content = content;
+        entry->env = env;
+        for (set<string>::const_iterator it = env.macrosSet.begin(); it != env.macrosSet.end(); it++)
+        {
+            map<string, Directive*>::const_iterator mit = macros.find(*it);
+            entry->macros[*it] = (mit == macros.end()) ? shared_ptr<Directive>() : make_shared<Directive>(*mit->second);
+        }
+        for (set<PA5FileId>::const_iterator it = env.fileNamesSet.begin(); it != env.fileNamesSet.end(); it++)
+        {
+            entry->fileNames[*it] = fileNames.find(*it)->second;
+        }
+        entry->lines = lines;
+        entry->pragmaOnce = pragmaOnce;
+
+        // a blackLst only applies while its macro stays defined as it is
+        // now; such are kept by name, the others never apply again
+        map<const Directive*, string> names;
+        for (map<string, Directive*>::const_iterator it = macros.begin(); it != macros.end(); it++)
+        {
+            names[it->second] = it->first;
+        }
+        size_t n = 0;
+        for (list<MacroPPToken>::iterator lit = entry->lines.begin(); lit != entry->lines.end(); lit++)
+        {
+            for (list<PPToken>::iterator pit = lit->pplst.begin(); pit != lit->pplst.end(); pit++, n++)
+            {
+                for (set<Directive*>::iterator sit = pit->blackLst.begin(); sit != pit->blackLst.end(); sit++)
+                {
+                    map<const Directive*, string>::iterator nit = names.find(*sit);
+                    if (nit != names.end())
+                    {
+                        entry->painted.push_back(make_pair(n, nit->second));
+                    }
+                }
+                pit->blackLst.clear();
+            }
+        }
+
+        lock_guard<mutex> lock(_lock);
+        _entries[key(path, content)].push_back(entry);
+    }
+
+    // make the changes of `entry` to the state given, and give its lines
+    static void apply(const Entry& entry, map<string, Directive*>& macros, set<PA5FileId>& included,
+                      map<PA5FileId, string>& fileNames, list<MacroPPToken>& lines)
+    {
+        for (map<string, shared_ptr<Directive> >::const_iterator it = entry.macros.begin(); it != entry.macros.end(); it++)
+        {
+            if (it->second)
+            {
+                macros[it->first] = new Directive(*it->second);
+            }
+            else
+            {
+                macros.erase(it->first);
+            }
+        }
+        included.insert(entry.env.onceSet.begin(), entry.env.onceSet.end());
+        for (map<PA5FileId, string>::const_iterator it = entry.fileNames.begin(); it != entry.fileNames.end(); it++)
+        {
+            fileNames[it->first] = it->second;
+        }
+
+        lines = entry.lines;
+        size_t n = 0;
+        vector< pair<size_t, string> >::const_iterator pt = entry.painted.begin();
+        for (list<MacroPPToken>::iterator lit = lines.begin(); lit != lines.end() && pt != entry.painted.end(); lit++)
+        {
+            for (list<PPToken>::iterator pit = lit->pplst.begin(); pit != lit->pplst.end(); pit++, n++)
+            {
+                for ( ; pt != entry.painted.end() && pt->first == n; pt++)
+                {
+                    pit->blackLst.insert(macros.find(pt->second)->second);
+                }
+            }
+        }
+    }
+
+    // headers found, and preprocessed as not found
+    unsigned long hits() const
+    {
+        return _hits;
+    }
+
+    unsigned long misses() const
+    {
+        return _misses;
+    }
+
+  private:
+    static bool matches(const Entry& entry, const map<string, Directive*>& macros,
+                        const set<PA5FileId>& included, const map<PA5FileId, string>& fileNames)
+    {
+        const HeaderEnv& env = entry.env;
+        for (map<string, string>::const_iterator it = env.macros.begin(); it != env.macros.end(); it++)
+        {
+            map<string, Directive*>::const_iterator mit = macros.find(it->first);
+            if (MacroFingerprint(mit == macros.end() ? 0 : mit->second) != it->second)
+            {
+                return false;
+            }
+        }
+        for (map<PA5FileId, bool>::const_iterator it = env.once.begin(); it != env.once.end(); it++)
+        {
+            if ((included.count(it->first) != 0) != it->second)
+            {
+                return false;
+            }
+        }
+        for (map<PA5FileId, string>::const_iterator it = env.fileNames.begin(); it != env.fileNames.end(); it++)
+        {
+            map<PA5FileId, string>::const_iterator fit = fileNames.find(it->first);
+            if ((fit == fileNames.end() ? string() : fit->second) != it->second)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static string key(const string& path, const string& content)
+    {
+        return path + '\0' + to_string((unsigned long long) content.size()) + ':' +
+               to_string((unsigned long long) hash<string>()(content));
+    }
+
+    mutex                                                       _lock;
+    unordered_map<string, vector< shared_ptr<const Entry> > >   _entries;
+    atomic<unsigned long>                                       _hits;
+    atomic<unsigned long>                                       _misses;
+};
+
+
 class DirectiveHandler {
 
   public:
@@ -146,6 +440,7 @@ class DirectiveHandler {
         initialize_default_directive();
         _pragmaOnce = false;
         _baseLineNo = 0;
+        _headerCache = 0;
         _srcfile += srcfile;
         _pps = pps;
     }
@@ -555,7 +850,7 @@ class DirectiveHandler {
            
             if (ppit->type == PP_IDENTIFIER) 
             {
-                map<string, Directive*>::iterator dit = _directiveLst.find( ppit->utf8str );
+                map<string, Directive*>::iterator dit = findMacro( ppit->utf8str );
 
                 if (dit != _directiveLst.end() &&
                     ppit->blackLst.find( dit->second ) == ppit->blackLst.end())
@@ -802,7 +1097,7 @@ class DirectiveHandler {
                                 // tokens.insert(tokens.begin(), makePPToken(_srcfile));
                                 string s = "\"";
                                 // s += po.srcfile;
-                                s += _fileidMap.find( po.fileid )->second; 
+                                s += findFileName( po.fileid )->second; 
                                 s += "\"";
                                 tokens.insert(tokens.begin(), makePPToken(s));
                             }
@@ -1072,6 +1367,10 @@ class DirectiveHandler {
         }
 
         _directiveLst[ dir->name ] = dir;
+        if (_env)
+        {
+            _env->macrosSet.insert( dir->name );
+        }
         return true;
     }
 
@@ -1154,7 +1453,7 @@ class DirectiveHandler {
 
         // 4. check redefine
         //  
-        map<string, Directive*>::iterator dit = _directiveLst.find( dir->name ); 
+        map<string, Directive*>::iterator dit = findMacro( dir->name ); 
         if (dit != _directiveLst.end())
         {
             Directive* dir0 = dit->second;
@@ -1284,6 +1583,10 @@ class DirectiveHandler {
                                 delete mit->second;
                                 _directiveLst.erase( mit );
                             }
+                            if (_env)
+                            {
+                                _env->macrosSet.insert( ppit->utf8str );
+                            }
                         }
                         else
                         {
@@ -1311,6 +1614,15 @@ class DirectiveHandler {
         {
             list<PPToken> newLst = replaceText( mt.pplst );
             vec.insert(vec.end(), newLst.begin(), newLst.end());
+
+            // the evaluator tests the identifiers left for `defined`
+            for (unsigned i=0; _env && i<vec.size(); i++)
+            {
+                if (vec[i].type == PP_IDENTIFIER)
+                {
+                    findMacro( vec[i].utf8str );
+                }
+            }
         }
         else
         {
@@ -1332,7 +1644,7 @@ class DirectiveHandler {
                 throw DirectiveHandlerException("Bad IFDEF directive expr");
             }
 
-            map<string, Directive*>::iterator dit = _directiveLst.find( postTokenizer._tokens[0].source );
+            map<string, Directive*>::iterator dit = findMacro( postTokenizer._tokens[0].source );
             if (dit == _directiveLst.end())
             {
                 return false; 
@@ -1349,7 +1661,7 @@ class DirectiveHandler {
                 throw DirectiveHandlerException("Bad IFDEF directive expr");
             }
 
-            map<string, Directive*>::iterator dit = _directiveLst.find( postTokenizer._tokens[0].source );
+            map<string, Directive*>::iterator dit = findMacro( postTokenizer._tokens[0].source );
             if (dit == _directiveLst.end())
             {
                 return true; 
@@ -1534,17 +1846,55 @@ class DirectiveHandler {
         _srcfile = ppFileName.utf8str; 
         _srcfile = _srcfile.substr(1, _srcfile.size()-2);
 
-        map<PA5FileId,string>::iterator mit = _fileidMap.find(ppFileName.fileid);
+        map<PA5FileId,string>::iterator mit = findFileName(ppFileName.fileid);
         if (mit != _fileidMap.end())
         {
             _fileidMap.erase( mit );
             _fileidMap.insert( pair<PA5FileId,string>(ppFileName.fileid, _srcfile) );
+            if (_env)
+            {
+                _env->fileNamesSet.insert( ppFileName.fileid );
+            }
         }
 
         return;
     }
 
 
+    //-----
+    // lookups of the state an included header reads, recorded in _env
+    //
+    map<string, Directive*>::iterator findMacro( const string& name )
+    {
+        map<string, Directive*>::iterator dit = _directiveLst.find( name );
+        if (_env)
+        {
+            _env->readMacro( name, dit == _directiveLst.end() ? 0 : dit->second );
+        }
+        return dit;
+    }
+
+    map<PA5FileId, string>::iterator findFileName( const PA5FileId& fileid )
+    {
+        map<PA5FileId, string>::iterator mit = _fileidMap.find( fileid );
+        if (_env)
+        {
+            _env->readFileName( fileid, mit == _fileidMap.end() ? string() : mit->second );
+        }
+        return mit;
+    }
+
+    bool includedOnce( const PA5FileId& fileid )
+    {
+        bool included = _includeSet.find( fileid ) != _includeSet.end();
+        if (_env)
+        {
+            _env->readOnce( fileid, included );
+        }
+        return included;
+    }
+
+
     void processDirectiveInclude( list<MacroPPToken> &macroTokens, list<MacroPPToken>::iterator& it )
     {
         //-----
@@ -1608,58 +1958,104 @@ class DirectiveHandler {
         }  
 
         //-----
-        //  parse included file to pptokens 
+        //  read the included file; if it was preprocessed in the state it
+        //  reads before, its lines and changes come from the header cache
         //
         ifstream in(nextf);
         ostringstream oss;
         oss << in.rdbuf();
         string input = oss.str();
-    
-        vector<int> uncTokens;
-        int code_unit;
-        UTF8Decoder utf8Decoder(&input);
-        while ((code_unit = utf8Decoder.nextCode()) > 0)
+
+        if (findFileName(fileid) == _fileidMap.end())
         {
-            uncTokens.push_back(code_unit);
+            _fileidMap.insert(pair<PA5FileId,string>(fileid, nextf));
+            if (_env)
+            {
+                _env->fileNamesSet.insert(fileid);
+            }
         }
-        if (uncTokens.size()>0 && uncTokens[uncTokens.size()-1]!='\n')
+
+        list<MacroPPToken> lines;
+        bool pragmaOnce;
+        shared_ptr<const HeaderCache::Entry> cached;
+        if (_headerCache)
         {
-            uncTokens.push_back('\n');
+            cached = _headerCache->find(nextf, input, _directiveLst, _includeSet, _fileidMap);
         }
-        PPTokenizer ppTokenizer;
-        ppTokenizer._lineNo = 1;
-        ppTokenizer._srcfile = nextf;
-        ppTokenizer._fileid = fileid; 
-        ppTokenizer.parse(uncTokens);
+        if (cached)
+        {
+            HeaderCache::apply(*cached, _directiveLst, _includeSet, _fileidMap, lines);
+            pragmaOnce = cached->pragmaOnce;
+            if (_env)
+            {
+                _env->merge(cached->env);
+            }
+        }
+        else
+        {
+            //-----
+            //  parse included file to pptokens 
+            //
+            vector<int> uncTokens;
+            int code_unit;
+            UTF8Decoder utf8Decoder(&input);
+            while ((code_unit = utf8Decoder.nextCode()) > 0)
+            {
+                uncTokens.push_back(code_unit);
+            }
+            if (uncTokens.size()>0 && uncTokens[uncTokens.size()-1]!='\n')
+            {
+                uncTokens.push_back('\n');
+            }
+            PPTokenizer ppTokenizer;
+            ppTokenizer._lineNo = 1;
+            ppTokenizer._srcfile = nextf;
+            ppTokenizer._fileid = fileid; 
+            ppTokenizer.parse(uncTokens);
+
+            //-----
+            // generate MacroPPToken list for the include file
+            //
+            DirectiveHandler dir0(nextf, ppTokenizer._elst);
+            dir0._fileidMap = _fileidMap;
+            dir0._includeSet = _includeSet;
+            dir0._directiveLst = _directiveLst;
+            dir0._headerCache = _headerCache;
+            if (_headerCache)
+            {
+                dir0._env.reset(new HeaderEnv);
+            }
 
-        _fileidMap.insert(pair<PA5FileId,string>(fileid, nextf));
-   
-        //-----
-        // generate MacroPPToken list for the include file
-        //
-        DirectiveHandler dir0(nextf, ppTokenizer._elst);
-        dir0._fileidMap = _fileidMap;
-        dir0._includeSet = _includeSet;
-        dir0._directiveLst = _directiveLst;
+            dir0.createMacroTokens();
+            dir0.processDirectives();        // only after processd, we could know if there's _Pragma(once)
+            dir0.createMacroTokens_post();   // regenerate the macroPPToken list again
 
-        dir0.createMacroTokens();
-        dir0.processDirectives();        // only after processd, we could know if there's _Pragma(once)
-        dir0.createMacroTokens_post();   // regenerate the macroPPToken list again
+            _fileidMap = dir0._fileidMap;
+            _includeSet = dir0._includeSet;
+            _directiveLst = dir0._directiveLst;
+            lines.swap(dir0._list);
+            pragmaOnce = dir0._pragmaOnce;
 
-        _fileidMap = dir0._fileidMap;
-        _includeSet = dir0._includeSet;
-        _directiveLst = dir0._directiveLst;
+            if (_headerCache)
+            {
+                _headerCache->add(nextf, input, *dir0._env, _directiveLst, _fileidMap, lines, pragmaOnce);
+                if (_env)
+                {
+                    _env->merge(*dir0._env);
+                }
+            }
+        }
 
-        if (dir0._pragmaOnce==false || _includeSet.find(fileid) == _includeSet.end())
+        if (pragmaOnce==false || !includedOnce(fileid))
         {
             // remove pragma since they are done already
             // 
-            list<MacroPPToken>::iterator tit = dir0._list.begin();
-            while (tit != dir0._list.end())
+            list<MacroPPToken>::iterator tit = lines.begin();
+            while (tit != lines.end())
             {
                 if (tit->type == PRAGMA)
                 {
-                    tit = dir0._list.erase(tit);
+                    tit = lines.erase(tit);
                     continue;
                 }
                 tit++;
@@ -1669,11 +2065,15 @@ class DirectiveHandler {
             //
             list<MacroPPToken>::iterator insit = it;
             insit++;
-            dir0._list.back().pplst.pop_back();   // pop eof
-            macroTokens.insert(insit, dir0._list.begin(), dir0._list.end());
+            lines.back().pplst.pop_back();   // pop eof
+            macroTokens.insert(insit, lines.begin(), lines.end());
             it = macroTokens.erase( it );
             
             _includeSet.insert(fileid);
+            if (_env)
+            {
+                _env->onceSet.insert(fileid);
+            }
         }
         else
         {
@@ -2139,6 +2539,9 @@ class DirectiveHandler {
     map<string, Directive*>   _directiveLst;
     bool                      _pragmaOnce;
     int                       _baseLineNo;
+
+    HeaderCache*              _headerCache;     // of the batch, 0 if none
+    unique_ptr<HeaderEnv>     _env;             // if an included header with a _headerCache
 };
 
 #ifdef PA4
@@ -2178,149 +2581,8 @@ int main()
         postTokenizer.parse();
 
         // PA2 string concat
-        PostToken concatStr;
-        bool bPrevStr = false;
-        vector<int> strCodes;
-
-        for (unsigned i=0 ; i<postTokenizer._tokens.size() ; i++)
-        {
-            PostToken pt = postTokenizer._tokens[i];
-
-            if (pt.type == PT_SIMPLE && pt.source == "__VA_ARGS__")
-            {
-                throw DirectiveHandlerException("\"__VA_ARGS__\" is not valid identifier");
-            }
-
-            if (pt.type == PT_LITERAL_ARRAY || pt.type == PT_UD_LITERAL_ARRAY)
-            {
-                if (bPrevStr==true)
-                {
-                    concatStr.source += " ";
-                    concatStr.source += pt.source;
-
-                    if (concatStr.type == PT_INVALID)
-                    {
-                        continue;
-                    }
-
-                    int code_unit;
-                    UTF8Decoder utf8Decoder(&pt.udPrefix);
-                    while ((code_unit = utf8Decoder.nextCode()) > 0)
-                    {
-                        strCodes.push_back(code_unit);
-                    }
-
-                    if (concatStr.udSuffix != "" && pt.udSuffix != "" && concatStr.udSuffix != pt.udSuffix)
-                    {
-                        // error
-                        concatStr.type = PT_INVALID;
-                        continue;
-                    }
-                    else
-                    {
-                        concatStr.udSuffix = (concatStr.udSuffix == "") ? pt.udSuffix : concatStr.udSuffix;
-                    }
-
-                    if (concatStr.udSuffix != "")
-                    {
-                        if (concatStr.udSuffix[0] != '_' || concatStr.type == PT_INVALID)
-                        {
-                            concatStr.type = PT_INVALID;
-                            continue;
-                        }
-                        else
-                        {
-                            concatStr.type = PT_UD_LITERAL_ARRAY;
-                        }
-                    }
-
-
-                    if (concatStr.ltype != FT_CHAR && pt.ltype != FT_CHAR && concatStr.ltype != pt.ltype)
-                    {
-                        // different char type
-                        concatStr.type = PT_INVALID;
-                        continue;
-                    } 
-                    else
-                    {
-                        concatStr.ltype = (concatStr.ltype == FT_CHAR) ? pt.ltype : concatStr.ltype;
-                    }
-
-                    bPrevStr = true;
-                } 
-                else
-                {
-                    concatStr = pt;
-
-                    int code_unit;
-                    UTF8Decoder utf8Decoder(&pt.udPrefix);
-                    while ((code_unit = utf8Decoder.nextCode()) > 0)
-                    {
-                        strCodes.push_back(code_unit);
-                    }
-
-                    if (concatStr.udSuffix != "" && concatStr.udSuffix[0] != '_')
-                    {
-                        concatStr.type = PT_INVALID;
-                    }
-                    bPrevStr = true;
-                }
-                continue;
-            }
-
-            if (bPrevStr == true)
-            {
-                char* mem;
-                int size;
-                strCodes.push_back(0);
-
-                if (concatStr.ltype == FT_CHAR || concatStr.ltype == FT_UNSIGNED_CHAR || concatStr.ltype == FT_SIGNED_CHAR)
-                {
-                    string es = UTF8Encoder::encode(strCodes);
-                    mem = new char[es.size()];
-                    memcpy(mem, es.c_str(), es.size());
-                    size = es.size();
-                }
-                else if (concatStr.ltype == FT_CHAR16_T)
-                {
-                    vector<short> utf16_codes = UTF16Encoder::encode( strCodes );
-                    char16_t* data = new char16_t[utf16_codes.size()];
-                    for (unsigned int i=0; i<utf16_codes.size(); ++i)
-                    {
-                        data[i] = utf16_codes[i];
-                    }
-                    mem = (char*)data;
-                    size = utf16_codes.size();
-                }
-                else if (concatStr.ltype == FT_CHAR32_T)
-                {
-                    char32_t* data = new char32_t[strCodes.size()];
-                    for (unsigned int i=0; i<strCodes.size(); ++i)
-                    {
-                        data[i] = strCodes[i];
-                    }
-                    mem = (char*)data;
-                    size = strCodes.size();
-                }
-                else if (concatStr.ltype == FT_WCHAR_T)
-                {
-                    wchar_t* data = new wchar_t[strCodes.size()];
-                    for (unsigned int i=0; i<strCodes.size(); ++i)
-                    {
-                        data[i] = strCodes[i];
-                    }
-                    mem = (char*)data;
-                    size = strCodes.size();
-                }
-
-                concatStr.data = mem;
-                concatStr.size = size;
-                concatStr.emit();
-                bPrevStr = false;
-                strCodes.clear();
-            }
-            pt.emit();
-        }  // end string concat
+        StringLiteralConcat concat(postTokenizer.arena(), StringLiteralConcat::REJECT_VA_ARGS);
+        concat.run(postTokenizer._tokens, [](PostToken& pt) { pt.emit(); });
 
     }
     catch (exception& e)
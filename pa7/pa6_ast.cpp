@@ -0,0 +1,3564 @@
+    // generated by gram_gen, the AST node of every rule alternative
+
+    // translation-unit: declaration* ST_EOF
+    struct Ast_translation_unit_0 {
+        enum { RULE = RULE_translation_unit, ALT = 0, SLOTS = 2 };
+        CppAstRef declaration_list;
+        CppAstRef st_eof;
+    };
+
+    // primary-expression: OP_LPAREN expression OP_RPAREN
+    struct Ast_primary_expression_0 {
+        enum { RULE = RULE_primary_expression, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // primary-expression: lambda-expression
+    struct Ast_primary_expression_1 {
+        enum { RULE = RULE_primary_expression, ALT = 1, SLOTS = 1 };
+        CppAstRef lambda_expression;
+    };
+
+    // primary-expression: id-expression
+    struct Ast_primary_expression_2 {
+        enum { RULE = RULE_primary_expression, ALT = 2, SLOTS = 1 };
+        CppAstRef id_expression;
+    };
+
+    // primary-expression: KW_THIS
+    struct Ast_primary_expression_3 {
+        enum { RULE = RULE_primary_expression, ALT = 3, SLOTS = 1 };
+        CppAstRef kw_this;
+    };
+
+    // primary-expression: TT_LITERAL
+    struct Ast_primary_expression_4 {
+        enum { RULE = RULE_primary_expression, ALT = 4, SLOTS = 1 };
+        CppAstRef tt_literal;
+    };
+
+    // primary-expression: KW_NULLPTR
+    struct Ast_primary_expression_5 {
+        enum { RULE = RULE_primary_expression, ALT = 5, SLOTS = 1 };
+        CppAstRef kw_nullptr;
+    };
+
+    // primary-expression: KW_FALSE
+    struct Ast_primary_expression_6 {
+        enum { RULE = RULE_primary_expression, ALT = 6, SLOTS = 1 };
+        CppAstRef kw_false;
+    };
+
+    // primary-expression: KW_TRUE
+    struct Ast_primary_expression_7 {
+        enum { RULE = RULE_primary_expression, ALT = 7, SLOTS = 1 };
+        CppAstRef kw_true;
+    };
+
+    // type-name: simple-template-id
+    struct Ast_type_name_0 {
+        enum { RULE = RULE_type_name, ALT = 0, SLOTS = 1 };
+        CppAstRef simple_template_id;
+    };
+
+    // type-name: typedef-name
+    struct Ast_type_name_1 {
+        enum { RULE = RULE_type_name, ALT = 1, SLOTS = 1 };
+        CppAstRef typedef_name;
+    };
+
+    // type-name: enum-name
+    struct Ast_type_name_2 {
+        enum { RULE = RULE_type_name, ALT = 2, SLOTS = 1 };
+        CppAstRef enum_name;
+    };
+
+    // type-name: class-name
+    struct Ast_type_name_3 {
+        enum { RULE = RULE_type_name, ALT = 3, SLOTS = 1 };
+        CppAstRef class_name;
+    };
+
+    // class-name: simple-template-id
+    struct Ast_class_name_0 {
+        enum { RULE = RULE_class_name, ALT = 0, SLOTS = 1 };
+        CppAstRef simple_template_id;
+    };
+
+    // class-name: TT_IDENTIFIER_C
+    struct Ast_class_name_1 {
+        enum { RULE = RULE_class_name, ALT = 1, SLOTS = 1 };
+        CppAstRef tt_identifier_c;
+    };
+
+    // enum-name: TT_IDENTIFIER_E
+    struct Ast_enum_name_0 {
+        enum { RULE = RULE_enum_name, ALT = 0, SLOTS = 1 };
+        CppAstRef tt_identifier_e;
+    };
+
+    // namespace-name: TT_IDENTIFIER_N
+    struct Ast_namespace_name_0 {
+        enum { RULE = RULE_namespace_name, ALT = 0, SLOTS = 1 };
+        CppAstRef tt_identifier_n;
+    };
+
+    // template-name: TT_IDENTIFIER_T
+    struct Ast_template_name_0 {
+        enum { RULE = RULE_template_name, ALT = 0, SLOTS = 1 };
+        CppAstRef tt_identifier_t;
+    };
+
+    // typedef-name: TT_IDENTIFIER_Y
+    struct Ast_typedef_name_0 {
+        enum { RULE = RULE_typedef_name, ALT = 0, SLOTS = 1 };
+        CppAstRef tt_identifier_y;
+    };
+
+    // simple-template-id: template-name ST_LT template-argument-list? ST_GT
+    struct Ast_simple_template_id_0 {
+        enum { RULE = RULE_simple_template_id, ALT = 0, SLOTS = 4 };
+        CppAstRef template_name;
+        CppAstRef st_lt;
+        CppAstRef template_argument_list;  // or EMPTY_AST
+        CppAstRef st_gt;
+    };
+
+    // id-expression: qualified-id
+    struct Ast_id_expression_0 {
+        enum { RULE = RULE_id_expression, ALT = 0, SLOTS = 1 };
+        CppAstRef qualified_id;
+    };
+
+    // id-expression: unqualified-id
+    struct Ast_id_expression_1 {
+        enum { RULE = RULE_id_expression, ALT = 1, SLOTS = 1 };
+        CppAstRef unqualified_id;
+    };
+
+    // unqualified-id: OP_COMPL decltype-specifier
+    struct Ast_unqualified_id_0 {
+        enum { RULE = RULE_unqualified_id, ALT = 0, SLOTS = 2 };
+        CppAstRef op_compl;
+        CppAstRef decltype_specifier;
+    };
+
+    // unqualified-id: OP_COMPL class-name
+    struct Ast_unqualified_id_1 {
+        enum { RULE = RULE_unqualified_id, ALT = 1, SLOTS = 2 };
+        CppAstRef op_compl;
+        CppAstRef class_name;
+    };
+
+    // unqualified-id: template-id
+    struct Ast_unqualified_id_2 {
+        enum { RULE = RULE_unqualified_id, ALT = 2, SLOTS = 1 };
+        CppAstRef template_id;
+    };
+
+    // unqualified-id: literal-operator-id
+    struct Ast_unqualified_id_3 {
+        enum { RULE = RULE_unqualified_id, ALT = 3, SLOTS = 1 };
+        CppAstRef literal_operator_id;
+    };
+
+    // unqualified-id: conversion-function-id
+    struct Ast_unqualified_id_4 {
+        enum { RULE = RULE_unqualified_id, ALT = 4, SLOTS = 1 };
+        CppAstRef conversion_function_id;
+    };
+
+    // unqualified-id: operator-function-id
+    struct Ast_unqualified_id_5 {
+        enum { RULE = RULE_unqualified_id, ALT = 5, SLOTS = 1 };
+        CppAstRef operator_function_id;
+    };
+
+    // unqualified-id: TT_IDENTIFIER
+    struct Ast_unqualified_id_6 {
+        enum { RULE = RULE_unqualified_id, ALT = 6, SLOTS = 1 };
+        CppAstRef tt_identifier;
+    };
+
+    // qualified-id: nested-name-specifier KW_TEMPLATE? unqualified-id
+    struct Ast_qualified_id_0 {
+        enum { RULE = RULE_qualified_id, ALT = 0, SLOTS = 3 };
+        CppAstRef nested_name_specifier;
+        CppAstRef kw_template;  // or EMPTY_AST
+        CppAstRef unqualified_id;
+    };
+
+    // nested-name-specifier: nested-name-specifier-root nested-name-specifier-suffix*
+    struct Ast_nested_name_specifier_0 {
+        enum { RULE = RULE_nested_name_specifier, ALT = 0, SLOTS = 2 };
+        CppAstRef nested_name_specifier_root;
+        CppAstRef nested_name_specifier_suffix_list;
+    };
+
+    // nested-name-specifier-root: decltype-specifier OP_COLON2
+    struct Ast_nested_name_specifier_root_0 {
+        enum { RULE = RULE_nested_name_specifier_root, ALT = 0, SLOTS = 2 };
+        CppAstRef decltype_specifier;
+        CppAstRef op_colon2;
+    };
+
+    // nested-name-specifier-root: namespace-name OP_COLON2
+    struct Ast_nested_name_specifier_root_1 {
+        enum { RULE = RULE_nested_name_specifier_root, ALT = 1, SLOTS = 2 };
+        CppAstRef namespace_name;
+        CppAstRef op_colon2;
+    };
+
+    // nested-name-specifier-root: type-name OP_COLON2
+    struct Ast_nested_name_specifier_root_2 {
+        enum { RULE = RULE_nested_name_specifier_root, ALT = 2, SLOTS = 2 };
+        CppAstRef type_name;
+        CppAstRef op_colon2;
+    };
+
+    // nested-name-specifier-root: OP_COLON2
+    struct Ast_nested_name_specifier_root_3 {
+        enum { RULE = RULE_nested_name_specifier_root, ALT = 3, SLOTS = 1 };
+        CppAstRef op_colon2;
+    };
+
+    // nested-name-specifier-suffix: KW_TEMPLATE? simple-template-id OP_COLON2
+    struct Ast_nested_name_specifier_suffix_0 {
+        enum { RULE = RULE_nested_name_specifier_suffix, ALT = 0, SLOTS = 3 };
+        CppAstRef kw_template;  // or EMPTY_AST
+        CppAstRef simple_template_id;
+        CppAstRef op_colon2;
+    };
+
+    // nested-name-specifier-suffix: TT_IDENTIFIER OP_COLON2
+    struct Ast_nested_name_specifier_suffix_1 {
+        enum { RULE = RULE_nested_name_specifier_suffix, ALT = 1, SLOTS = 2 };
+        CppAstRef tt_identifier;
+        CppAstRef op_colon2;
+    };
+
+    // lambda-expression: lambda-introducer lambda-declarator? compound-statement
+    struct Ast_lambda_expression_0 {
+        enum { RULE = RULE_lambda_expression, ALT = 0, SLOTS = 3 };
+        CppAstRef lambda_introducer;
+        CppAstRef lambda_declarator;  // or EMPTY_AST
+        CppAstRef compound_statement;
+    };
+
+    // lambda-introducer: OP_LSQUARE lambda-capture? OP_RSQUARE
+    struct Ast_lambda_introducer_0 {
+        enum { RULE = RULE_lambda_introducer, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lsquare;
+        CppAstRef lambda_capture;  // or EMPTY_AST
+        CppAstRef op_rsquare;
+    };
+
+    // lambda-capture: capture-default OP_COMMA capture-list
+    struct Ast_lambda_capture_0 {
+        enum { RULE = RULE_lambda_capture, ALT = 0, SLOTS = 3 };
+        CppAstRef capture_default;
+        CppAstRef op_comma;
+        CppAstRef capture_list;
+    };
+
+    // lambda-capture: capture-list
+    struct Ast_lambda_capture_1 {
+        enum { RULE = RULE_lambda_capture, ALT = 1, SLOTS = 1 };
+        CppAstRef capture_list;
+    };
+
+    // lambda-capture: capture-default
+    struct Ast_lambda_capture_2 {
+        enum { RULE = RULE_lambda_capture, ALT = 2, SLOTS = 1 };
+        CppAstRef capture_default;
+    };
+
+    // capture-default: OP_ASS
+    struct Ast_capture_default_0 {
+        enum { RULE = RULE_capture_default, ALT = 0, SLOTS = 1 };
+        CppAstRef op_ass;
+    };
+
+    // capture-default: OP_AMP
+    struct Ast_capture_default_1 {
+        enum { RULE = RULE_capture_default, ALT = 1, SLOTS = 1 };
+        CppAstRef op_amp;
+    };
+
+    // capture-list: capture OP_DOTS? (OP_COMMA capture OP_DOTS?)*
+    struct Ast_capture_list_0 {
+        enum { RULE = RULE_capture_list, ALT = 0, SLOTS = 3 };
+        CppAstRef capture;
+        CppAstRef op_dots;  // or EMPTY_AST
+        CppAstRef group_2_list;  // Ast_capture_list_0_2 per repetition
+    };
+
+    // (OP_COMMA capture OP_DOTS?)* in Ast_capture_list_0
+    struct Ast_capture_list_0_2 {
+        enum { SLOTS = 3 };
+        CppAstRef op_comma;
+        CppAstRef capture;
+        CppAstRef op_dots;  // or EMPTY_AST
+    };
+
+    // capture: OP_AMP TT_IDENTIFIER
+    struct Ast_capture_0 {
+        enum { RULE = RULE_capture, ALT = 0, SLOTS = 2 };
+        CppAstRef op_amp;
+        CppAstRef tt_identifier;
+    };
+
+    // capture: KW_THIS
+    struct Ast_capture_1 {
+        enum { RULE = RULE_capture, ALT = 1, SLOTS = 1 };
+        CppAstRef kw_this;
+    };
+
+    // capture: TT_IDENTIFIER
+    struct Ast_capture_2 {
+        enum { RULE = RULE_capture, ALT = 2, SLOTS = 1 };
+        CppAstRef tt_identifier;
+    };
+
+    // lambda-declarator: OP_LPAREN parameter-declaration-clause OP_RPAREN KW_MUTABLE? exception-specification? attribute-specifier* trailing-return-type?
+    struct Ast_lambda_declarator_0 {
+        enum { RULE = RULE_lambda_declarator, ALT = 0, SLOTS = 7 };
+        CppAstRef op_lparen;
+        CppAstRef parameter_declaration_clause;
+        CppAstRef op_rparen;
+        CppAstRef kw_mutable;  // or EMPTY_AST
+        CppAstRef exception_specification;  // or EMPTY_AST
+        CppAstRef attribute_specifier_list;
+        CppAstRef trailing_return_type;  // or EMPTY_AST
+    };
+
+    // postfix-expression: postfix-root postfix-suffix*
+    struct Ast_postfix_expression_0 {
+        enum { RULE = RULE_postfix_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef postfix_root;
+        CppAstRef postfix_suffix_list;
+    };
+
+    // postfix-root: KW_CONST_CAST ST_LT type-id ST_GT OP_LPAREN expression OP_RPAREN
+    struct Ast_postfix_root_0 {
+        enum { RULE = RULE_postfix_root, ALT = 0, SLOTS = 7 };
+        CppAstRef kw_const_cast;
+        CppAstRef st_lt;
+        CppAstRef type_id;
+        CppAstRef st_gt;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: KW_REINTERPET_CAST ST_LT type-id ST_GT OP_LPAREN expression OP_RPAREN
+    struct Ast_postfix_root_1 {
+        enum { RULE = RULE_postfix_root, ALT = 1, SLOTS = 7 };
+        CppAstRef kw_reinterpet_cast;
+        CppAstRef st_lt;
+        CppAstRef type_id;
+        CppAstRef st_gt;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: KW_STATIC_CAST ST_LT type-id ST_GT OP_LPAREN expression OP_RPAREN
+    struct Ast_postfix_root_2 {
+        enum { RULE = RULE_postfix_root, ALT = 2, SLOTS = 7 };
+        CppAstRef kw_static_cast;
+        CppAstRef st_lt;
+        CppAstRef type_id;
+        CppAstRef st_gt;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: KW_DYNAMIC_CAST ST_LT type-id ST_GT OP_LPAREN expression OP_RPAREN
+    struct Ast_postfix_root_3 {
+        enum { RULE = RULE_postfix_root, ALT = 3, SLOTS = 7 };
+        CppAstRef kw_dynamic_cast;
+        CppAstRef st_lt;
+        CppAstRef type_id;
+        CppAstRef st_gt;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: KW_TYPEID OP_LPAREN type-id OP_RPAREN
+    struct Ast_postfix_root_4 {
+        enum { RULE = RULE_postfix_root, ALT = 4, SLOTS = 4 };
+        CppAstRef kw_typeid;
+        CppAstRef op_lparen;
+        CppAstRef type_id;
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: KW_TYPEID OP_LPAREN expression OP_RPAREN
+    struct Ast_postfix_root_5 {
+        enum { RULE = RULE_postfix_root, ALT = 5, SLOTS = 4 };
+        CppAstRef kw_typeid;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: typename-specifier OP_LPAREN expression-list? OP_RPAREN
+    struct Ast_postfix_root_6 {
+        enum { RULE = RULE_postfix_root, ALT = 6, SLOTS = 4 };
+        CppAstRef typename_specifier;
+        CppAstRef op_lparen;
+        CppAstRef expression_list;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: simple-type-specifier OP_LPAREN expression-list? OP_RPAREN
+    struct Ast_postfix_root_7 {
+        enum { RULE = RULE_postfix_root, ALT = 7, SLOTS = 4 };
+        CppAstRef simple_type_specifier;
+        CppAstRef op_lparen;
+        CppAstRef expression_list;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // postfix-root: typename-specifier braced-init-list
+    struct Ast_postfix_root_8 {
+        enum { RULE = RULE_postfix_root, ALT = 8, SLOTS = 2 };
+        CppAstRef typename_specifier;
+        CppAstRef braced_init_list;
+    };
+
+    // postfix-root: simple-type-specifier braced-init-list
+    struct Ast_postfix_root_9 {
+        enum { RULE = RULE_postfix_root, ALT = 9, SLOTS = 2 };
+        CppAstRef simple_type_specifier;
+        CppAstRef braced_init_list;
+    };
+
+    // postfix-root: primary-expression
+    struct Ast_postfix_root_10 {
+        enum { RULE = RULE_postfix_root, ALT = 10, SLOTS = 1 };
+        CppAstRef primary_expression;
+    };
+
+    // postfix-suffix: OP_ARROW KW_TEMPLATE? id-expression
+    struct Ast_postfix_suffix_0 {
+        enum { RULE = RULE_postfix_suffix, ALT = 0, SLOTS = 3 };
+        CppAstRef op_arrow;
+        CppAstRef kw_template;  // or EMPTY_AST
+        CppAstRef id_expression;
+    };
+
+    // postfix-suffix: OP_DOT KW_TEMPLATE? id-expression
+    struct Ast_postfix_suffix_1 {
+        enum { RULE = RULE_postfix_suffix, ALT = 1, SLOTS = 3 };
+        CppAstRef op_dot;
+        CppAstRef kw_template;  // or EMPTY_AST
+        CppAstRef id_expression;
+    };
+
+    // postfix-suffix: OP_LPAREN expression-list? OP_RPAREN
+    struct Ast_postfix_suffix_2 {
+        enum { RULE = RULE_postfix_suffix, ALT = 2, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef expression_list;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // postfix-suffix: OP_LSQUARE braced-init-list OP_RSQUARE
+    struct Ast_postfix_suffix_3 {
+        enum { RULE = RULE_postfix_suffix, ALT = 3, SLOTS = 3 };
+        CppAstRef op_lsquare;
+        CppAstRef braced_init_list;
+        CppAstRef op_rsquare;
+    };
+
+    // postfix-suffix: OP_LSQUARE expression OP_RSQUARE
+    struct Ast_postfix_suffix_4 {
+        enum { RULE = RULE_postfix_suffix, ALT = 4, SLOTS = 3 };
+        CppAstRef op_lsquare;
+        CppAstRef expression;
+        CppAstRef op_rsquare;
+    };
+
+    // postfix-suffix: OP_ARROW pseudo-destructor-name
+    struct Ast_postfix_suffix_5 {
+        enum { RULE = RULE_postfix_suffix, ALT = 5, SLOTS = 2 };
+        CppAstRef op_arrow;
+        CppAstRef pseudo_destructor_name;
+    };
+
+    // postfix-suffix: OP_DOT pseudo-destructor-name
+    struct Ast_postfix_suffix_6 {
+        enum { RULE = RULE_postfix_suffix, ALT = 6, SLOTS = 2 };
+        CppAstRef op_dot;
+        CppAstRef pseudo_destructor_name;
+    };
+
+    // postfix-suffix: OP_DEC
+    struct Ast_postfix_suffix_7 {
+        enum { RULE = RULE_postfix_suffix, ALT = 7, SLOTS = 1 };
+        CppAstRef op_dec;
+    };
+
+    // postfix-suffix: OP_INC
+    struct Ast_postfix_suffix_8 {
+        enum { RULE = RULE_postfix_suffix, ALT = 8, SLOTS = 1 };
+        CppAstRef op_inc;
+    };
+
+    // expression-list: initializer-list
+    struct Ast_expression_list_0 {
+        enum { RULE = RULE_expression_list, ALT = 0, SLOTS = 1 };
+        CppAstRef initializer_list;
+    };
+
+    // pseudo-destructor-name: nested-name-specifier? OP_COMPL type-name
+    struct Ast_pseudo_destructor_name_0 {
+        enum { RULE = RULE_pseudo_destructor_name, ALT = 0, SLOTS = 3 };
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef op_compl;
+        CppAstRef type_name;
+    };
+
+    // pseudo-destructor-name: OP_COMPL decltype-specifier
+    struct Ast_pseudo_destructor_name_1 {
+        enum { RULE = RULE_pseudo_destructor_name, ALT = 1, SLOTS = 2 };
+        CppAstRef op_compl;
+        CppAstRef decltype_specifier;
+    };
+
+    // unary-expression: KW_SIZEOF OP_DOTS OP_LPAREN TT_IDENTIFIER OP_RPAREN
+    struct Ast_unary_expression_0 {
+        enum { RULE = RULE_unary_expression, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_sizeof;
+        CppAstRef op_dots;
+        CppAstRef op_lparen;
+        CppAstRef tt_identifier;
+        CppAstRef op_rparen;
+    };
+
+    // unary-expression: KW_ALIGNOF OP_LPAREN type-id OP_RPAREN
+    struct Ast_unary_expression_1 {
+        enum { RULE = RULE_unary_expression, ALT = 1, SLOTS = 4 };
+        CppAstRef kw_alignof;
+        CppAstRef op_lparen;
+        CppAstRef type_id;
+        CppAstRef op_rparen;
+    };
+
+    // unary-expression: KW_SIZEOF OP_LPAREN type-id OP_RPAREN
+    struct Ast_unary_expression_2 {
+        enum { RULE = RULE_unary_expression, ALT = 2, SLOTS = 4 };
+        CppAstRef kw_sizeof;
+        CppAstRef op_lparen;
+        CppAstRef type_id;
+        CppAstRef op_rparen;
+    };
+
+    // unary-expression: KW_SIZEOF unary-expression
+    struct Ast_unary_expression_3 {
+        enum { RULE = RULE_unary_expression, ALT = 3, SLOTS = 2 };
+        CppAstRef kw_sizeof;
+        CppAstRef unary_expression;
+    };
+
+    // unary-expression: unary-operator cast-expression
+    struct Ast_unary_expression_4 {
+        enum { RULE = RULE_unary_expression, ALT = 4, SLOTS = 2 };
+        CppAstRef unary_operator;
+        CppAstRef cast_expression;
+    };
+
+    // unary-expression: delete-expression
+    struct Ast_unary_expression_5 {
+        enum { RULE = RULE_unary_expression, ALT = 5, SLOTS = 1 };
+        CppAstRef delete_expression;
+    };
+
+    // unary-expression: new-expression
+    struct Ast_unary_expression_6 {
+        enum { RULE = RULE_unary_expression, ALT = 6, SLOTS = 1 };
+        CppAstRef new_expression;
+    };
+
+    // unary-expression: noexcept-expression
+    struct Ast_unary_expression_7 {
+        enum { RULE = RULE_unary_expression, ALT = 7, SLOTS = 1 };
+        CppAstRef noexcept_expression;
+    };
+
+    // unary-expression: postfix-expression
+    struct Ast_unary_expression_8 {
+        enum { RULE = RULE_unary_expression, ALT = 8, SLOTS = 1 };
+        CppAstRef postfix_expression;
+    };
+
+    // unary-operator: OP_COMPL
+    struct Ast_unary_operator_0 {
+        enum { RULE = RULE_unary_operator, ALT = 0, SLOTS = 1 };
+        CppAstRef op_compl;
+    };
+
+    // unary-operator: OP_LNOT
+    struct Ast_unary_operator_1 {
+        enum { RULE = RULE_unary_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_lnot;
+    };
+
+    // unary-operator: OP_MINUS
+    struct Ast_unary_operator_2 {
+        enum { RULE = RULE_unary_operator, ALT = 2, SLOTS = 1 };
+        CppAstRef op_minus;
+    };
+
+    // unary-operator: OP_PLUS
+    struct Ast_unary_operator_3 {
+        enum { RULE = RULE_unary_operator, ALT = 3, SLOTS = 1 };
+        CppAstRef op_plus;
+    };
+
+    // unary-operator: OP_AMP
+    struct Ast_unary_operator_4 {
+        enum { RULE = RULE_unary_operator, ALT = 4, SLOTS = 1 };
+        CppAstRef op_amp;
+    };
+
+    // unary-operator: OP_STAR
+    struct Ast_unary_operator_5 {
+        enum { RULE = RULE_unary_operator, ALT = 5, SLOTS = 1 };
+        CppAstRef op_star;
+    };
+
+    // unary-operator: OP_DEC
+    struct Ast_unary_operator_6 {
+        enum { RULE = RULE_unary_operator, ALT = 6, SLOTS = 1 };
+        CppAstRef op_dec;
+    };
+
+    // unary-operator: OP_INC
+    struct Ast_unary_operator_7 {
+        enum { RULE = RULE_unary_operator, ALT = 7, SLOTS = 1 };
+        CppAstRef op_inc;
+    };
+
+    // new-expression: OP_COLON2? KW_NEW new-placement? OP_LPAREN type-id OP_RPAREN new-initializer?
+    struct Ast_new_expression_0 {
+        enum { RULE = RULE_new_expression, ALT = 0, SLOTS = 7 };
+        CppAstRef op_colon2;  // or EMPTY_AST
+        CppAstRef kw_new;
+        CppAstRef new_placement;  // or EMPTY_AST
+        CppAstRef op_lparen;
+        CppAstRef type_id;
+        CppAstRef op_rparen;
+        CppAstRef new_initializer;  // or EMPTY_AST
+    };
+
+    // new-expression: OP_COLON2? KW_NEW new-placement? new-type-id new-initializer?
+    struct Ast_new_expression_1 {
+        enum { RULE = RULE_new_expression, ALT = 1, SLOTS = 5 };
+        CppAstRef op_colon2;  // or EMPTY_AST
+        CppAstRef kw_new;
+        CppAstRef new_placement;  // or EMPTY_AST
+        CppAstRef new_type_id;
+        CppAstRef new_initializer;  // or EMPTY_AST
+    };
+
+    // new-placement: OP_LPAREN expression-list OP_RPAREN
+    struct Ast_new_placement_0 {
+        enum { RULE = RULE_new_placement, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef expression_list;
+        CppAstRef op_rparen;
+    };
+
+    // new-type-id: type-specifier-seq new-declarator?
+    struct Ast_new_type_id_0 {
+        enum { RULE = RULE_new_type_id, ALT = 0, SLOTS = 2 };
+        CppAstRef type_specifier_seq;
+        CppAstRef new_declarator;  // or EMPTY_AST
+    };
+
+    // new-declarator: ptr-operator* noptr-new-declarator
+    struct Ast_new_declarator_0 {
+        enum { RULE = RULE_new_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef ptr_operator_list;
+        CppAstRef noptr_new_declarator;
+    };
+
+    // new-declarator: ptr-operator+
+    struct Ast_new_declarator_1 {
+        enum { RULE = RULE_new_declarator, ALT = 1, SLOTS = 1 };
+        CppAstRef ptr_operator_list;
+    };
+
+    // noptr-new-declarator: OP_LSQUARE expression OP_RSQUARE attribute-specifier* (OP_LSQUARE constant-expression OP_RSQUARE attribute-specifier*)*
+    struct Ast_noptr_new_declarator_0 {
+        enum { RULE = RULE_noptr_new_declarator, ALT = 0, SLOTS = 5 };
+        CppAstRef op_lsquare;
+        CppAstRef expression;
+        CppAstRef op_rsquare;
+        CppAstRef attribute_specifier_list;
+        CppAstRef group_4_list;  // Ast_noptr_new_declarator_0_4 per repetition
+    };
+
+    // (OP_LSQUARE constant-expression OP_RSQUARE attribute-specifier*)* in Ast_noptr_new_declarator_0
+    struct Ast_noptr_new_declarator_0_4 {
+        enum { SLOTS = 4 };
+        CppAstRef op_lsquare;
+        CppAstRef constant_expression;
+        CppAstRef op_rsquare;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // new-initializer: OP_LPAREN expression-list? OP_RPAREN
+    struct Ast_new_initializer_0 {
+        enum { RULE = RULE_new_initializer, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef expression_list;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // new-initializer: braced-init-list
+    struct Ast_new_initializer_1 {
+        enum { RULE = RULE_new_initializer, ALT = 1, SLOTS = 1 };
+        CppAstRef braced_init_list;
+    };
+
+    // delete-expression: OP_COLON2? KW_DELETE OP_LSQUARE OP_RSQUARE cast-expression
+    struct Ast_delete_expression_0 {
+        enum { RULE = RULE_delete_expression, ALT = 0, SLOTS = 5 };
+        CppAstRef op_colon2;  // or EMPTY_AST
+        CppAstRef kw_delete;
+        CppAstRef op_lsquare;
+        CppAstRef op_rsquare;
+        CppAstRef cast_expression;
+    };
+
+    // delete-expression: OP_COLON2? KW_DELETE cast-expression
+    struct Ast_delete_expression_1 {
+        enum { RULE = RULE_delete_expression, ALT = 1, SLOTS = 3 };
+        CppAstRef op_colon2;  // or EMPTY_AST
+        CppAstRef kw_delete;
+        CppAstRef cast_expression;
+    };
+
+    // noexcept-expression: KW_NOEXCEPT OP_LPAREN expression OP_RPAREN
+    struct Ast_noexcept_expression_0 {
+        enum { RULE = RULE_noexcept_expression, ALT = 0, SLOTS = 4 };
+        CppAstRef kw_noexcept;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // cast-expression: cast-operator cast-expression
+    struct Ast_cast_expression_0 {
+        enum { RULE = RULE_cast_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef cast_operator;
+        CppAstRef cast_expression;
+    };
+
+    // cast-expression: unary-expression
+    struct Ast_cast_expression_1 {
+        enum { RULE = RULE_cast_expression, ALT = 1, SLOTS = 1 };
+        CppAstRef unary_expression;
+    };
+
+    // cast-operator: OP_LPAREN type-id OP_RPAREN
+    struct Ast_cast_operator_0 {
+        enum { RULE = RULE_cast_operator, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef type_id;
+        CppAstRef op_rparen;
+    };
+
+    // pm-expression: cast-expression (pm-operator cast-expression)*
+    struct Ast_pm_expression_0 {
+        enum { RULE = RULE_pm_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef cast_expression;
+        CppAstRef group_1_list;  // Ast_pm_expression_0_1 per repetition
+    };
+
+    // (pm-operator cast-expression)* in Ast_pm_expression_0
+    struct Ast_pm_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef pm_operator;
+        CppAstRef cast_expression;
+    };
+
+    // pm-operator: OP_ARROWSTAR
+    struct Ast_pm_operator_0 {
+        enum { RULE = RULE_pm_operator, ALT = 0, SLOTS = 1 };
+        CppAstRef op_arrowstar;
+    };
+
+    // pm-operator: OP_DOTSTAR
+    struct Ast_pm_operator_1 {
+        enum { RULE = RULE_pm_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_dotstar;
+    };
+
+    // multiplicative-expression: pm-expression (multiplicative-operator pm-expression)*
+    struct Ast_multiplicative_expression_0 {
+        enum { RULE = RULE_multiplicative_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef pm_expression;
+        CppAstRef group_1_list;  // Ast_multiplicative_expression_0_1 per repetition
+    };
+
+    // (multiplicative-operator pm-expression)* in Ast_multiplicative_expression_0
+    struct Ast_multiplicative_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef multiplicative_operator;
+        CppAstRef pm_expression;
+    };
+
+    // multiplicative-operator: OP_MOD
+    struct Ast_multiplicative_operator_0 {
+        enum { RULE = RULE_multiplicative_operator, ALT = 0, SLOTS = 1 };
+        CppAstRef op_mod;
+    };
+
+    // multiplicative-operator: OP_DIV
+    struct Ast_multiplicative_operator_1 {
+        enum { RULE = RULE_multiplicative_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_div;
+    };
+
+    // multiplicative-operator: OP_STAR
+    struct Ast_multiplicative_operator_2 {
+        enum { RULE = RULE_multiplicative_operator, ALT = 2, SLOTS = 1 };
+        CppAstRef op_star;
+    };
+
+    // additive-expression: multiplicative-expression (additive-operator multiplicative-expression)*
+    struct Ast_additive_expression_0 {
+        enum { RULE = RULE_additive_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef multiplicative_expression;
+        CppAstRef group_1_list;  // Ast_additive_expression_0_1 per repetition
+    };
+
+    // (additive-operator multiplicative-expression)* in Ast_additive_expression_0
+    struct Ast_additive_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef additive_operator;
+        CppAstRef multiplicative_expression;
+    };
+
+    // additive-operator: OP_MINUS
+    struct Ast_additive_operator_0 {
+        enum { RULE = RULE_additive_operator, ALT = 0, SLOTS = 1 };
+        CppAstRef op_minus;
+    };
+
+    // additive-operator: OP_PLUS
+    struct Ast_additive_operator_1 {
+        enum { RULE = RULE_additive_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_plus;
+    };
+
+    // shift-expression: additive-expression (shift-operator additive-expression)*
+    struct Ast_shift_expression_0 {
+        enum { RULE = RULE_shift_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef additive_expression;
+        CppAstRef group_1_list;  // Ast_shift_expression_0_1 per repetition
+    };
+
+    // (shift-operator additive-expression)* in Ast_shift_expression_0
+    struct Ast_shift_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef shift_operator;
+        CppAstRef additive_expression;
+    };
+
+    // shift-operator: ST_RSHIFT_1 ST_RSHIFT_2
+    struct Ast_shift_operator_0 {
+        enum { RULE = RULE_shift_operator, ALT = 0, SLOTS = 2 };
+        CppAstRef st_rshift_1;
+        CppAstRef st_rshift_2;
+    };
+
+    // shift-operator: OP_LSHIFT
+    struct Ast_shift_operator_1 {
+        enum { RULE = RULE_shift_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_lshift;
+    };
+
+    // relational-expression: shift-expression (relational-operator shift-expression)*
+    struct Ast_relational_expression_0 {
+        enum { RULE = RULE_relational_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef shift_expression;
+        CppAstRef group_1_list;  // Ast_relational_expression_0_1 per repetition
+    };
+
+    // (relational-operator shift-expression)* in Ast_relational_expression_0
+    struct Ast_relational_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef relational_operator;
+        CppAstRef shift_expression;
+    };
+
+    // relational-operator: OP_GE
+    struct Ast_relational_operator_0 {
+        enum { RULE = RULE_relational_operator, ALT = 0, SLOTS = 1 };
+        CppAstRef op_ge;
+    };
+
+    // relational-operator: OP_LE
+    struct Ast_relational_operator_1 {
+        enum { RULE = RULE_relational_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_le;
+    };
+
+    // relational-operator: OP_GT
+    struct Ast_relational_operator_2 {
+        enum { RULE = RULE_relational_operator, ALT = 2, SLOTS = 1 };
+        CppAstRef op_gt;
+    };
+
+    // relational-operator: OP_LT
+    struct Ast_relational_operator_3 {
+        enum { RULE = RULE_relational_operator, ALT = 3, SLOTS = 1 };
+        CppAstRef op_lt;
+    };
+
+    // equality-expression: relational-expression (equality-operator relational-expression)*
+    struct Ast_equality_expression_0 {
+        enum { RULE = RULE_equality_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef relational_expression;
+        CppAstRef group_1_list;  // Ast_equality_expression_0_1 per repetition
+    };
+
+    // (equality-operator relational-expression)* in Ast_equality_expression_0
+    struct Ast_equality_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef equality_operator;
+        CppAstRef relational_expression;
+    };
+
+    // equality-operator: OP_NE
+    struct Ast_equality_operator_0 {
+        enum { RULE = RULE_equality_operator, ALT = 0, SLOTS = 1 };
+        CppAstRef op_ne;
+    };
+
+    // equality-operator: OP_EQ
+    struct Ast_equality_operator_1 {
+        enum { RULE = RULE_equality_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_eq;
+    };
+
+    // and-expression: equality-expression (OP_AMP equality-expression)*
+    struct Ast_and_expression_0 {
+        enum { RULE = RULE_and_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef equality_expression;
+        CppAstRef group_1_list;  // Ast_and_expression_0_1 per repetition
+    };
+
+    // (OP_AMP equality-expression)* in Ast_and_expression_0
+    struct Ast_and_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_amp;
+        CppAstRef equality_expression;
+    };
+
+    // exclusive-or-expression: and-expression (OP_XOR and-expression)*
+    struct Ast_exclusive_or_expression_0 {
+        enum { RULE = RULE_exclusive_or_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef and_expression;
+        CppAstRef group_1_list;  // Ast_exclusive_or_expression_0_1 per repetition
+    };
+
+    // (OP_XOR and-expression)* in Ast_exclusive_or_expression_0
+    struct Ast_exclusive_or_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_xor;
+        CppAstRef and_expression;
+    };
+
+    // inclusive-or-expression: exclusive-or-expression (OP_BOR exclusive-or-expression)*
+    struct Ast_inclusive_or_expression_0 {
+        enum { RULE = RULE_inclusive_or_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef exclusive_or_expression;
+        CppAstRef group_1_list;  // Ast_inclusive_or_expression_0_1 per repetition
+    };
+
+    // (OP_BOR exclusive-or-expression)* in Ast_inclusive_or_expression_0
+    struct Ast_inclusive_or_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_bor;
+        CppAstRef exclusive_or_expression;
+    };
+
+    // logical-and-expression: inclusive-or-expression (OP_LAND inclusive-or-expression)*
+    struct Ast_logical_and_expression_0 {
+        enum { RULE = RULE_logical_and_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef inclusive_or_expression;
+        CppAstRef group_1_list;  // Ast_logical_and_expression_0_1 per repetition
+    };
+
+    // (OP_LAND inclusive-or-expression)* in Ast_logical_and_expression_0
+    struct Ast_logical_and_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_land;
+        CppAstRef inclusive_or_expression;
+    };
+
+    // logical-or-expression: logical-and-expression (OP_LOR logical-and-expression)*
+    struct Ast_logical_or_expression_0 {
+        enum { RULE = RULE_logical_or_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef logical_and_expression;
+        CppAstRef group_1_list;  // Ast_logical_or_expression_0_1 per repetition
+    };
+
+    // (OP_LOR logical-and-expression)* in Ast_logical_or_expression_0
+    struct Ast_logical_or_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_lor;
+        CppAstRef logical_and_expression;
+    };
+
+    // conditional-expression: logical-or-expression (OP_QMARK expression OP_COLON assignment-expression)?
+    struct Ast_conditional_expression_0 {
+        enum { RULE = RULE_conditional_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef logical_or_expression;
+        CppAstRef group_1;  // Ast_conditional_expression_0_1 or nothing
+    };
+
+    // (OP_QMARK expression OP_COLON assignment-expression)? in Ast_conditional_expression_0
+    struct Ast_conditional_expression_0_1 {
+        enum { SLOTS = 4 };
+        CppAstRef op_qmark;
+        CppAstRef expression;
+        CppAstRef op_colon;
+        CppAstRef assignment_expression;
+    };
+
+    // assignment-expression: logical-or-expression assignment-operator initializer-clause
+    struct Ast_assignment_expression_0 {
+        enum { RULE = RULE_assignment_expression, ALT = 0, SLOTS = 3 };
+        CppAstRef logical_or_expression;
+        CppAstRef assignment_operator;
+        CppAstRef initializer_clause;
+    };
+
+    // assignment-expression: throw-expression
+    struct Ast_assignment_expression_1 {
+        enum { RULE = RULE_assignment_expression, ALT = 1, SLOTS = 1 };
+        CppAstRef throw_expression;
+    };
+
+    // assignment-expression: conditional-expression
+    struct Ast_assignment_expression_2 {
+        enum { RULE = RULE_assignment_expression, ALT = 2, SLOTS = 1 };
+        CppAstRef conditional_expression;
+    };
+
+    // assignment-operator: OP_BORASS
+    struct Ast_assignment_operator_0 {
+        enum { RULE = RULE_assignment_operator, ALT = 0, SLOTS = 1 };
+        CppAstRef op_borass;
+    };
+
+    // assignment-operator: OP_XORASS
+    struct Ast_assignment_operator_1 {
+        enum { RULE = RULE_assignment_operator, ALT = 1, SLOTS = 1 };
+        CppAstRef op_xorass;
+    };
+
+    // assignment-operator: OP_BANDASS
+    struct Ast_assignment_operator_2 {
+        enum { RULE = RULE_assignment_operator, ALT = 2, SLOTS = 1 };
+        CppAstRef op_bandass;
+    };
+
+    // assignment-operator: OP_LSHIFTASS
+    struct Ast_assignment_operator_3 {
+        enum { RULE = RULE_assignment_operator, ALT = 3, SLOTS = 1 };
+        CppAstRef op_lshiftass;
+    };
+
+    // assignment-operator: OP_RSHIFTASS
+    struct Ast_assignment_operator_4 {
+        enum { RULE = RULE_assignment_operator, ALT = 4, SLOTS = 1 };
+        CppAstRef op_rshiftass;
+    };
+
+    // assignment-operator: OP_MINUSASS
+    struct Ast_assignment_operator_5 {
+        enum { RULE = RULE_assignment_operator, ALT = 5, SLOTS = 1 };
+        CppAstRef op_minusass;
+    };
+
+    // assignment-operator: OP_PLUSASS
+    struct Ast_assignment_operator_6 {
+        enum { RULE = RULE_assignment_operator, ALT = 6, SLOTS = 1 };
+        CppAstRef op_plusass;
+    };
+
+    // assignment-operator: OP_MODASS
+    struct Ast_assignment_operator_7 {
+        enum { RULE = RULE_assignment_operator, ALT = 7, SLOTS = 1 };
+        CppAstRef op_modass;
+    };
+
+    // assignment-operator: OP_DIVASS
+    struct Ast_assignment_operator_8 {
+        enum { RULE = RULE_assignment_operator, ALT = 8, SLOTS = 1 };
+        CppAstRef op_divass;
+    };
+
+    // assignment-operator: OP_STARASS
+    struct Ast_assignment_operator_9 {
+        enum { RULE = RULE_assignment_operator, ALT = 9, SLOTS = 1 };
+        CppAstRef op_starass;
+    };
+
+    // assignment-operator: OP_ASS
+    struct Ast_assignment_operator_10 {
+        enum { RULE = RULE_assignment_operator, ALT = 10, SLOTS = 1 };
+        CppAstRef op_ass;
+    };
+
+    // expression: assignment-expression (OP_COMMA assignment-expression)*
+    struct Ast_expression_0 {
+        enum { RULE = RULE_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef assignment_expression;
+        CppAstRef group_1_list;  // Ast_expression_0_1 per repetition
+    };
+
+    // (OP_COMMA assignment-expression)* in Ast_expression_0
+    struct Ast_expression_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef assignment_expression;
+    };
+
+    // constant-expression: conditional-expression
+    struct Ast_constant_expression_0 {
+        enum { RULE = RULE_constant_expression, ALT = 0, SLOTS = 1 };
+        CppAstRef conditional_expression;
+    };
+
+    // statement: attribute-specifier* try-block
+    struct Ast_statement_0 {
+        enum { RULE = RULE_statement, ALT = 0, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef try_block;
+    };
+
+    // statement: attribute-specifier* jump-statement
+    struct Ast_statement_1 {
+        enum { RULE = RULE_statement, ALT = 1, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef jump_statement;
+    };
+
+    // statement: attribute-specifier* iteration-statement
+    struct Ast_statement_2 {
+        enum { RULE = RULE_statement, ALT = 2, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef iteration_statement;
+    };
+
+    // statement: attribute-specifier* selection-statement
+    struct Ast_statement_3 {
+        enum { RULE = RULE_statement, ALT = 3, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef selection_statement;
+    };
+
+    // statement: attribute-specifier* compound-statement
+    struct Ast_statement_4 {
+        enum { RULE = RULE_statement, ALT = 4, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef compound_statement;
+    };
+
+    // statement: attribute-specifier* expression-statement
+    struct Ast_statement_5 {
+        enum { RULE = RULE_statement, ALT = 5, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef expression_statement;
+    };
+
+    // statement: declaration-statement
+    struct Ast_statement_6 {
+        enum { RULE = RULE_statement, ALT = 6, SLOTS = 1 };
+        CppAstRef declaration_statement;
+    };
+
+    // statement: labeled-statement
+    struct Ast_statement_7 {
+        enum { RULE = RULE_statement, ALT = 7, SLOTS = 1 };
+        CppAstRef labeled_statement;
+    };
+
+    // labeled-statement: attribute-specifier* KW_CASE constant-expression OP_COLON statement
+    struct Ast_labeled_statement_0 {
+        enum { RULE = RULE_labeled_statement, ALT = 0, SLOTS = 5 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef kw_case;
+        CppAstRef constant_expression;
+        CppAstRef op_colon;
+        CppAstRef statement;
+    };
+
+    // labeled-statement: attribute-specifier* KW_DEFAULT OP_COLON statement
+    struct Ast_labeled_statement_1 {
+        enum { RULE = RULE_labeled_statement, ALT = 1, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef kw_default;
+        CppAstRef op_colon;
+        CppAstRef statement;
+    };
+
+    // labeled-statement: attribute-specifier* TT_IDENTIFIER OP_COLON statement
+    struct Ast_labeled_statement_2 {
+        enum { RULE = RULE_labeled_statement, ALT = 2, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef tt_identifier;
+        CppAstRef op_colon;
+        CppAstRef statement;
+    };
+
+    // expression-statement: expression? OP_SEMICOLON
+    struct Ast_expression_statement_0 {
+        enum { RULE = RULE_expression_statement, ALT = 0, SLOTS = 2 };
+        CppAstRef expression;  // or EMPTY_AST
+        CppAstRef op_semicolon;
+    };
+
+    // compound-statement: OP_LBRACE statement* OP_RBRACE
+    struct Ast_compound_statement_0 {
+        enum { RULE = RULE_compound_statement, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lbrace;
+        CppAstRef statement_list;
+        CppAstRef op_rbrace;
+    };
+
+    // selection-statement: KW_IF OP_LPAREN condition OP_RPAREN statement KW_ELSE statement
+    struct Ast_selection_statement_0 {
+        enum { RULE = RULE_selection_statement, ALT = 0, SLOTS = 7 };
+        CppAstRef kw_if;
+        CppAstRef op_lparen;
+        CppAstRef condition;
+        CppAstRef op_rparen;
+        CppAstRef statement;
+        CppAstRef kw_else;
+        CppAstRef statement_6;
+    };
+
+    // selection-statement: KW_SWITCH OP_LPAREN condition OP_RPAREN statement
+    struct Ast_selection_statement_1 {
+        enum { RULE = RULE_selection_statement, ALT = 1, SLOTS = 5 };
+        CppAstRef kw_switch;
+        CppAstRef op_lparen;
+        CppAstRef condition;
+        CppAstRef op_rparen;
+        CppAstRef statement;
+    };
+
+    // selection-statement: KW_IF OP_LPAREN condition OP_RPAREN statement
+    struct Ast_selection_statement_2 {
+        enum { RULE = RULE_selection_statement, ALT = 2, SLOTS = 5 };
+        CppAstRef kw_if;
+        CppAstRef op_lparen;
+        CppAstRef condition;
+        CppAstRef op_rparen;
+        CppAstRef statement;
+    };
+
+    // condition-declaration: attribute-specifier* decl-specifier-seq declarator OP_ASS initializer-clause
+    struct Ast_condition_declaration_0 {
+        enum { RULE = RULE_condition_declaration, ALT = 0, SLOTS = 5 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef declarator;
+        CppAstRef op_ass;
+        CppAstRef initializer_clause;
+    };
+
+    // condition-declaration: attribute-specifier* decl-specifier-seq declarator braced-init-list
+    struct Ast_condition_declaration_1 {
+        enum { RULE = RULE_condition_declaration, ALT = 1, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef declarator;
+        CppAstRef braced_init_list;
+    };
+
+    // condition: expression
+    struct Ast_condition_0 {
+        enum { RULE = RULE_condition, ALT = 0, SLOTS = 1 };
+        CppAstRef expression;
+    };
+
+    // condition: condition-declaration
+    struct Ast_condition_1 {
+        enum { RULE = RULE_condition, ALT = 1, SLOTS = 1 };
+        CppAstRef condition_declaration;
+    };
+
+    // iteration-statement: KW_FOR OP_LPAREN for-init-statement condition? OP_SEMICOLON expression? OP_RPAREN statement
+    struct Ast_iteration_statement_0 {
+        enum { RULE = RULE_iteration_statement, ALT = 0, SLOTS = 8 };
+        CppAstRef kw_for;
+        CppAstRef op_lparen;
+        CppAstRef for_init_statement;
+        CppAstRef condition;  // or EMPTY_AST
+        CppAstRef op_semicolon;
+        CppAstRef expression;  // or EMPTY_AST
+        CppAstRef op_rparen;
+        CppAstRef statement;
+    };
+
+    // iteration-statement: KW_FOR OP_LPAREN for-range-declaration OP_COLON for-range-initializer OP_RPAREN statement
+    struct Ast_iteration_statement_1 {
+        enum { RULE = RULE_iteration_statement, ALT = 1, SLOTS = 7 };
+        CppAstRef kw_for;
+        CppAstRef op_lparen;
+        CppAstRef for_range_declaration;
+        CppAstRef op_colon;
+        CppAstRef for_range_initializer;
+        CppAstRef op_rparen;
+        CppAstRef statement;
+    };
+
+    // iteration-statement: KW_DO statement KW_WHILE OP_LPAREN expression OP_RPAREN OP_SEMICOLON
+    struct Ast_iteration_statement_2 {
+        enum { RULE = RULE_iteration_statement, ALT = 2, SLOTS = 7 };
+        CppAstRef kw_do;
+        CppAstRef statement;
+        CppAstRef kw_while;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+        CppAstRef op_semicolon;
+    };
+
+    // iteration-statement: KW_WHILE OP_LPAREN condition OP_RPAREN statement
+    struct Ast_iteration_statement_3 {
+        enum { RULE = RULE_iteration_statement, ALT = 3, SLOTS = 5 };
+        CppAstRef kw_while;
+        CppAstRef op_lparen;
+        CppAstRef condition;
+        CppAstRef op_rparen;
+        CppAstRef statement;
+    };
+
+    // for-init-statement: simple-declaration
+    struct Ast_for_init_statement_0 {
+        enum { RULE = RULE_for_init_statement, ALT = 0, SLOTS = 1 };
+        CppAstRef simple_declaration;
+    };
+
+    // for-init-statement: expression-statement
+    struct Ast_for_init_statement_1 {
+        enum { RULE = RULE_for_init_statement, ALT = 1, SLOTS = 1 };
+        CppAstRef expression_statement;
+    };
+
+    // for-range-declaration: attribute-specifier* decl-specifier-seq declarator
+    struct Ast_for_range_declaration_0 {
+        enum { RULE = RULE_for_range_declaration, ALT = 0, SLOTS = 3 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef declarator;
+    };
+
+    // for-range-initializer: braced-init-list
+    struct Ast_for_range_initializer_0 {
+        enum { RULE = RULE_for_range_initializer, ALT = 0, SLOTS = 1 };
+        CppAstRef braced_init_list;
+    };
+
+    // for-range-initializer: expression
+    struct Ast_for_range_initializer_1 {
+        enum { RULE = RULE_for_range_initializer, ALT = 1, SLOTS = 1 };
+        CppAstRef expression;
+    };
+
+    // jump-statement: KW_GOTO TT_IDENTIFIER OP_SEMICOLON
+    struct Ast_jump_statement_0 {
+        enum { RULE = RULE_jump_statement, ALT = 0, SLOTS = 3 };
+        CppAstRef kw_goto;
+        CppAstRef tt_identifier;
+        CppAstRef op_semicolon;
+    };
+
+    // jump-statement: KW_RETURN braced-init-list OP_SEMICOLON
+    struct Ast_jump_statement_1 {
+        enum { RULE = RULE_jump_statement, ALT = 1, SLOTS = 3 };
+        CppAstRef kw_return;
+        CppAstRef braced_init_list;
+        CppAstRef op_semicolon;
+    };
+
+    // jump-statement: KW_RETURN expression? OP_SEMICOLON
+    struct Ast_jump_statement_2 {
+        enum { RULE = RULE_jump_statement, ALT = 2, SLOTS = 3 };
+        CppAstRef kw_return;
+        CppAstRef expression;  // or EMPTY_AST
+        CppAstRef op_semicolon;
+    };
+
+    // jump-statement: KW_CONTINUE OP_SEMICOLON
+    struct Ast_jump_statement_3 {
+        enum { RULE = RULE_jump_statement, ALT = 3, SLOTS = 2 };
+        CppAstRef kw_continue;
+        CppAstRef op_semicolon;
+    };
+
+    // jump-statement: KW_BREAK OP_SEMICOLON
+    struct Ast_jump_statement_4 {
+        enum { RULE = RULE_jump_statement, ALT = 4, SLOTS = 2 };
+        CppAstRef kw_break;
+        CppAstRef op_semicolon;
+    };
+
+    // declaration-statement: block-declaration
+    struct Ast_declaration_statement_0 {
+        enum { RULE = RULE_declaration_statement, ALT = 0, SLOTS = 1 };
+        CppAstRef block_declaration;
+    };
+
+    // declaration: attribute-declaration
+    struct Ast_declaration_0 {
+        enum { RULE = RULE_declaration, ALT = 0, SLOTS = 1 };
+        CppAstRef attribute_declaration;
+    };
+
+    // declaration: empty-declaration
+    struct Ast_declaration_1 {
+        enum { RULE = RULE_declaration, ALT = 1, SLOTS = 1 };
+        CppAstRef empty_declaration;
+    };
+
+    // declaration: namespace-definition
+    struct Ast_declaration_2 {
+        enum { RULE = RULE_declaration, ALT = 2, SLOTS = 1 };
+        CppAstRef namespace_definition;
+    };
+
+    // declaration: linkage-specification
+    struct Ast_declaration_3 {
+        enum { RULE = RULE_declaration, ALT = 3, SLOTS = 1 };
+        CppAstRef linkage_specification;
+    };
+
+    // declaration: explicit-specialization
+    struct Ast_declaration_4 {
+        enum { RULE = RULE_declaration, ALT = 4, SLOTS = 1 };
+        CppAstRef explicit_specialization;
+    };
+
+    // declaration: explicit-instantiation
+    struct Ast_declaration_5 {
+        enum { RULE = RULE_declaration, ALT = 5, SLOTS = 1 };
+        CppAstRef explicit_instantiation;
+    };
+
+    // declaration: template-declaration
+    struct Ast_declaration_6 {
+        enum { RULE = RULE_declaration, ALT = 6, SLOTS = 1 };
+        CppAstRef template_declaration;
+    };
+
+    // declaration: function-definition
+    struct Ast_declaration_7 {
+        enum { RULE = RULE_declaration, ALT = 7, SLOTS = 1 };
+        CppAstRef function_definition;
+    };
+
+    // declaration: block-declaration
+    struct Ast_declaration_8 {
+        enum { RULE = RULE_declaration, ALT = 8, SLOTS = 1 };
+        CppAstRef block_declaration;
+    };
+
+    // block-declaration: opaque-enum-declaration
+    struct Ast_block_declaration_0 {
+        enum { RULE = RULE_block_declaration, ALT = 0, SLOTS = 1 };
+        CppAstRef opaque_enum_declaration;
+    };
+
+    // block-declaration: alias-declaration
+    struct Ast_block_declaration_1 {
+        enum { RULE = RULE_block_declaration, ALT = 1, SLOTS = 1 };
+        CppAstRef alias_declaration;
+    };
+
+    // block-declaration: static_assert-declaration
+    struct Ast_block_declaration_2 {
+        enum { RULE = RULE_block_declaration, ALT = 2, SLOTS = 1 };
+        CppAstRef static_assert_declaration;
+    };
+
+    // block-declaration: using-directive
+    struct Ast_block_declaration_3 {
+        enum { RULE = RULE_block_declaration, ALT = 3, SLOTS = 1 };
+        CppAstRef using_directive;
+    };
+
+    // block-declaration: using-declaration
+    struct Ast_block_declaration_4 {
+        enum { RULE = RULE_block_declaration, ALT = 4, SLOTS = 1 };
+        CppAstRef using_declaration;
+    };
+
+    // block-declaration: namespace-alias-definition
+    struct Ast_block_declaration_5 {
+        enum { RULE = RULE_block_declaration, ALT = 5, SLOTS = 1 };
+        CppAstRef namespace_alias_definition;
+    };
+
+    // block-declaration: asm-definition
+    struct Ast_block_declaration_6 {
+        enum { RULE = RULE_block_declaration, ALT = 6, SLOTS = 1 };
+        CppAstRef asm_definition;
+    };
+
+    // block-declaration: simple-declaration
+    struct Ast_block_declaration_7 {
+        enum { RULE = RULE_block_declaration, ALT = 7, SLOTS = 1 };
+        CppAstRef simple_declaration;
+    };
+
+    // alias-declaration: KW_USING TT_IDENTIFIER attribute-specifier* OP_ASS type-id OP_SEMICOLON
+    struct Ast_alias_declaration_0 {
+        enum { RULE = RULE_alias_declaration, ALT = 0, SLOTS = 6 };
+        CppAstRef kw_using;
+        CppAstRef tt_identifier;
+        CppAstRef attribute_specifier_list;
+        CppAstRef op_ass;
+        CppAstRef type_id;
+        CppAstRef op_semicolon;
+    };
+
+    // simple-declaration: attribute-specifier* decl-specifier-seq init-declarator-list? OP_SEMICOLON
+    struct Ast_simple_declaration_0 {
+        enum { RULE = RULE_simple_declaration, ALT = 0, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef init_declarator_list;  // or EMPTY_AST
+        CppAstRef op_semicolon;
+    };
+
+    // static_assert-declaration: KW_STATIC_ASSERT OP_LPAREN constant-expression OP_COMMA TT_LITERAL OP_RPAREN OP_SEMICOLON
+    struct Ast_static_assert_declaration_0 {
+        enum { RULE = RULE_static_assert_declaration, ALT = 0, SLOTS = 7 };
+        CppAstRef kw_static_assert;
+        CppAstRef op_lparen;
+        CppAstRef constant_expression;
+        CppAstRef op_comma;
+        CppAstRef tt_literal;
+        CppAstRef op_rparen;
+        CppAstRef op_semicolon;
+    };
+
+    // empty-declaration: OP_SEMICOLON
+    struct Ast_empty_declaration_0 {
+        enum { RULE = RULE_empty_declaration, ALT = 0, SLOTS = 1 };
+        CppAstRef op_semicolon;
+    };
+
+    // attribute-declaration: attribute-specifier+ OP_SEMICOLON
+    struct Ast_attribute_declaration_0 {
+        enum { RULE = RULE_attribute_declaration, ALT = 0, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef op_semicolon;
+    };
+
+    // decl-specifier: KW_CONSTEXPR
+    struct Ast_decl_specifier_0 {
+        enum { RULE = RULE_decl_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef kw_constexpr;
+    };
+
+    // decl-specifier: KW_TYPEDEF
+    struct Ast_decl_specifier_1 {
+        enum { RULE = RULE_decl_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef kw_typedef;
+    };
+
+    // decl-specifier: KW_FRIEND
+    struct Ast_decl_specifier_2 {
+        enum { RULE = RULE_decl_specifier, ALT = 2, SLOTS = 1 };
+        CppAstRef kw_friend;
+    };
+
+    // decl-specifier: function-specifier
+    struct Ast_decl_specifier_3 {
+        enum { RULE = RULE_decl_specifier, ALT = 3, SLOTS = 1 };
+        CppAstRef function_specifier;
+    };
+
+    // decl-specifier: type-specifier
+    struct Ast_decl_specifier_4 {
+        enum { RULE = RULE_decl_specifier, ALT = 4, SLOTS = 1 };
+        CppAstRef type_specifier;
+    };
+
+    // decl-specifier: storage-class-specifier
+    struct Ast_decl_specifier_5 {
+        enum { RULE = RULE_decl_specifier, ALT = 5, SLOTS = 1 };
+        CppAstRef storage_class_specifier;
+    };
+
+    // decl-specifier-seq: decl-specifier+ attribute-specifier*
+    struct Ast_decl_specifier_seq_0 {
+        enum { RULE = RULE_decl_specifier_seq, ALT = 0, SLOTS = 2 };
+        CppAstRef decl_specifier_list;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // storage-class-specifier: KW_MUTABLE
+    struct Ast_storage_class_specifier_0 {
+        enum { RULE = RULE_storage_class_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef kw_mutable;
+    };
+
+    // storage-class-specifier: KW_EXTERN
+    struct Ast_storage_class_specifier_1 {
+        enum { RULE = RULE_storage_class_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef kw_extern;
+    };
+
+    // storage-class-specifier: KW_THREAD_LOCAL
+    struct Ast_storage_class_specifier_2 {
+        enum { RULE = RULE_storage_class_specifier, ALT = 2, SLOTS = 1 };
+        CppAstRef kw_thread_local;
+    };
+
+    // storage-class-specifier: KW_STATIC
+    struct Ast_storage_class_specifier_3 {
+        enum { RULE = RULE_storage_class_specifier, ALT = 3, SLOTS = 1 };
+        CppAstRef kw_static;
+    };
+
+    // storage-class-specifier: KW_REGISTER
+    struct Ast_storage_class_specifier_4 {
+        enum { RULE = RULE_storage_class_specifier, ALT = 4, SLOTS = 1 };
+        CppAstRef kw_register;
+    };
+
+    // function-specifier: KW_EXPLICIT
+    struct Ast_function_specifier_0 {
+        enum { RULE = RULE_function_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef kw_explicit;
+    };
+
+    // function-specifier: KW_VIRTUAL
+    struct Ast_function_specifier_1 {
+        enum { RULE = RULE_function_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef kw_virtual;
+    };
+
+    // function-specifier: KW_INLINE
+    struct Ast_function_specifier_2 {
+        enum { RULE = RULE_function_specifier, ALT = 2, SLOTS = 1 };
+        CppAstRef kw_inline;
+    };
+
+    // type-specifier: enum-specifier
+    struct Ast_type_specifier_0 {
+        enum { RULE = RULE_type_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef enum_specifier;
+    };
+
+    // type-specifier: class-specifier
+    struct Ast_type_specifier_1 {
+        enum { RULE = RULE_type_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef class_specifier;
+    };
+
+    // type-specifier: trailing-type-specifier
+    struct Ast_type_specifier_2 {
+        enum { RULE = RULE_type_specifier, ALT = 2, SLOTS = 1 };
+        CppAstRef trailing_type_specifier;
+    };
+
+    // trailing-type-specifier: cv-qualifier
+    struct Ast_trailing_type_specifier_0 {
+        enum { RULE = RULE_trailing_type_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef cv_qualifier;
+    };
+
+    // trailing-type-specifier: typename-specifier
+    struct Ast_trailing_type_specifier_1 {
+        enum { RULE = RULE_trailing_type_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef typename_specifier;
+    };
+
+    // trailing-type-specifier: elaborated-type-specifier
+    struct Ast_trailing_type_specifier_2 {
+        enum { RULE = RULE_trailing_type_specifier, ALT = 2, SLOTS = 1 };
+        CppAstRef elaborated_type_specifier;
+    };
+
+    // trailing-type-specifier: simple-type-specifier
+    struct Ast_trailing_type_specifier_3 {
+        enum { RULE = RULE_trailing_type_specifier, ALT = 3, SLOTS = 1 };
+        CppAstRef simple_type_specifier;
+    };
+
+    // type-specifier-seq: type-specifier+ attribute-specifier*
+    struct Ast_type_specifier_seq_0 {
+        enum { RULE = RULE_type_specifier_seq, ALT = 0, SLOTS = 2 };
+        CppAstRef type_specifier_list;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // trailing-type-specifier-seq: trailing-type-specifier+ attribute-specifier*
+    struct Ast_trailing_type_specifier_seq_0 {
+        enum { RULE = RULE_trailing_type_specifier_seq, ALT = 0, SLOTS = 2 };
+        CppAstRef trailing_type_specifier_list;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // simple-type-specifier: nested-name-specifier KW_TEMPLATE simple-template-id
+    struct Ast_simple_type_specifier_0 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 0, SLOTS = 3 };
+        CppAstRef nested_name_specifier;
+        CppAstRef kw_template;
+        CppAstRef simple_template_id;
+    };
+
+    // simple-type-specifier: nested-name-specifier? type-name
+    struct Ast_simple_type_specifier_1 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 1, SLOTS = 2 };
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef type_name;
+    };
+
+    // simple-type-specifier: KW_CHAR
+    struct Ast_simple_type_specifier_2 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 2, SLOTS = 1 };
+        CppAstRef kw_char;
+    };
+
+    // simple-type-specifier: decltype-specifier
+    struct Ast_simple_type_specifier_3 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 3, SLOTS = 1 };
+        CppAstRef decltype_specifier;
+    };
+
+    // simple-type-specifier: KW_CHAR16_T
+    struct Ast_simple_type_specifier_4 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 4, SLOTS = 1 };
+        CppAstRef kw_char16_t;
+    };
+
+    // simple-type-specifier: KW_WCHAR_T
+    struct Ast_simple_type_specifier_5 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 5, SLOTS = 1 };
+        CppAstRef kw_wchar_t;
+    };
+
+    // simple-type-specifier: KW_AUTO
+    struct Ast_simple_type_specifier_6 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 6, SLOTS = 1 };
+        CppAstRef kw_auto;
+    };
+
+    // simple-type-specifier: KW_VOID
+    struct Ast_simple_type_specifier_7 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 7, SLOTS = 1 };
+        CppAstRef kw_void;
+    };
+
+    // simple-type-specifier: KW_DOUBLE
+    struct Ast_simple_type_specifier_8 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 8, SLOTS = 1 };
+        CppAstRef kw_double;
+    };
+
+    // simple-type-specifier: KW_FLOAT
+    struct Ast_simple_type_specifier_9 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 9, SLOTS = 1 };
+        CppAstRef kw_float;
+    };
+
+    // simple-type-specifier: KW_UNSIGNED
+    struct Ast_simple_type_specifier_10 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 10, SLOTS = 1 };
+        CppAstRef kw_unsigned;
+    };
+
+    // simple-type-specifier: KW_LONG
+    struct Ast_simple_type_specifier_11 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 11, SLOTS = 1 };
+        CppAstRef kw_long;
+    };
+
+    // simple-type-specifier: KW_SIGNED
+    struct Ast_simple_type_specifier_12 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 12, SLOTS = 1 };
+        CppAstRef kw_signed;
+    };
+
+    // simple-type-specifier: KW_INT
+    struct Ast_simple_type_specifier_13 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 13, SLOTS = 1 };
+        CppAstRef kw_int;
+    };
+
+    // simple-type-specifier: KW_SHORT
+    struct Ast_simple_type_specifier_14 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 14, SLOTS = 1 };
+        CppAstRef kw_short;
+    };
+
+    // simple-type-specifier: KW_BOOL
+    struct Ast_simple_type_specifier_15 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 15, SLOTS = 1 };
+        CppAstRef kw_bool;
+    };
+
+    // simple-type-specifier: KW_CHAR32_T
+    struct Ast_simple_type_specifier_16 {
+        enum { RULE = RULE_simple_type_specifier, ALT = 16, SLOTS = 1 };
+        CppAstRef kw_char32_t;
+    };
+
+    // decltype-specifier: KW_DECLTYPE OP_LPAREN expression OP_RPAREN
+    struct Ast_decltype_specifier_0 {
+        enum { RULE = RULE_decltype_specifier, ALT = 0, SLOTS = 4 };
+        CppAstRef kw_decltype;
+        CppAstRef op_lparen;
+        CppAstRef expression;
+        CppAstRef op_rparen;
+    };
+
+    // elaborated-type-specifier: class-key nested-name-specifier? KW_TEMPLATE? simple-template-id
+    struct Ast_elaborated_type_specifier_0 {
+        enum { RULE = RULE_elaborated_type_specifier, ALT = 0, SLOTS = 4 };
+        CppAstRef class_key;
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef kw_template;  // or EMPTY_AST
+        CppAstRef simple_template_id;
+    };
+
+    // elaborated-type-specifier: class-key attribute-specifier* nested-name-specifier? TT_IDENTIFIER
+    struct Ast_elaborated_type_specifier_1 {
+        enum { RULE = RULE_elaborated_type_specifier, ALT = 1, SLOTS = 4 };
+        CppAstRef class_key;
+        CppAstRef attribute_specifier_list;
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef tt_identifier;
+    };
+
+    // elaborated-type-specifier: KW_ENUM nested-name-specifier? TT_IDENTIFIER
+    struct Ast_elaborated_type_specifier_2 {
+        enum { RULE = RULE_elaborated_type_specifier, ALT = 2, SLOTS = 3 };
+        CppAstRef kw_enum;
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef tt_identifier;
+    };
+
+    // enum-specifier: enum-head OP_LBRACE enumerator-list OP_COMMA OP_RBRACE
+    struct Ast_enum_specifier_0 {
+        enum { RULE = RULE_enum_specifier, ALT = 0, SLOTS = 5 };
+        CppAstRef enum_head;
+        CppAstRef op_lbrace;
+        CppAstRef enumerator_list;
+        CppAstRef op_comma;
+        CppAstRef op_rbrace;
+    };
+
+    // enum-specifier: enum-head OP_LBRACE enumerator-list? OP_RBRACE
+    struct Ast_enum_specifier_1 {
+        enum { RULE = RULE_enum_specifier, ALT = 1, SLOTS = 4 };
+        CppAstRef enum_head;
+        CppAstRef op_lbrace;
+        CppAstRef enumerator_list;  // or EMPTY_AST
+        CppAstRef op_rbrace;
+    };
+
+    // enum-head: enum-key attribute-specifier* nested-name-specifier TT_IDENTIFIER enum-base?
+    struct Ast_enum_head_0 {
+        enum { RULE = RULE_enum_head, ALT = 0, SLOTS = 5 };
+        CppAstRef enum_key;
+        CppAstRef attribute_specifier_list;
+        CppAstRef nested_name_specifier;
+        CppAstRef tt_identifier;
+        CppAstRef enum_base;  // or EMPTY_AST
+    };
+
+    // enum-head: enum-key attribute-specifier* TT_IDENTIFIER? enum-base?
+    struct Ast_enum_head_1 {
+        enum { RULE = RULE_enum_head, ALT = 1, SLOTS = 4 };
+        CppAstRef enum_key;
+        CppAstRef attribute_specifier_list;
+        CppAstRef tt_identifier;  // or EMPTY_AST
+        CppAstRef enum_base;  // or EMPTY_AST
+    };
+
+    // opaque-enum-declaration: enum-key attribute-specifier* TT_IDENTIFIER enum-base? OP_SEMICOLON
+    struct Ast_opaque_enum_declaration_0 {
+        enum { RULE = RULE_opaque_enum_declaration, ALT = 0, SLOTS = 5 };
+        CppAstRef enum_key;
+        CppAstRef attribute_specifier_list;
+        CppAstRef tt_identifier;
+        CppAstRef enum_base;  // or EMPTY_AST
+        CppAstRef op_semicolon;
+    };
+
+    // enum-key: KW_ENUM KW_STRUCT
+    struct Ast_enum_key_0 {
+        enum { RULE = RULE_enum_key, ALT = 0, SLOTS = 2 };
+        CppAstRef kw_enum;
+        CppAstRef kw_struct;
+    };
+
+    // enum-key: KW_ENUM KW_CLASS
+    struct Ast_enum_key_1 {
+        enum { RULE = RULE_enum_key, ALT = 1, SLOTS = 2 };
+        CppAstRef kw_enum;
+        CppAstRef kw_class;
+    };
+
+    // enum-key: KW_ENUM
+    struct Ast_enum_key_2 {
+        enum { RULE = RULE_enum_key, ALT = 2, SLOTS = 1 };
+        CppAstRef kw_enum;
+    };
+
+    // enum-base: OP_COLON type-specifier-seq
+    struct Ast_enum_base_0 {
+        enum { RULE = RULE_enum_base, ALT = 0, SLOTS = 2 };
+        CppAstRef op_colon;
+        CppAstRef type_specifier_seq;
+    };
+
+    // enumerator-list: enumerator-definition (OP_COMMA enumerator-definition)*
+    struct Ast_enumerator_list_0 {
+        enum { RULE = RULE_enumerator_list, ALT = 0, SLOTS = 2 };
+        CppAstRef enumerator_definition;
+        CppAstRef group_1_list;  // Ast_enumerator_list_0_1 per repetition
+    };
+
+    // (OP_COMMA enumerator-definition)* in Ast_enumerator_list_0
+    struct Ast_enumerator_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef enumerator_definition;
+    };
+
+    // enumerator-definition: enumerator OP_ASS constant-expression
+    struct Ast_enumerator_definition_0 {
+        enum { RULE = RULE_enumerator_definition, ALT = 0, SLOTS = 3 };
+        CppAstRef enumerator;
+        CppAstRef op_ass;
+        CppAstRef constant_expression;
+    };
+
+    // enumerator-definition: enumerator
+    struct Ast_enumerator_definition_1 {
+        enum { RULE = RULE_enumerator_definition, ALT = 1, SLOTS = 1 };
+        CppAstRef enumerator;
+    };
+
+    // enumerator: TT_IDENTIFIER
+    struct Ast_enumerator_0 {
+        enum { RULE = RULE_enumerator, ALT = 0, SLOTS = 1 };
+        CppAstRef tt_identifier;
+    };
+
+    // namespace-definition: KW_INLINE? KW_NAMESPACE TT_IDENTIFIER? OP_LBRACE namespace-body OP_RBRACE
+    struct Ast_namespace_definition_0 {
+        enum { RULE = RULE_namespace_definition, ALT = 0, SLOTS = 6 };
+        CppAstRef kw_inline;  // or EMPTY_AST
+        CppAstRef kw_namespace;
+        CppAstRef tt_identifier;  // or EMPTY_AST
+        CppAstRef op_lbrace;
+        CppAstRef namespace_body;
+        CppAstRef op_rbrace;
+    };
+
+    // namespace-body: declaration*
+    struct Ast_namespace_body_0 {
+        enum { RULE = RULE_namespace_body, ALT = 0, SLOTS = 1 };
+        CppAstRef declaration_list;
+    };
+
+    // namespace-alias-definition: KW_NAMESPACE TT_IDENTIFIER OP_ASS qualified-namespace-specifier OP_SEMICOLON
+    struct Ast_namespace_alias_definition_0 {
+        enum { RULE = RULE_namespace_alias_definition, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_namespace;
+        CppAstRef tt_identifier;
+        CppAstRef op_ass;
+        CppAstRef qualified_namespace_specifier;
+        CppAstRef op_semicolon;
+    };
+
+    // qualified-namespace-specifier: nested-name-specifier? namespace-name
+    struct Ast_qualified_namespace_specifier_0 {
+        enum { RULE = RULE_qualified_namespace_specifier, ALT = 0, SLOTS = 2 };
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef namespace_name;
+    };
+
+    // using-declaration: KW_USING KW_TYPENAME? nested-name-specifier unqualified-id OP_SEMICOLON
+    struct Ast_using_declaration_0 {
+        enum { RULE = RULE_using_declaration, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_using;
+        CppAstRef kw_typename;  // or EMPTY_AST
+        CppAstRef nested_name_specifier;
+        CppAstRef unqualified_id;
+        CppAstRef op_semicolon;
+    };
+
+    // using-declaration: KW_USING OP_COLON2 unqualified-id OP_SEMICOLON
+    struct Ast_using_declaration_1 {
+        enum { RULE = RULE_using_declaration, ALT = 1, SLOTS = 4 };
+        CppAstRef kw_using;
+        CppAstRef op_colon2;
+        CppAstRef unqualified_id;
+        CppAstRef op_semicolon;
+    };
+
+    // using-directive: attribute-specifier* KW_USING KW_NAMESPACE nested-name-specifier? TT_IDENTIFIER OP_SEMICOLON
+    struct Ast_using_directive_0 {
+        enum { RULE = RULE_using_directive, ALT = 0, SLOTS = 6 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef kw_using;
+        CppAstRef kw_namespace;
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef tt_identifier;
+        CppAstRef op_semicolon;
+    };
+
+    // asm-definition: KW_ASM OP_LPAREN TT_LITERAL OP_RPAREN OP_SEMICOLON
+    struct Ast_asm_definition_0 {
+        enum { RULE = RULE_asm_definition, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_asm;
+        CppAstRef op_lparen;
+        CppAstRef tt_literal;
+        CppAstRef op_rparen;
+        CppAstRef op_semicolon;
+    };
+
+    // linkage-specification: KW_EXTERN TT_LITERAL OP_LBRACE declaration* OP_RBRACE
+    struct Ast_linkage_specification_0 {
+        enum { RULE = RULE_linkage_specification, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_extern;
+        CppAstRef tt_literal;
+        CppAstRef op_lbrace;
+        CppAstRef declaration_list;
+        CppAstRef op_rbrace;
+    };
+
+    // linkage-specification: KW_EXTERN TT_LITERAL declaration
+    struct Ast_linkage_specification_1 {
+        enum { RULE = RULE_linkage_specification, ALT = 1, SLOTS = 3 };
+        CppAstRef kw_extern;
+        CppAstRef tt_literal;
+        CppAstRef declaration;
+    };
+
+    // attribute-specifier: OP_LSQUARE OP_LSQUARE attribute-list OP_RSQUARE OP_RSQUARE
+    struct Ast_attribute_specifier_0 {
+        enum { RULE = RULE_attribute_specifier, ALT = 0, SLOTS = 5 };
+        CppAstRef op_lsquare;
+        CppAstRef op_lsquare_1;
+        CppAstRef attribute_list;
+        CppAstRef op_rsquare;
+        CppAstRef op_rsquare_4;
+    };
+
+    // attribute-specifier: alignment-specifier
+    struct Ast_attribute_specifier_1 {
+        enum { RULE = RULE_attribute_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef alignment_specifier;
+    };
+
+    // alignment-specifier: KW_ALIGNAS OP_LPAREN assignment-expression OP_DOTS? OP_RPAREN
+    struct Ast_alignment_specifier_0 {
+        enum { RULE = RULE_alignment_specifier, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_alignas;
+        CppAstRef op_lparen;
+        CppAstRef assignment_expression;
+        CppAstRef op_dots;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // alignment-specifier: KW_ALIGNAS OP_LPAREN type-id OP_DOTS? OP_RPAREN
+    struct Ast_alignment_specifier_1 {
+        enum { RULE = RULE_alignment_specifier, ALT = 1, SLOTS = 5 };
+        CppAstRef kw_alignas;
+        CppAstRef op_lparen;
+        CppAstRef type_id;
+        CppAstRef op_dots;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // attribute-list: attribute-part (OP_COMMA attribute-part)*
+    struct Ast_attribute_list_0 {
+        enum { RULE = RULE_attribute_list, ALT = 0, SLOTS = 2 };
+        CppAstRef attribute_part;
+        CppAstRef group_1_list;  // Ast_attribute_list_0_1 per repetition
+    };
+
+    // (OP_COMMA attribute-part)* in Ast_attribute_list_0
+    struct Ast_attribute_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef attribute_part;
+    };
+
+    // attribute-part: attribute OP_DOTS
+    struct Ast_attribute_part_0 {
+        enum { RULE = RULE_attribute_part, ALT = 0, SLOTS = 2 };
+        CppAstRef attribute;
+        CppAstRef op_dots;
+    };
+
+    // attribute-part: attribute?
+    struct Ast_attribute_part_1 {
+        enum { RULE = RULE_attribute_part, ALT = 1, SLOTS = 1 };
+        CppAstRef attribute;  // or EMPTY_AST
+    };
+
+    // attribute: attribute-token attribute-argument-clause?
+    struct Ast_attribute_0 {
+        enum { RULE = RULE_attribute, ALT = 0, SLOTS = 2 };
+        CppAstRef attribute_token;
+        CppAstRef attribute_argument_clause;  // or EMPTY_AST
+    };
+
+    // attribute-token: attribute-scoped-token
+    struct Ast_attribute_token_0 {
+        enum { RULE = RULE_attribute_token, ALT = 0, SLOTS = 1 };
+        CppAstRef attribute_scoped_token;
+    };
+
+    // attribute-token: TT_IDENTIFIER
+    struct Ast_attribute_token_1 {
+        enum { RULE = RULE_attribute_token, ALT = 1, SLOTS = 1 };
+        CppAstRef tt_identifier;
+    };
+
+    // attribute-scoped-token: attribute-namespace OP_COLON2 TT_IDENTIFIER
+    struct Ast_attribute_scoped_token_0 {
+        enum { RULE = RULE_attribute_scoped_token, ALT = 0, SLOTS = 3 };
+        CppAstRef attribute_namespace;
+        CppAstRef op_colon2;
+        CppAstRef tt_identifier;
+    };
+
+    // attribute-namespace: TT_IDENTIFIER
+    struct Ast_attribute_namespace_0 {
+        enum { RULE = RULE_attribute_namespace, ALT = 0, SLOTS = 1 };
+        CppAstRef tt_identifier;
+    };
+
+    // attribute-argument-clause: OP_LPAREN balanced-token* OP_RPAREN
+    struct Ast_attribute_argument_clause_0 {
+        enum { RULE = RULE_attribute_argument_clause, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef balanced_token_list;
+        CppAstRef op_rparen;
+    };
+
+    // balanced-token: OP_LBRACE balanced-token* OP_RBRACE
+    struct Ast_balanced_token_0 {
+        enum { RULE = RULE_balanced_token, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lbrace;
+        CppAstRef balanced_token_list;
+        CppAstRef op_rbrace;
+    };
+
+    // balanced-token: OP_LSQUARE balanced-token* OP_RSQUARE
+    struct Ast_balanced_token_1 {
+        enum { RULE = RULE_balanced_token, ALT = 1, SLOTS = 3 };
+        CppAstRef op_lsquare;
+        CppAstRef balanced_token_list;
+        CppAstRef op_rsquare;
+    };
+
+    // balanced-token: OP_LPAREN balanced-token* OP_RPAREN
+    struct Ast_balanced_token_2 {
+        enum { RULE = RULE_balanced_token, ALT = 2, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef balanced_token_list;
+        CppAstRef op_rparen;
+    };
+
+    // balanced-token: ST_NONPAREN
+    struct Ast_balanced_token_3 {
+        enum { RULE = RULE_balanced_token, ALT = 3, SLOTS = 1 };
+        CppAstRef st_nonparen;
+    };
+
+    // init-declarator-list: init-declarator (OP_COMMA init-declarator)*
+    struct Ast_init_declarator_list_0 {
+        enum { RULE = RULE_init_declarator_list, ALT = 0, SLOTS = 2 };
+        CppAstRef init_declarator;
+        CppAstRef group_1_list;  // Ast_init_declarator_list_0_1 per repetition
+    };
+
+    // (OP_COMMA init-declarator)* in Ast_init_declarator_list_0
+    struct Ast_init_declarator_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef init_declarator;
+    };
+
+    // init-declarator: declarator initializer?
+    struct Ast_init_declarator_0 {
+        enum { RULE = RULE_init_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef declarator;
+        CppAstRef initializer;  // or EMPTY_AST
+    };
+
+    // declarator: noptr-declarator trailing-return-type
+    struct Ast_declarator_0 {
+        enum { RULE = RULE_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef noptr_declarator;
+        CppAstRef trailing_return_type;
+    };
+
+    // declarator: ptr-declarator
+    struct Ast_declarator_1 {
+        enum { RULE = RULE_declarator, ALT = 1, SLOTS = 1 };
+        CppAstRef ptr_declarator;
+    };
+
+    // ptr-declarator: ptr-operator* noptr-declarator
+    struct Ast_ptr_declarator_0 {
+        enum { RULE = RULE_ptr_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef ptr_operator_list;
+        CppAstRef noptr_declarator;
+    };
+
+    // noptr-declarator: noptr-declarator-root (noptr-declarator-suffix)*
+    struct Ast_noptr_declarator_0 {
+        enum { RULE = RULE_noptr_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef noptr_declarator_root;
+        CppAstRef group_1_list;  // Ast_noptr_declarator_0_1 per repetition
+    };
+
+    // (noptr-declarator-suffix)* in Ast_noptr_declarator_0
+    struct Ast_noptr_declarator_0_1 {
+        enum { SLOTS = 1 };
+        CppAstRef noptr_declarator_suffix;
+    };
+
+    // noptr-declarator-root: OP_LPAREN ptr-declarator OP_RPAREN
+    struct Ast_noptr_declarator_root_0 {
+        enum { RULE = RULE_noptr_declarator_root, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef ptr_declarator;
+        CppAstRef op_rparen;
+    };
+
+    // noptr-declarator-root: declarator-id attribute-specifier*
+    struct Ast_noptr_declarator_root_1 {
+        enum { RULE = RULE_noptr_declarator_root, ALT = 1, SLOTS = 2 };
+        CppAstRef declarator_id;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // noptr-declarator-suffix: OP_LSQUARE constant-expression? OP_RSQUARE attribute-specifier*
+    struct Ast_noptr_declarator_suffix_0 {
+        enum { RULE = RULE_noptr_declarator_suffix, ALT = 0, SLOTS = 4 };
+        CppAstRef op_lsquare;
+        CppAstRef constant_expression;  // or EMPTY_AST
+        CppAstRef op_rsquare;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // noptr-declarator-suffix: parameters-and-qualifiers
+    struct Ast_noptr_declarator_suffix_1 {
+        enum { RULE = RULE_noptr_declarator_suffix, ALT = 1, SLOTS = 1 };
+        CppAstRef parameters_and_qualifiers;
+    };
+
+    // parameters-and-qualifiers: OP_LPAREN parameter-declaration-clause OP_RPAREN cv-qualifier* ref-qualifier? exception-specification? attribute-specifier*
+    struct Ast_parameters_and_qualifiers_0 {
+        enum { RULE = RULE_parameters_and_qualifiers, ALT = 0, SLOTS = 7 };
+        CppAstRef op_lparen;
+        CppAstRef parameter_declaration_clause;
+        CppAstRef op_rparen;
+        CppAstRef cv_qualifier_list;
+        CppAstRef ref_qualifier;  // or EMPTY_AST
+        CppAstRef exception_specification;  // or EMPTY_AST
+        CppAstRef attribute_specifier_list;
+    };
+
+    // trailing-return-type: OP_ARROW trailing-type-specifier-seq abstract-declarator?
+    struct Ast_trailing_return_type_0 {
+        enum { RULE = RULE_trailing_return_type, ALT = 0, SLOTS = 3 };
+        CppAstRef op_arrow;
+        CppAstRef trailing_type_specifier_seq;
+        CppAstRef abstract_declarator;  // or EMPTY_AST
+    };
+
+    // ptr-operator: nested-name-specifier OP_STAR attribute-specifier* cv-qualifier*
+    struct Ast_ptr_operator_0 {
+        enum { RULE = RULE_ptr_operator, ALT = 0, SLOTS = 4 };
+        CppAstRef nested_name_specifier;
+        CppAstRef op_star;
+        CppAstRef attribute_specifier_list;
+        CppAstRef cv_qualifier_list;
+    };
+
+    // ptr-operator: OP_STAR attribute-specifier* cv-qualifier*
+    struct Ast_ptr_operator_1 {
+        enum { RULE = RULE_ptr_operator, ALT = 1, SLOTS = 3 };
+        CppAstRef op_star;
+        CppAstRef attribute_specifier_list;
+        CppAstRef cv_qualifier_list;
+    };
+
+    // ptr-operator: OP_LAND attribute-specifier*
+    struct Ast_ptr_operator_2 {
+        enum { RULE = RULE_ptr_operator, ALT = 2, SLOTS = 2 };
+        CppAstRef op_land;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // ptr-operator: OP_AMP attribute-specifier*
+    struct Ast_ptr_operator_3 {
+        enum { RULE = RULE_ptr_operator, ALT = 3, SLOTS = 2 };
+        CppAstRef op_amp;
+        CppAstRef attribute_specifier_list;
+    };
+
+    // cv-qualifier: KW_VOLATILE
+    struct Ast_cv_qualifier_0 {
+        enum { RULE = RULE_cv_qualifier, ALT = 0, SLOTS = 1 };
+        CppAstRef kw_volatile;
+    };
+
+    // cv-qualifier: KW_CONST
+    struct Ast_cv_qualifier_1 {
+        enum { RULE = RULE_cv_qualifier, ALT = 1, SLOTS = 1 };
+        CppAstRef kw_const;
+    };
+
+    // ref-qualifier: OP_LAND
+    struct Ast_ref_qualifier_0 {
+        enum { RULE = RULE_ref_qualifier, ALT = 0, SLOTS = 1 };
+        CppAstRef op_land;
+    };
+
+    // ref-qualifier: OP_AMP
+    struct Ast_ref_qualifier_1 {
+        enum { RULE = RULE_ref_qualifier, ALT = 1, SLOTS = 1 };
+        CppAstRef op_amp;
+    };
+
+    // declarator-id: OP_DOTS? id-expression
+    struct Ast_declarator_id_0 {
+        enum { RULE = RULE_declarator_id, ALT = 0, SLOTS = 2 };
+        CppAstRef op_dots;  // or EMPTY_AST
+        CppAstRef id_expression;
+    };
+
+    // type-id: type-specifier-seq abstract-declarator?
+    struct Ast_type_id_0 {
+        enum { RULE = RULE_type_id, ALT = 0, SLOTS = 2 };
+        CppAstRef type_specifier_seq;
+        CppAstRef abstract_declarator;  // or EMPTY_AST
+    };
+
+    // abstract-declarator: noptr-abstract-declarator? trailing-return-type
+    struct Ast_abstract_declarator_0 {
+        enum { RULE = RULE_abstract_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef noptr_abstract_declarator;  // or EMPTY_AST
+        CppAstRef trailing_return_type;
+    };
+
+    // abstract-declarator: abstract-pack-declarator
+    struct Ast_abstract_declarator_1 {
+        enum { RULE = RULE_abstract_declarator, ALT = 1, SLOTS = 1 };
+        CppAstRef abstract_pack_declarator;
+    };
+
+    // abstract-declarator: ptr-abstract-declarator
+    struct Ast_abstract_declarator_2 {
+        enum { RULE = RULE_abstract_declarator, ALT = 2, SLOTS = 1 };
+        CppAstRef ptr_abstract_declarator;
+    };
+
+    // ptr-abstract-declarator: ptr-operator* noptr-abstract-declarator
+    struct Ast_ptr_abstract_declarator_0 {
+        enum { RULE = RULE_ptr_abstract_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef ptr_operator_list;
+        CppAstRef noptr_abstract_declarator;
+    };
+
+    // ptr-abstract-declarator: ptr-operator+
+    struct Ast_ptr_abstract_declarator_1 {
+        enum { RULE = RULE_ptr_abstract_declarator, ALT = 1, SLOTS = 1 };
+        CppAstRef ptr_operator_list;
+    };
+
+    // noptr-abstract-declarator: noptr-abstract-declarator-root noptr-declarator-suffix*
+    struct Ast_noptr_abstract_declarator_0 {
+        enum { RULE = RULE_noptr_abstract_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef noptr_abstract_declarator_root;
+        CppAstRef noptr_declarator_suffix_list;
+    };
+
+    // noptr-abstract-declarator: noptr-declarator-suffix+
+    struct Ast_noptr_abstract_declarator_1 {
+        enum { RULE = RULE_noptr_abstract_declarator, ALT = 1, SLOTS = 1 };
+        CppAstRef noptr_declarator_suffix_list;
+    };
+
+    // noptr-abstract-declarator-root: OP_LPAREN ptr-abstract-declarator OP_RPAREN
+    struct Ast_noptr_abstract_declarator_root_0 {
+        enum { RULE = RULE_noptr_abstract_declarator_root, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef ptr_abstract_declarator;
+        CppAstRef op_rparen;
+    };
+
+    // noptr-abstract-declarator-root: noptr-declarator-suffix
+    struct Ast_noptr_abstract_declarator_root_1 {
+        enum { RULE = RULE_noptr_abstract_declarator_root, ALT = 1, SLOTS = 1 };
+        CppAstRef noptr_declarator_suffix;
+    };
+
+    // abstract-pack-declarator: ptr-operator* noptr-abstract-pack-declarator
+    struct Ast_abstract_pack_declarator_0 {
+        enum { RULE = RULE_abstract_pack_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef ptr_operator_list;
+        CppAstRef noptr_abstract_pack_declarator;
+    };
+
+    // noptr-abstract-pack-declarator: OP_DOTS noptr-declarator-suffix*
+    struct Ast_noptr_abstract_pack_declarator_0 {
+        enum { RULE = RULE_noptr_abstract_pack_declarator, ALT = 0, SLOTS = 2 };
+        CppAstRef op_dots;
+        CppAstRef noptr_declarator_suffix_list;
+    };
+
+    // parameter-declaration-clause: parameter-declaration-list OP_COMMA OP_DOTS
+    struct Ast_parameter_declaration_clause_0 {
+        enum { RULE = RULE_parameter_declaration_clause, ALT = 0, SLOTS = 3 };
+        CppAstRef parameter_declaration_list;
+        CppAstRef op_comma;
+        CppAstRef op_dots;
+    };
+
+    // parameter-declaration-clause: parameter-declaration-list? OP_DOTS?
+    struct Ast_parameter_declaration_clause_1 {
+        enum { RULE = RULE_parameter_declaration_clause, ALT = 1, SLOTS = 2 };
+        CppAstRef parameter_declaration_list;  // or EMPTY_AST
+        CppAstRef op_dots;  // or EMPTY_AST
+    };
+
+    // parameter-declaration-list: parameter-declaration (OP_COMMA parameter-declaration)*
+    struct Ast_parameter_declaration_list_0 {
+        enum { RULE = RULE_parameter_declaration_list, ALT = 0, SLOTS = 2 };
+        CppAstRef parameter_declaration;
+        CppAstRef group_1_list;  // Ast_parameter_declaration_list_0_1 per repetition
+    };
+
+    // (OP_COMMA parameter-declaration)* in Ast_parameter_declaration_list_0
+    struct Ast_parameter_declaration_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef parameter_declaration;
+    };
+
+    // parameter-declaration: attribute-specifier* decl-specifier-seq declarator (OP_ASS initializer-clause)?
+    struct Ast_parameter_declaration_0 {
+        enum { RULE = RULE_parameter_declaration, ALT = 0, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef declarator;
+        CppAstRef group_3;  // Ast_parameter_declaration_0_3 or nothing
+    };
+
+    // (OP_ASS initializer-clause)? in Ast_parameter_declaration_0
+    struct Ast_parameter_declaration_0_3 {
+        enum { SLOTS = 2 };
+        CppAstRef op_ass;
+        CppAstRef initializer_clause;
+    };
+
+    // parameter-declaration: attribute-specifier* decl-specifier-seq abstract-declarator? (OP_ASS initializer-clause)?
+    struct Ast_parameter_declaration_1 {
+        enum { RULE = RULE_parameter_declaration, ALT = 1, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef abstract_declarator;  // or EMPTY_AST
+        CppAstRef group_3;  // Ast_parameter_declaration_1_3 or nothing
+    };
+
+    // (OP_ASS initializer-clause)? in Ast_parameter_declaration_1
+    struct Ast_parameter_declaration_1_3 {
+        enum { SLOTS = 2 };
+        CppAstRef op_ass;
+        CppAstRef initializer_clause;
+    };
+
+    // function-definition: attribute-specifier* decl-specifier-seq declarator virt-specifier* function-body
+    struct Ast_function_definition_0 {
+        enum { RULE = RULE_function_definition, ALT = 0, SLOTS = 5 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef declarator;
+        CppAstRef virt_specifier_list;
+        CppAstRef function_body;
+    };
+
+    // function-body: OP_ASS KW_DELETE OP_SEMICOLON
+    struct Ast_function_body_0 {
+        enum { RULE = RULE_function_body, ALT = 0, SLOTS = 3 };
+        CppAstRef op_ass;
+        CppAstRef kw_delete;
+        CppAstRef op_semicolon;
+    };
+
+    // function-body: OP_ASS KW_DEFAULT OP_SEMICOLON
+    struct Ast_function_body_1 {
+        enum { RULE = RULE_function_body, ALT = 1, SLOTS = 3 };
+        CppAstRef op_ass;
+        CppAstRef kw_default;
+        CppAstRef op_semicolon;
+    };
+
+    // function-body: ctor-initializer? compound-statement
+    struct Ast_function_body_2 {
+        enum { RULE = RULE_function_body, ALT = 2, SLOTS = 2 };
+        CppAstRef ctor_initializer;  // or EMPTY_AST
+        CppAstRef compound_statement;
+    };
+
+    // function-body: function-try-block
+    struct Ast_function_body_3 {
+        enum { RULE = RULE_function_body, ALT = 3, SLOTS = 1 };
+        CppAstRef function_try_block;
+    };
+
+    // initializer: OP_LPAREN expression-list OP_RPAREN
+    struct Ast_initializer_0 {
+        enum { RULE = RULE_initializer, ALT = 0, SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef expression_list;
+        CppAstRef op_rparen;
+    };
+
+    // initializer: brace-or-equal-initializer
+    struct Ast_initializer_1 {
+        enum { RULE = RULE_initializer, ALT = 1, SLOTS = 1 };
+        CppAstRef brace_or_equal_initializer;
+    };
+
+    // brace-or-equal-initializer: OP_ASS initializer-clause
+    struct Ast_brace_or_equal_initializer_0 {
+        enum { RULE = RULE_brace_or_equal_initializer, ALT = 0, SLOTS = 2 };
+        CppAstRef op_ass;
+        CppAstRef initializer_clause;
+    };
+
+    // brace-or-equal-initializer: braced-init-list
+    struct Ast_brace_or_equal_initializer_1 {
+        enum { RULE = RULE_brace_or_equal_initializer, ALT = 1, SLOTS = 1 };
+        CppAstRef braced_init_list;
+    };
+
+    // initializer-clause: braced-init-list
+    struct Ast_initializer_clause_0 {
+        enum { RULE = RULE_initializer_clause, ALT = 0, SLOTS = 1 };
+        CppAstRef braced_init_list;
+    };
+
+    // initializer-clause: assignment-expression
+    struct Ast_initializer_clause_1 {
+        enum { RULE = RULE_initializer_clause, ALT = 1, SLOTS = 1 };
+        CppAstRef assignment_expression;
+    };
+
+    // initializer-list: initializer-clause-dots (OP_COMMA initializer-clause-dots)*
+    struct Ast_initializer_list_0 {
+        enum { RULE = RULE_initializer_list, ALT = 0, SLOTS = 2 };
+        CppAstRef initializer_clause_dots;
+        CppAstRef group_1_list;  // Ast_initializer_list_0_1 per repetition
+    };
+
+    // (OP_COMMA initializer-clause-dots)* in Ast_initializer_list_0
+    struct Ast_initializer_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef initializer_clause_dots;
+    };
+
+    // initializer-clause-dots: initializer-clause OP_DOTS?
+    struct Ast_initializer_clause_dots_0 {
+        enum { RULE = RULE_initializer_clause_dots, ALT = 0, SLOTS = 2 };
+        CppAstRef initializer_clause;
+        CppAstRef op_dots;  // or EMPTY_AST
+    };
+
+    // braced-init-list: OP_LBRACE initializer-list OP_COMMA? OP_RBRACE
+    struct Ast_braced_init_list_0 {
+        enum { RULE = RULE_braced_init_list, ALT = 0, SLOTS = 4 };
+        CppAstRef op_lbrace;
+        CppAstRef initializer_list;
+        CppAstRef op_comma;  // or EMPTY_AST
+        CppAstRef op_rbrace;
+    };
+
+    // braced-init-list: OP_LBRACE OP_RBRACE
+    struct Ast_braced_init_list_1 {
+        enum { RULE = RULE_braced_init_list, ALT = 1, SLOTS = 2 };
+        CppAstRef op_lbrace;
+        CppAstRef op_rbrace;
+    };
+
+    // class-specifier: class-head OP_LBRACE member-specification* OP_RBRACE
+    struct Ast_class_specifier_0 {
+        enum { RULE = RULE_class_specifier, ALT = 0, SLOTS = 4 };
+        CppAstRef class_head;
+        CppAstRef op_lbrace;
+        CppAstRef member_specification_list;
+        CppAstRef op_rbrace;
+    };
+
+    // class-head: class-key attribute-specifier* class-head-name class-virt-specifier? base-clause?
+    struct Ast_class_head_0 {
+        enum { RULE = RULE_class_head, ALT = 0, SLOTS = 5 };
+        CppAstRef class_key;
+        CppAstRef attribute_specifier_list;
+        CppAstRef class_head_name;
+        CppAstRef class_virt_specifier;  // or EMPTY_AST
+        CppAstRef base_clause;  // or EMPTY_AST
+    };
+
+    // class-head: class-key attribute-specifier* base-clause?
+    struct Ast_class_head_1 {
+        enum { RULE = RULE_class_head, ALT = 1, SLOTS = 3 };
+        CppAstRef class_key;
+        CppAstRef attribute_specifier_list;
+        CppAstRef base_clause;  // or EMPTY_AST
+    };
+
+    // class-head-name: nested-name-specifier? class-name
+    struct Ast_class_head_name_0 {
+        enum { RULE = RULE_class_head_name, ALT = 0, SLOTS = 2 };
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef class_name;
+    };
+
+    // class-virt-specifier: ST_FINAL
+    struct Ast_class_virt_specifier_0 {
+        enum { RULE = RULE_class_virt_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef st_final;
+    };
+
+    // class-key: KW_UNION
+    struct Ast_class_key_0 {
+        enum { RULE = RULE_class_key, ALT = 0, SLOTS = 1 };
+        CppAstRef kw_union;
+    };
+
+    // class-key: KW_STRUCT
+    struct Ast_class_key_1 {
+        enum { RULE = RULE_class_key, ALT = 1, SLOTS = 1 };
+        CppAstRef kw_struct;
+    };
+
+    // class-key: KW_CLASS
+    struct Ast_class_key_2 {
+        enum { RULE = RULE_class_key, ALT = 2, SLOTS = 1 };
+        CppAstRef kw_class;
+    };
+
+    // member-specification: access-specifier OP_COLON
+    struct Ast_member_specification_0 {
+        enum { RULE = RULE_member_specification, ALT = 0, SLOTS = 2 };
+        CppAstRef access_specifier;
+        CppAstRef op_colon;
+    };
+
+    // member-specification: member-declaration
+    struct Ast_member_specification_1 {
+        enum { RULE = RULE_member_specification, ALT = 1, SLOTS = 1 };
+        CppAstRef member_declaration;
+    };
+
+    // member-declaration: attribute-specifier* decl-specifier-seq member-declarator-list? OP_SEMICOLON
+    struct Ast_member_declaration_0 {
+        enum { RULE = RULE_member_declaration, ALT = 0, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef decl_specifier_seq;
+        CppAstRef member_declarator_list;  // or EMPTY_AST
+        CppAstRef op_semicolon;
+    };
+
+    // member-declaration: function-definition OP_SEMICOLON?
+    struct Ast_member_declaration_1 {
+        enum { RULE = RULE_member_declaration, ALT = 1, SLOTS = 2 };
+        CppAstRef function_definition;
+        CppAstRef op_semicolon;  // or EMPTY_AST
+    };
+
+    // member-declaration: alias-declaration
+    struct Ast_member_declaration_2 {
+        enum { RULE = RULE_member_declaration, ALT = 2, SLOTS = 1 };
+        CppAstRef alias_declaration;
+    };
+
+    // member-declaration: template-declaration
+    struct Ast_member_declaration_3 {
+        enum { RULE = RULE_member_declaration, ALT = 3, SLOTS = 1 };
+        CppAstRef template_declaration;
+    };
+
+    // member-declaration: static_assert-declaration
+    struct Ast_member_declaration_4 {
+        enum { RULE = RULE_member_declaration, ALT = 4, SLOTS = 1 };
+        CppAstRef static_assert_declaration;
+    };
+
+    // member-declaration: using-declaration
+    struct Ast_member_declaration_5 {
+        enum { RULE = RULE_member_declaration, ALT = 5, SLOTS = 1 };
+        CppAstRef using_declaration;
+    };
+
+    // member-declarator-list: member-declarator (OP_COMMA member-declarator)*
+    struct Ast_member_declarator_list_0 {
+        enum { RULE = RULE_member_declarator_list, ALT = 0, SLOTS = 2 };
+        CppAstRef member_declarator;
+        CppAstRef group_1_list;  // Ast_member_declarator_list_0_1 per repetition
+    };
+
+    // (OP_COMMA member-declarator)* in Ast_member_declarator_list_0
+    struct Ast_member_declarator_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef member_declarator;
+    };
+
+    // member-declarator: TT_IDENTIFIER? attribute-specifier* OP_COLON constant-expression
+    struct Ast_member_declarator_0 {
+        enum { RULE = RULE_member_declarator, ALT = 0, SLOTS = 4 };
+        CppAstRef tt_identifier;  // or EMPTY_AST
+        CppAstRef attribute_specifier_list;
+        CppAstRef op_colon;
+        CppAstRef constant_expression;
+    };
+
+    // member-declarator: declarator brace-or-equal-initializer?
+    struct Ast_member_declarator_1 {
+        enum { RULE = RULE_member_declarator, ALT = 1, SLOTS = 2 };
+        CppAstRef declarator;
+        CppAstRef brace_or_equal_initializer;  // or EMPTY_AST
+    };
+
+    // member-declarator: declarator virt-specifier* pure-specifier?
+    struct Ast_member_declarator_2 {
+        enum { RULE = RULE_member_declarator, ALT = 2, SLOTS = 3 };
+        CppAstRef declarator;
+        CppAstRef virt_specifier_list;
+        CppAstRef pure_specifier;  // or EMPTY_AST
+    };
+
+    // virt-specifier: ST_FINAL
+    struct Ast_virt_specifier_0 {
+        enum { RULE = RULE_virt_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef st_final;
+    };
+
+    // virt-specifier: ST_OVERRIDE
+    struct Ast_virt_specifier_1 {
+        enum { RULE = RULE_virt_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef st_override;
+    };
+
+    // pure-specifier: OP_ASS ST_ZERO
+    struct Ast_pure_specifier_0 {
+        enum { RULE = RULE_pure_specifier, ALT = 0, SLOTS = 2 };
+        CppAstRef op_ass;
+        CppAstRef st_zero;
+    };
+
+    // base-clause: OP_COLON base-specifier-list
+    struct Ast_base_clause_0 {
+        enum { RULE = RULE_base_clause, ALT = 0, SLOTS = 2 };
+        CppAstRef op_colon;
+        CppAstRef base_specifier_list;
+    };
+
+    // base-specifier-list: base-specifier-dots (OP_COMMA base-specifier-dots)*
+    struct Ast_base_specifier_list_0 {
+        enum { RULE = RULE_base_specifier_list, ALT = 0, SLOTS = 2 };
+        CppAstRef base_specifier_dots;
+        CppAstRef group_1_list;  // Ast_base_specifier_list_0_1 per repetition
+    };
+
+    // (OP_COMMA base-specifier-dots)* in Ast_base_specifier_list_0
+    struct Ast_base_specifier_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef base_specifier_dots;
+    };
+
+    // base-specifier-dots: base-specifier OP_DOTS?
+    struct Ast_base_specifier_dots_0 {
+        enum { RULE = RULE_base_specifier_dots, ALT = 0, SLOTS = 2 };
+        CppAstRef base_specifier;
+        CppAstRef op_dots;  // or EMPTY_AST
+    };
+
+    // base-specifier: attribute-specifier* access-specifier KW_VIRTUAL? base-type-specifier
+    struct Ast_base_specifier_0 {
+        enum { RULE = RULE_base_specifier, ALT = 0, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef access_specifier;
+        CppAstRef kw_virtual;  // or EMPTY_AST
+        CppAstRef base_type_specifier;
+    };
+
+    // base-specifier: attribute-specifier* KW_VIRTUAL access-specifier? base-type-specifier
+    struct Ast_base_specifier_1 {
+        enum { RULE = RULE_base_specifier, ALT = 1, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef kw_virtual;
+        CppAstRef access_specifier;  // or EMPTY_AST
+        CppAstRef base_type_specifier;
+    };
+
+    // base-specifier: attribute-specifier* base-type-specifier
+    struct Ast_base_specifier_2 {
+        enum { RULE = RULE_base_specifier, ALT = 2, SLOTS = 2 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef base_type_specifier;
+    };
+
+    // class-or-decltype: nested-name-specifier? class-name
+    struct Ast_class_or_decltype_0 {
+        enum { RULE = RULE_class_or_decltype, ALT = 0, SLOTS = 2 };
+        CppAstRef nested_name_specifier;  // or EMPTY_AST
+        CppAstRef class_name;
+    };
+
+    // class-or-decltype: decltype-specifier
+    struct Ast_class_or_decltype_1 {
+        enum { RULE = RULE_class_or_decltype, ALT = 1, SLOTS = 1 };
+        CppAstRef decltype_specifier;
+    };
+
+    // base-type-specifier: class-or-decltype
+    struct Ast_base_type_specifier_0 {
+        enum { RULE = RULE_base_type_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef class_or_decltype;
+    };
+
+    // access-specifier: KW_PUBLIC
+    struct Ast_access_specifier_0 {
+        enum { RULE = RULE_access_specifier, ALT = 0, SLOTS = 1 };
+        CppAstRef kw_public;
+    };
+
+    // access-specifier: KW_PROTECTED
+    struct Ast_access_specifier_1 {
+        enum { RULE = RULE_access_specifier, ALT = 1, SLOTS = 1 };
+        CppAstRef kw_protected;
+    };
+
+    // access-specifier: KW_PRIVATE
+    struct Ast_access_specifier_2 {
+        enum { RULE = RULE_access_specifier, ALT = 2, SLOTS = 1 };
+        CppAstRef kw_private;
+    };
+
+    // conversion-function-id: KW_OPERATOR conversion-type-id
+    struct Ast_conversion_function_id_0 {
+        enum { RULE = RULE_conversion_function_id, ALT = 0, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef conversion_type_id;
+    };
+
+    // conversion-type-id: type-specifier-seq ptr-operator*
+    struct Ast_conversion_type_id_0 {
+        enum { RULE = RULE_conversion_type_id, ALT = 0, SLOTS = 2 };
+        CppAstRef type_specifier_seq;
+        CppAstRef ptr_operator_list;
+    };
+
+    // ctor-initializer: OP_COLON mem-initializer-list
+    struct Ast_ctor_initializer_0 {
+        enum { RULE = RULE_ctor_initializer, ALT = 0, SLOTS = 2 };
+        CppAstRef op_colon;
+        CppAstRef mem_initializer_list;
+    };
+
+    // mem-initializer-list: mem-initializer-dots (OP_COMMA mem-initializer-dots)*
+    struct Ast_mem_initializer_list_0 {
+        enum { RULE = RULE_mem_initializer_list, ALT = 0, SLOTS = 2 };
+        CppAstRef mem_initializer_dots;
+        CppAstRef group_1_list;  // Ast_mem_initializer_list_0_1 per repetition
+    };
+
+    // (OP_COMMA mem-initializer-dots)* in Ast_mem_initializer_list_0
+    struct Ast_mem_initializer_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef mem_initializer_dots;
+    };
+
+    // mem-initializer-dots: mem-initializer OP_DOTS?
+    struct Ast_mem_initializer_dots_0 {
+        enum { RULE = RULE_mem_initializer_dots, ALT = 0, SLOTS = 2 };
+        CppAstRef mem_initializer;
+        CppAstRef op_dots;  // or EMPTY_AST
+    };
+
+    // mem-initializer: mem-initializer-id OP_LPAREN expression-list? OP_RPAREN
+    struct Ast_mem_initializer_0 {
+        enum { RULE = RULE_mem_initializer, ALT = 0, SLOTS = 4 };
+        CppAstRef mem_initializer_id;
+        CppAstRef op_lparen;
+        CppAstRef expression_list;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // mem-initializer: mem-initializer-id braced-init-list
+    struct Ast_mem_initializer_1 {
+        enum { RULE = RULE_mem_initializer, ALT = 1, SLOTS = 2 };
+        CppAstRef mem_initializer_id;
+        CppAstRef braced_init_list;
+    };
+
+    // mem-initializer-id: TT_IDENTIFIER
+    struct Ast_mem_initializer_id_0 {
+        enum { RULE = RULE_mem_initializer_id, ALT = 0, SLOTS = 1 };
+        CppAstRef tt_identifier;
+    };
+
+    // mem-initializer-id: class-or-decltype
+    struct Ast_mem_initializer_id_1 {
+        enum { RULE = RULE_mem_initializer_id, ALT = 1, SLOTS = 1 };
+        CppAstRef class_or_decltype;
+    };
+
+    // operator-function-id: KW_OPERATOR KW_DELETE OP_LSQUARE OP_RSQUARE
+    struct Ast_operator_function_id_0 {
+        enum { RULE = RULE_operator_function_id, ALT = 0, SLOTS = 4 };
+        CppAstRef kw_operator;
+        CppAstRef kw_delete;
+        CppAstRef op_lsquare;
+        CppAstRef op_rsquare;
+    };
+
+    // operator-function-id: KW_OPERATOR KW_NEW OP_LSQUARE OP_RSQUARE
+    struct Ast_operator_function_id_1 {
+        enum { RULE = RULE_operator_function_id, ALT = 1, SLOTS = 4 };
+        CppAstRef kw_operator;
+        CppAstRef kw_new;
+        CppAstRef op_lsquare;
+        CppAstRef op_rsquare;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LPAREN OP_RPAREN
+    struct Ast_operator_function_id_2 {
+        enum { RULE = RULE_operator_function_id, ALT = 2, SLOTS = 3 };
+        CppAstRef kw_operator;
+        CppAstRef op_lparen;
+        CppAstRef op_rparen;
+    };
+
+    // operator-function-id: KW_OPERATOR ST_RSHIFT_1 ST_RSHIFT_2
+    struct Ast_operator_function_id_3 {
+        enum { RULE = RULE_operator_function_id, ALT = 3, SLOTS = 3 };
+        CppAstRef kw_operator;
+        CppAstRef st_rshift_1;
+        CppAstRef st_rshift_2;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LSQUARE OP_RSQUARE
+    struct Ast_operator_function_id_4 {
+        enum { RULE = RULE_operator_function_id, ALT = 4, SLOTS = 3 };
+        CppAstRef kw_operator;
+        CppAstRef op_lsquare;
+        CppAstRef op_rsquare;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_XORASS
+    struct Ast_operator_function_id_5 {
+        enum { RULE = RULE_operator_function_id, ALT = 5, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_xorass;
+    };
+
+    // operator-function-id: KW_OPERATOR KW_NEW
+    struct Ast_operator_function_id_6 {
+        enum { RULE = RULE_operator_function_id, ALT = 6, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef kw_new;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_PLUS
+    struct Ast_operator_function_id_7 {
+        enum { RULE = RULE_operator_function_id, ALT = 7, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_plus;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_ARROW
+    struct Ast_operator_function_id_8 {
+        enum { RULE = RULE_operator_function_id, ALT = 8, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_arrow;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_ARROWSTAR
+    struct Ast_operator_function_id_9 {
+        enum { RULE = RULE_operator_function_id, ALT = 9, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_arrowstar;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_COMMA
+    struct Ast_operator_function_id_10 {
+        enum { RULE = RULE_operator_function_id, ALT = 10, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_comma;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_DEC
+    struct Ast_operator_function_id_11 {
+        enum { RULE = RULE_operator_function_id, ALT = 11, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_dec;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_INC
+    struct Ast_operator_function_id_12 {
+        enum { RULE = RULE_operator_function_id, ALT = 12, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_inc;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_STAR
+    struct Ast_operator_function_id_13 {
+        enum { RULE = RULE_operator_function_id, ALT = 13, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_star;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LAND
+    struct Ast_operator_function_id_14 {
+        enum { RULE = RULE_operator_function_id, ALT = 14, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_land;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_GE
+    struct Ast_operator_function_id_15 {
+        enum { RULE = RULE_operator_function_id, ALT = 15, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_ge;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LE
+    struct Ast_operator_function_id_16 {
+        enum { RULE = RULE_operator_function_id, ALT = 16, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_le;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_NE
+    struct Ast_operator_function_id_17 {
+        enum { RULE = RULE_operator_function_id, ALT = 17, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_ne;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_EQ
+    struct Ast_operator_function_id_18 {
+        enum { RULE = RULE_operator_function_id, ALT = 18, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_eq;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LSHIFTASS
+    struct Ast_operator_function_id_19 {
+        enum { RULE = RULE_operator_function_id, ALT = 19, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_lshiftass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_RSHIFTASS
+    struct Ast_operator_function_id_20 {
+        enum { RULE = RULE_operator_function_id, ALT = 20, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_rshiftass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_AMP
+    struct Ast_operator_function_id_21 {
+        enum { RULE = RULE_operator_function_id, ALT = 21, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_amp;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LSHIFT
+    struct Ast_operator_function_id_22 {
+        enum { RULE = RULE_operator_function_id, ALT = 22, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_lshift;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_BORASS
+    struct Ast_operator_function_id_23 {
+        enum { RULE = RULE_operator_function_id, ALT = 23, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_borass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_BANDASS
+    struct Ast_operator_function_id_24 {
+        enum { RULE = RULE_operator_function_id, ALT = 24, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_bandass;
+    };
+
+    // operator-function-id: KW_OPERATOR KW_DELETE
+    struct Ast_operator_function_id_25 {
+        enum { RULE = RULE_operator_function_id, ALT = 25, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef kw_delete;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_MODASS
+    struct Ast_operator_function_id_26 {
+        enum { RULE = RULE_operator_function_id, ALT = 26, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_modass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_DIVASS
+    struct Ast_operator_function_id_27 {
+        enum { RULE = RULE_operator_function_id, ALT = 27, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_divass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_MINUSASS
+    struct Ast_operator_function_id_28 {
+        enum { RULE = RULE_operator_function_id, ALT = 28, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_minusass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LOR
+    struct Ast_operator_function_id_29 {
+        enum { RULE = RULE_operator_function_id, ALT = 29, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_lor;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_PLUSASS
+    struct Ast_operator_function_id_30 {
+        enum { RULE = RULE_operator_function_id, ALT = 30, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_plusass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_GT
+    struct Ast_operator_function_id_31 {
+        enum { RULE = RULE_operator_function_id, ALT = 31, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_gt;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LT
+    struct Ast_operator_function_id_32 {
+        enum { RULE = RULE_operator_function_id, ALT = 32, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_lt;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_ASS
+    struct Ast_operator_function_id_33 {
+        enum { RULE = RULE_operator_function_id, ALT = 33, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_ass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_LNOT
+    struct Ast_operator_function_id_34 {
+        enum { RULE = RULE_operator_function_id, ALT = 34, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_lnot;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_COMPL
+    struct Ast_operator_function_id_35 {
+        enum { RULE = RULE_operator_function_id, ALT = 35, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_compl;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_STARASS
+    struct Ast_operator_function_id_36 {
+        enum { RULE = RULE_operator_function_id, ALT = 36, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_starass;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_BOR
+    struct Ast_operator_function_id_37 {
+        enum { RULE = RULE_operator_function_id, ALT = 37, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_bor;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_XOR
+    struct Ast_operator_function_id_38 {
+        enum { RULE = RULE_operator_function_id, ALT = 38, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_xor;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_MOD
+    struct Ast_operator_function_id_39 {
+        enum { RULE = RULE_operator_function_id, ALT = 39, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_mod;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_DIV
+    struct Ast_operator_function_id_40 {
+        enum { RULE = RULE_operator_function_id, ALT = 40, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_div;
+    };
+
+    // operator-function-id: KW_OPERATOR OP_MINUS
+    struct Ast_operator_function_id_41 {
+        enum { RULE = RULE_operator_function_id, ALT = 41, SLOTS = 2 };
+        CppAstRef kw_operator;
+        CppAstRef op_minus;
+    };
+
+    // literal-operator-id: KW_OPERATOR ST_EMPTYSTR TT_IDENTIFIER
+    struct Ast_literal_operator_id_0 {
+        enum { RULE = RULE_literal_operator_id, ALT = 0, SLOTS = 3 };
+        CppAstRef kw_operator;
+        CppAstRef st_emptystr;
+        CppAstRef tt_identifier;
+    };
+
+    // template-declaration: KW_TEMPLATE ST_LT template-parameter-list ST_GT declaration
+    struct Ast_template_declaration_0 {
+        enum { RULE = RULE_template_declaration, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_template;
+        CppAstRef st_lt;
+        CppAstRef template_parameter_list;
+        CppAstRef st_gt;
+        CppAstRef declaration;
+    };
+
+    // template-parameter-list: template-parameter (OP_COMMA template-parameter)*
+    struct Ast_template_parameter_list_0 {
+        enum { RULE = RULE_template_parameter_list, ALT = 0, SLOTS = 2 };
+        CppAstRef template_parameter;
+        CppAstRef group_1_list;  // Ast_template_parameter_list_0_1 per repetition
+    };
+
+    // (OP_COMMA template-parameter)* in Ast_template_parameter_list_0
+    struct Ast_template_parameter_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef template_parameter;
+    };
+
+    // template-parameter: parameter-declaration
+    struct Ast_template_parameter_0 {
+        enum { RULE = RULE_template_parameter, ALT = 0, SLOTS = 1 };
+        CppAstRef parameter_declaration;
+    };
+
+    // template-parameter: type-parameter
+    struct Ast_template_parameter_1 {
+        enum { RULE = RULE_template_parameter, ALT = 1, SLOTS = 1 };
+        CppAstRef type_parameter;
+    };
+
+    // type-parameter: KW_TEMPLATE ST_LT template-parameter-list ST_GT KW_CLASS TT_IDENTIFIER? OP_ASS id-expression
+    struct Ast_type_parameter_0 {
+        enum { RULE = RULE_type_parameter, ALT = 0, SLOTS = 8 };
+        CppAstRef kw_template;
+        CppAstRef st_lt;
+        CppAstRef template_parameter_list;
+        CppAstRef st_gt;
+        CppAstRef kw_class;
+        CppAstRef tt_identifier;  // or EMPTY_AST
+        CppAstRef op_ass;
+        CppAstRef id_expression;
+    };
+
+    // type-parameter: KW_TEMPLATE ST_LT template-parameter-list ST_GT KW_CLASS OP_DOTS? TT_IDENTIFIER?
+    struct Ast_type_parameter_1 {
+        enum { RULE = RULE_type_parameter, ALT = 1, SLOTS = 7 };
+        CppAstRef kw_template;
+        CppAstRef st_lt;
+        CppAstRef template_parameter_list;
+        CppAstRef st_gt;
+        CppAstRef kw_class;
+        CppAstRef op_dots;  // or EMPTY_AST
+        CppAstRef tt_identifier;  // or EMPTY_AST
+    };
+
+    // type-parameter: KW_TYPENAME TT_IDENTIFIER? OP_ASS type-id
+    struct Ast_type_parameter_2 {
+        enum { RULE = RULE_type_parameter, ALT = 2, SLOTS = 4 };
+        CppAstRef kw_typename;
+        CppAstRef tt_identifier;  // or EMPTY_AST
+        CppAstRef op_ass;
+        CppAstRef type_id;
+    };
+
+    // type-parameter: KW_CLASS TT_IDENTIFIER? OP_ASS type-id
+    struct Ast_type_parameter_3 {
+        enum { RULE = RULE_type_parameter, ALT = 3, SLOTS = 4 };
+        CppAstRef kw_class;
+        CppAstRef tt_identifier;  // or EMPTY_AST
+        CppAstRef op_ass;
+        CppAstRef type_id;
+    };
+
+    // type-parameter: KW_TYPENAME OP_DOTS? TT_IDENTIFIER?
+    struct Ast_type_parameter_4 {
+        enum { RULE = RULE_type_parameter, ALT = 4, SLOTS = 3 };
+        CppAstRef kw_typename;
+        CppAstRef op_dots;  // or EMPTY_AST
+        CppAstRef tt_identifier;  // or EMPTY_AST
+    };
+
+    // type-parameter: KW_CLASS OP_DOTS? TT_IDENTIFIER?
+    struct Ast_type_parameter_5 {
+        enum { RULE = RULE_type_parameter, ALT = 5, SLOTS = 3 };
+        CppAstRef kw_class;
+        CppAstRef op_dots;  // or EMPTY_AST
+        CppAstRef tt_identifier;  // or EMPTY_AST
+    };
+
+    // template-id: literal-operator-id ST_LT template-argument-list? ST_GT
+    struct Ast_template_id_0 {
+        enum { RULE = RULE_template_id, ALT = 0, SLOTS = 4 };
+        CppAstRef literal_operator_id;
+        CppAstRef st_lt;
+        CppAstRef template_argument_list;  // or EMPTY_AST
+        CppAstRef st_gt;
+    };
+
+    // template-id: operator-function-id ST_LT template-argument-list? ST_GT
+    struct Ast_template_id_1 {
+        enum { RULE = RULE_template_id, ALT = 1, SLOTS = 4 };
+        CppAstRef operator_function_id;
+        CppAstRef st_lt;
+        CppAstRef template_argument_list;  // or EMPTY_AST
+        CppAstRef st_gt;
+    };
+
+    // template-id: simple-template-id
+    struct Ast_template_id_2 {
+        enum { RULE = RULE_template_id, ALT = 2, SLOTS = 1 };
+        CppAstRef simple_template_id;
+    };
+
+    // template-argument-list: template-argument-dots (OP_COMMA template-argument-dots)*
+    struct Ast_template_argument_list_0 {
+        enum { RULE = RULE_template_argument_list, ALT = 0, SLOTS = 2 };
+        CppAstRef template_argument_dots;
+        CppAstRef group_1_list;  // Ast_template_argument_list_0_1 per repetition
+    };
+
+    // (OP_COMMA template-argument-dots)* in Ast_template_argument_list_0
+    struct Ast_template_argument_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef template_argument_dots;
+    };
+
+    // template-argument-dots: template-argument OP_DOTS?
+    struct Ast_template_argument_dots_0 {
+        enum { RULE = RULE_template_argument_dots, ALT = 0, SLOTS = 2 };
+        CppAstRef template_argument;
+        CppAstRef op_dots;  // or EMPTY_AST
+    };
+
+    // template-argument: id-expression
+    struct Ast_template_argument_0 {
+        enum { RULE = RULE_template_argument, ALT = 0, SLOTS = 1 };
+        CppAstRef id_expression;
+    };
+
+    // template-argument: type-id
+    struct Ast_template_argument_1 {
+        enum { RULE = RULE_template_argument, ALT = 1, SLOTS = 1 };
+        CppAstRef type_id;
+    };
+
+    // template-argument: constant-expression
+    struct Ast_template_argument_2 {
+        enum { RULE = RULE_template_argument, ALT = 2, SLOTS = 1 };
+        CppAstRef constant_expression;
+    };
+
+    // typename-specifier: KW_TYPENAME nested-name-specifier KW_TEMPLATE? simple-template-id
+    struct Ast_typename_specifier_0 {
+        enum { RULE = RULE_typename_specifier, ALT = 0, SLOTS = 4 };
+        CppAstRef kw_typename;
+        CppAstRef nested_name_specifier;
+        CppAstRef kw_template;  // or EMPTY_AST
+        CppAstRef simple_template_id;
+    };
+
+    // typename-specifier: KW_TYPENAME nested-name-specifier TT_IDENTIFIER
+    struct Ast_typename_specifier_1 {
+        enum { RULE = RULE_typename_specifier, ALT = 1, SLOTS = 3 };
+        CppAstRef kw_typename;
+        CppAstRef nested_name_specifier;
+        CppAstRef tt_identifier;
+    };
+
+    // explicit-instantiation: KW_EXTERN? KW_TEMPLATE declaration
+    struct Ast_explicit_instantiation_0 {
+        enum { RULE = RULE_explicit_instantiation, ALT = 0, SLOTS = 3 };
+        CppAstRef kw_extern;  // or EMPTY_AST
+        CppAstRef kw_template;
+        CppAstRef declaration;
+    };
+
+    // explicit-specialization: KW_TEMPLATE ST_LT ST_GT declaration
+    struct Ast_explicit_specialization_0 {
+        enum { RULE = RULE_explicit_specialization, ALT = 0, SLOTS = 4 };
+        CppAstRef kw_template;
+        CppAstRef st_lt;
+        CppAstRef st_gt;
+        CppAstRef declaration;
+    };
+
+    // try-block: KW_TRY compound-statement handler+
+    struct Ast_try_block_0 {
+        enum { RULE = RULE_try_block, ALT = 0, SLOTS = 3 };
+        CppAstRef kw_try;
+        CppAstRef compound_statement;
+        CppAstRef handler_list;
+    };
+
+    // function-try-block: KW_TRY ctor-initializer? compound-statement handler+
+    struct Ast_function_try_block_0 {
+        enum { RULE = RULE_function_try_block, ALT = 0, SLOTS = 4 };
+        CppAstRef kw_try;
+        CppAstRef ctor_initializer;  // or EMPTY_AST
+        CppAstRef compound_statement;
+        CppAstRef handler_list;
+    };
+
+    // handler: KW_CATCH OP_LPAREN exception-declaration OP_RPAREN compound-statement
+    struct Ast_handler_0 {
+        enum { RULE = RULE_handler, ALT = 0, SLOTS = 5 };
+        CppAstRef kw_catch;
+        CppAstRef op_lparen;
+        CppAstRef exception_declaration;
+        CppAstRef op_rparen;
+        CppAstRef compound_statement;
+    };
+
+    // exception-declaration: attribute-specifier* type-specifier+ attribute-specifier* declarator
+    struct Ast_exception_declaration_0 {
+        enum { RULE = RULE_exception_declaration, ALT = 0, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef type_specifier_list;
+        CppAstRef attribute_specifier_list_2;
+        CppAstRef declarator;
+    };
+
+    // exception-declaration: attribute-specifier* type-specifier+ attribute-specifier* abstract-declarator?
+    struct Ast_exception_declaration_1 {
+        enum { RULE = RULE_exception_declaration, ALT = 1, SLOTS = 4 };
+        CppAstRef attribute_specifier_list;
+        CppAstRef type_specifier_list;
+        CppAstRef attribute_specifier_list_2;
+        CppAstRef abstract_declarator;  // or EMPTY_AST
+    };
+
+    // exception-declaration: OP_DOTS
+    struct Ast_exception_declaration_2 {
+        enum { RULE = RULE_exception_declaration, ALT = 2, SLOTS = 1 };
+        CppAstRef op_dots;
+    };
+
+    // throw-expression: KW_THROW assignment-expression?
+    struct Ast_throw_expression_0 {
+        enum { RULE = RULE_throw_expression, ALT = 0, SLOTS = 2 };
+        CppAstRef kw_throw;
+        CppAstRef assignment_expression;  // or EMPTY_AST
+    };
+
+    // exception-specification: noexcept-specification
+    struct Ast_exception_specification_0 {
+        enum { RULE = RULE_exception_specification, ALT = 0, SLOTS = 1 };
+        CppAstRef noexcept_specification;
+    };
+
+    // exception-specification: dynamic-exception-specification
+    struct Ast_exception_specification_1 {
+        enum { RULE = RULE_exception_specification, ALT = 1, SLOTS = 1 };
+        CppAstRef dynamic_exception_specification;
+    };
+
+    // dynamic-exception-specification: KW_THROW OP_LPAREN type-id-list? OP_RPAREN
+    struct Ast_dynamic_exception_specification_0 {
+        enum { RULE = RULE_dynamic_exception_specification, ALT = 0, SLOTS = 4 };
+        CppAstRef kw_throw;
+        CppAstRef op_lparen;
+        CppAstRef type_id_list;  // or EMPTY_AST
+        CppAstRef op_rparen;
+    };
+
+    // type-id-list: type-id-dots (OP_COMMA type-id-dots)*
+    struct Ast_type_id_list_0 {
+        enum { RULE = RULE_type_id_list, ALT = 0, SLOTS = 2 };
+        CppAstRef type_id_dots;
+        CppAstRef group_1_list;  // Ast_type_id_list_0_1 per repetition
+    };
+
+    // (OP_COMMA type-id-dots)* in Ast_type_id_list_0
+    struct Ast_type_id_list_0_1 {
+        enum { SLOTS = 2 };
+        CppAstRef op_comma;
+        CppAstRef type_id_dots;
+    };
+
+    // type-id-dots: type-id OP_DOTS?
+    struct Ast_type_id_dots_0 {
+        enum { RULE = RULE_type_id_dots, ALT = 0, SLOTS = 2 };
+        CppAstRef type_id;
+        CppAstRef op_dots;  // or EMPTY_AST
+    };
+
+    // noexcept-specification: KW_NOEXCEPT (OP_LPAREN constant-expression OP_RPAREN)?
+    struct Ast_noexcept_specification_0 {
+        enum { RULE = RULE_noexcept_specification, ALT = 0, SLOTS = 2 };
+        CppAstRef kw_noexcept;
+        CppAstRef group_1;  // Ast_noexcept_specification_0_1 or nothing
+    };
+
+    // (OP_LPAREN constant-expression OP_RPAREN)? in Ast_noexcept_specification_0
+    struct Ast_noexcept_specification_0_1 {
+        enum { SLOTS = 3 };
+        CppAstRef op_lparen;
+        CppAstRef constant_expression;
+        CppAstRef op_rparen;
+    };
+
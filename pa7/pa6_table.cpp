@@ -0,0 +1,2409 @@
+    // generated by gram_gen -table, the grammar for tableparse.cpp
+    // 197 rules, 465 alternatives; 542 (rule, terminal) pairs start more than one alternative
+
+    enum RuleId {
+        RULE_translation_unit,
+        RULE_primary_expression,
+        RULE_type_name,
+        RULE_class_name,
+        RULE_enum_name,
+        RULE_namespace_name,
+        RULE_template_name,
+        RULE_typedef_name,
+        RULE_simple_template_id,
+        RULE_id_expression,
+        RULE_unqualified_id,
+        RULE_qualified_id,
+        RULE_nested_name_specifier,
+        RULE_nested_name_specifier_root,
+        RULE_nested_name_specifier_suffix,
+        RULE_lambda_expression,
+        RULE_lambda_introducer,
+        RULE_lambda_capture,
+        RULE_capture_default,
+        RULE_capture_list,
+        RULE_capture,
+        RULE_lambda_declarator,
+        RULE_postfix_expression,
+        RULE_postfix_root,
+        RULE_postfix_suffix,
+        RULE_expression_list,
+        RULE_pseudo_destructor_name,
+        RULE_unary_expression,
+        RULE_unary_operator,
+        RULE_new_expression,
+        RULE_new_placement,
+        RULE_new_type_id,
+        RULE_new_declarator,
+        RULE_noptr_new_declarator,
+        RULE_new_initializer,
+        RULE_delete_expression,
+        RULE_noexcept_expression,
+        RULE_cast_expression,
+        RULE_cast_operator,
+        RULE_pm_expression,
+        RULE_pm_operator,
+        RULE_multiplicative_expression,
+        RULE_multiplicative_operator,
+        RULE_additive_expression,
+        RULE_additive_operator,
+        RULE_shift_expression,
+        RULE_shift_operator,
+        RULE_relational_expression,
+        RULE_relational_operator,
+        RULE_equality_expression,
+        RULE_equality_operator,
+        RULE_and_expression,
+        RULE_exclusive_or_expression,
+        RULE_inclusive_or_expression,
+        RULE_logical_and_expression,
+        RULE_logical_or_expression,
+        RULE_conditional_expression,
+        RULE_assignment_expression,
+        RULE_assignment_operator,
+        RULE_expression,
+        RULE_constant_expression,
+        RULE_statement,
+        RULE_labeled_statement,
+        RULE_expression_statement,
+        RULE_compound_statement,
+        RULE_selection_statement,
+        RULE_condition_declaration,
+        RULE_condition,
+        RULE_iteration_statement,
+        RULE_for_init_statement,
+        RULE_for_range_declaration,
+        RULE_for_range_initializer,
+        RULE_jump_statement,
+        RULE_declaration_statement,
+        RULE_declaration,
+        RULE_block_declaration,
+        RULE_alias_declaration,
+        RULE_simple_declaration,
+        RULE_static_assert_declaration,
+        RULE_empty_declaration,
+        RULE_attribute_declaration,
+        RULE_decl_specifier,
+        RULE_decl_specifier_seq,
+        RULE_storage_class_specifier,
+        RULE_function_specifier,
+        RULE_type_specifier,
+        RULE_trailing_type_specifier,
+        RULE_type_specifier_seq,
+        RULE_trailing_type_specifier_seq,
+        RULE_simple_type_specifier,
+        RULE_decltype_specifier,
+        RULE_elaborated_type_specifier,
+        RULE_enum_specifier,
+        RULE_enum_head,
+        RULE_opaque_enum_declaration,
+        RULE_enum_key,
+        RULE_enum_base,
+        RULE_enumerator_list,
+        RULE_enumerator_definition,
+        RULE_enumerator,
+        RULE_namespace_definition,
+        RULE_namespace_body,
+        RULE_namespace_alias_definition,
+        RULE_qualified_namespace_specifier,
+        RULE_using_declaration,
+        RULE_using_directive,
+        RULE_asm_definition,
+        RULE_linkage_specification,
+        RULE_attribute_specifier,
+        RULE_alignment_specifier,
+        RULE_attribute_list,
+        RULE_attribute_part,
+        RULE_attribute,
+        RULE_attribute_token,
+        RULE_attribute_scoped_token,
+        RULE_attribute_namespace,
+        RULE_attribute_argument_clause,
+        RULE_balanced_token,
+        RULE_init_declarator_list,
+        RULE_init_declarator,
+        RULE_declarator,
+        RULE_ptr_declarator,
+        RULE_noptr_declarator,
+        RULE_noptr_declarator_root,
+        RULE_noptr_declarator_suffix,
+        RULE_parameters_and_qualifiers,
+        RULE_trailing_return_type,
+        RULE_ptr_operator,
+        RULE_cv_qualifier,
+        RULE_ref_qualifier,
+        RULE_declarator_id,
+        RULE_type_id,
+        RULE_abstract_declarator,
+        RULE_ptr_abstract_declarator,
+        RULE_noptr_abstract_declarator,
+        RULE_noptr_abstract_declarator_root,
+        RULE_abstract_pack_declarator,
+        RULE_noptr_abstract_pack_declarator,
+        RULE_parameter_declaration_clause,
+        RULE_parameter_declaration_list,
+        RULE_parameter_declaration,
+        RULE_function_definition,
+        RULE_function_body,
+        RULE_initializer,
+        RULE_brace_or_equal_initializer,
+        RULE_initializer_clause,
+        RULE_initializer_list,
+        RULE_initializer_clause_dots,
+        RULE_braced_init_list,
+        RULE_class_specifier,
+        RULE_class_head,
+        RULE_class_head_name,
+        RULE_class_virt_specifier,
+        RULE_class_key,
+        RULE_member_specification,
+        RULE_member_declaration,
+        RULE_member_declarator_list,
+        RULE_member_declarator,
+        RULE_virt_specifier,
+        RULE_pure_specifier,
+        RULE_base_clause,
+        RULE_base_specifier_list,
+        RULE_base_specifier_dots,
+        RULE_base_specifier,
+        RULE_class_or_decltype,
+        RULE_base_type_specifier,
+        RULE_access_specifier,
+        RULE_conversion_function_id,
+        RULE_conversion_type_id,
+        RULE_ctor_initializer,
+        RULE_mem_initializer_list,
+        RULE_mem_initializer_dots,
+        RULE_mem_initializer,
+        RULE_mem_initializer_id,
+        RULE_operator_function_id,
+        RULE_literal_operator_id,
+        RULE_template_declaration,
+        RULE_template_parameter_list,
+        RULE_template_parameter,
+        RULE_type_parameter,
+        RULE_template_id,
+        RULE_template_argument_list,
+        RULE_template_argument_dots,
+        RULE_template_argument,
+        RULE_typename_specifier,
+        RULE_explicit_instantiation,
+        RULE_explicit_specialization,
+        RULE_try_block,
+        RULE_function_try_block,
+        RULE_handler,
+        RULE_exception_declaration,
+        RULE_throw_expression,
+        RULE_exception_specification,
+        RULE_dynamic_exception_specification,
+        RULE_type_id_list,
+        RULE_type_id_dots,
+        RULE_noexcept_specification,
+        RULE_COUNT
+    };
+
+    static const TableRule* tableRules()
+    {
+        static const TableRule rules[] = {
+            { "translation-unit", 0, 1, 0, 0 }, // RULE_translation_unit
+            { "primary-expression", 1, 8, 1, 0 }, // RULE_primary_expression
+            { "type-name", 9, 4, 10, 0 }, // RULE_type_name
+            { "class-name", 13, 2, 14, 0 }, // RULE_class_name
+            { "enum-name", 15, 1, 13, 0 }, // RULE_enum_name
+            { "namespace-name", 16, 1, 16, 0 }, // RULE_namespace_name
+            { "template-name", 17, 1, 11, 0 }, // RULE_template_name
+            { "typedef-name", 18, 1, 12, 0 }, // RULE_typedef_name
+            { "simple-template-id", 19, 1, 11, 0 }, // RULE_simple_template_id
+            { "id-expression", 20, 2, 4, 0 }, // RULE_id_expression
+            { "unqualified-id", 22, 7, 18, 0 }, // RULE_unqualified_id
+            { "qualified-id", 29, 1, 17, 0 }, // RULE_qualified_id
+            { "nested-name-specifier", 30, 1, 17, 0 }, // RULE_nested_name_specifier
+            { "nested-name-specifier-root", 31, 4, 17, 0 }, // RULE_nested_name_specifier_root
+            { "nested-name-specifier-suffix", 35, 2, 25, 0 }, // RULE_nested_name_specifier_suffix
+            { "lambda-expression", 37, 1, 3, 0 }, // RULE_lambda_expression
+            { "lambda-introducer", 38, 1, 3, 0 }, // RULE_lambda_introducer
+            { "lambda-capture", 39, 3, 27, 0 }, // RULE_lambda_capture
+            { "capture-default", 42, 2, 28, 0 }, // RULE_capture_default
+            { "capture-list", 44, 1, 29, 0 }, // RULE_capture_list
+            { "capture", 45, 3, 29, 0 }, // RULE_capture
+            { "lambda-declarator", 48, 1, 2, 0 }, // RULE_lambda_declarator
+            { "postfix-expression", 49, 1, 32, 0 }, // RULE_postfix_expression
+            { "postfix-root", 50, 11, 32, 0 }, // RULE_postfix_root
+            { "postfix-suffix", 61, 9, 40, 0 }, // RULE_postfix_suffix
+            { "expression-list", 70, 1, 45, 0 }, // RULE_expression_list
+            { "pseudo-destructor-name", 71, 2, 46, 0 }, // RULE_pseudo_destructor_name
+            { "unary-expression", 73, 9, 47, 0 }, // RULE_unary_expression
+            { "unary-operator", 82, 8, 50, 0 }, // RULE_unary_operator
+            { "new-expression", 90, 2, 52, 0 }, // RULE_new_expression
+            { "new-placement", 92, 1, 2, 0 }, // RULE_new_placement
+            { "new-type-id", 93, 1, 58, 0 }, // RULE_new_type_id
+            { "new-declarator", 94, 2, 59, 0 }, // RULE_new_declarator
+            { "noptr-new-declarator", 96, 1, 3, 0 }, // RULE_noptr_new_declarator
+            { "new-initializer", 97, 2, 61, 0 }, // RULE_new_initializer
+            { "delete-expression", 99, 2, 51, 0 }, // RULE_delete_expression
+            { "noexcept-expression", 101, 1, 53, 0 }, // RULE_noexcept_expression
+            { "cast-expression", 102, 2, 47, 0 }, // RULE_cast_expression
+            { "cast-operator", 104, 1, 2, 0 }, // RULE_cast_operator
+            { "pm-expression", 105, 1, 47, 0 }, // RULE_pm_expression
+            { "pm-operator", 106, 2, 63, 0 }, // RULE_pm_operator
+            { "multiplicative-expression", 108, 1, 47, 0 }, // RULE_multiplicative_expression
+            { "multiplicative-operator", 109, 3, 66, 0 }, // RULE_multiplicative_operator
+            { "additive-expression", 112, 1, 47, 0 }, // RULE_additive_expression
+            { "additive-operator", 113, 2, 69, 0 }, // RULE_additive_operator
+            { "shift-expression", 115, 1, 47, 0 }, // RULE_shift_expression
+            { "shift-operator", 116, 2, 70, 0 }, // RULE_shift_operator
+            { "relational-expression", 118, 1, 47, 0 }, // RULE_relational_expression
+            { "relational-operator", 119, 4, 73, 0 }, // RULE_relational_operator
+            { "equality-expression", 123, 1, 47, 0 }, // RULE_equality_expression
+            { "equality-operator", 124, 2, 78, 0 }, // RULE_equality_operator
+            { "and-expression", 126, 1, 47, 0 }, // RULE_and_expression
+            { "exclusive-or-expression", 127, 1, 47, 0 }, // RULE_exclusive_or_expression
+            { "inclusive-or-expression", 128, 1, 47, 0 }, // RULE_inclusive_or_expression
+            { "logical-and-expression", 129, 1, 47, 0 }, // RULE_logical_and_expression
+            { "logical-or-expression", 130, 1, 47, 0 }, // RULE_logical_or_expression
+            { "conditional-expression", 131, 1, 47, 0 }, // RULE_conditional_expression
+            { "assignment-expression", 132, 3, 81, 0 }, // RULE_assignment_expression
+            { "assignment-operator", 135, 11, 83, 0 }, // RULE_assignment_operator
+            { "expression", 146, 1, 81, 0 }, // RULE_expression
+            { "constant-expression", 147, 1, 47, 0 }, // RULE_constant_expression
+            { "statement", 148, 8, 94, 0 }, // RULE_statement
+            { "labeled-statement", 156, 3, 102, 0 }, // RULE_labeled_statement
+            { "expression-statement", 159, 1, 106, 0 }, // RULE_expression_statement
+            { "compound-statement", 160, 1, 62, 0 }, // RULE_compound_statement
+            { "selection-statement", 161, 3, 107, 0 }, // RULE_selection_statement
+            { "condition-declaration", 164, 2, 110, 0 }, // RULE_condition_declaration
+            { "condition", 166, 2, 111, 0 }, // RULE_condition
+            { "iteration-statement", 168, 4, 112, 0 }, // RULE_iteration_statement
+            { "for-init-statement", 172, 2, 116, 0 }, // RULE_for_init_statement
+            { "for-range-declaration", 174, 1, 110, 0 }, // RULE_for_range_declaration
+            { "for-range-initializer", 175, 2, 45, 0 }, // RULE_for_range_initializer
+            { "jump-statement", 177, 5, 117, 0 }, // RULE_jump_statement
+            { "declaration-statement", 182, 1, 101, 0 }, // RULE_declaration_statement
+            { "declaration", 183, 9, 122, 0 }, // RULE_declaration
+            { "block-declaration", 192, 8, 101, 0 }, // RULE_block_declaration
+            { "alias-declaration", 200, 1, 130, 0 }, // RULE_alias_declaration
+            { "simple-declaration", 201, 1, 110, 0 }, // RULE_simple_declaration
+            { "static_assert-declaration", 202, 1, 131, 0 }, // RULE_static_assert_declaration
+            { "empty-declaration", 203, 1, 124, 0 }, // RULE_empty_declaration
+            { "attribute-declaration", 204, 1, 123, 0 }, // RULE_attribute_declaration
+            { "decl-specifier", 205, 6, 135, 0 }, // RULE_decl_specifier
+            { "decl-specifier-seq", 211, 1, 135, 0 }, // RULE_decl_specifier_seq
+            { "storage-class-specifier", 212, 5, 140, 0 }, // RULE_storage_class_specifier
+            { "function-specifier", 217, 3, 139, 0 }, // RULE_function_specifier
+            { "type-specifier", 220, 3, 58, 0 }, // RULE_type_specifier
+            { "trailing-type-specifier", 223, 4, 58, 0 }, // RULE_trailing_type_specifier
+            { "type-specifier-seq", 227, 1, 58, 0 }, // RULE_type_specifier_seq
+            { "trailing-type-specifier-seq", 228, 1, 58, 0 }, // RULE_trailing_type_specifier_seq
+            { "simple-type-specifier", 229, 17, 39, 0 }, // RULE_simple_type_specifier
+            { "decltype-specifier", 246, 1, 23, 0 }, // RULE_decltype_specifier
+            { "elaborated-type-specifier", 247, 3, 150, 0 }, // RULE_elaborated_type_specifier
+            { "enum-specifier", 250, 2, 129, 0 }, // RULE_enum_specifier
+            { "enum-head", 252, 2, 129, 0 }, // RULE_enum_head
+            { "opaque-enum-declaration", 254, 1, 129, 0 }, // RULE_opaque_enum_declaration
+            { "enum-key", 255, 3, 129, 0 }, // RULE_enum_key
+            { "enum-base", 258, 1, 165, 0 }, // RULE_enum_base
+            { "enumerator-list", 259, 1, 22, 0 }, // RULE_enumerator_list
+            { "enumerator-definition", 260, 2, 22, 0 }, // RULE_enumerator_definition
+            { "enumerator", 262, 1, 22, 0 }, // RULE_enumerator
+            { "namespace-definition", 263, 1, 125, 0 }, // RULE_namespace_definition
+            { "namespace-body", 264, 1, 122, 1 }, // RULE_namespace_body
+            { "namespace-alias-definition", 265, 1, 133, 0 }, // RULE_namespace_alias_definition
+            { "qualified-namespace-specifier", 266, 1, 17, 0 }, // RULE_qualified_namespace_specifier
+            { "using-declaration", 267, 2, 130, 0 }, // RULE_using_declaration
+            { "using-directive", 269, 1, 132, 0 }, // RULE_using_directive
+            { "asm-definition", 270, 1, 134, 0 }, // RULE_asm_definition
+            { "linkage-specification", 271, 2, 126, 0 }, // RULE_linkage_specification
+            { "attribute-specifier", 273, 2, 123, 0 }, // RULE_attribute_specifier
+            { "alignment-specifier", 275, 2, 166, 0 }, // RULE_alignment_specifier
+            { "attribute-list", 277, 1, 167, 1 }, // RULE_attribute_list
+            { "attribute-part", 278, 2, 22, 1 }, // RULE_attribute_part
+            { "attribute", 280, 1, 22, 0 }, // RULE_attribute
+            { "attribute-token", 281, 2, 22, 0 }, // RULE_attribute_token
+            { "attribute-scoped-token", 283, 1, 22, 0 }, // RULE_attribute_scoped_token
+            { "attribute-namespace", 284, 1, 22, 0 }, // RULE_attribute_namespace
+            { "attribute-argument-clause", 285, 1, 2, 0 }, // RULE_attribute_argument_clause
+            { "balanced-token", 286, 4, 168, 0 }, // RULE_balanced_token
+            { "init-declarator-list", 290, 1, 170, 0 }, // RULE_init_declarator_list
+            { "init-declarator", 291, 1, 170, 0 }, // RULE_init_declarator
+            { "declarator", 292, 2, 170, 0 }, // RULE_declarator
+            { "ptr-declarator", 294, 1, 170, 0 }, // RULE_ptr_declarator
+            { "noptr-declarator", 295, 1, 171, 0 }, // RULE_noptr_declarator
+            { "noptr-declarator-root", 296, 2, 171, 0 }, // RULE_noptr_declarator_root
+            { "noptr-declarator-suffix", 298, 2, 173, 0 }, // RULE_noptr_declarator_suffix
+            { "parameters-and-qualifiers", 300, 1, 2, 0 }, // RULE_parameters_and_qualifiers
+            { "trailing-return-type", 301, 1, 41, 0 }, // RULE_trailing_return_type
+            { "ptr-operator", 302, 4, 60, 0 }, // RULE_ptr_operator
+            { "cv-qualifier", 306, 2, 149, 0 }, // RULE_cv_qualifier
+            { "ref-qualifier", 308, 2, 177, 0 }, // RULE_ref_qualifier
+            { "declarator-id", 310, 1, 172, 0 }, // RULE_declarator_id
+            { "type-id", 311, 1, 58, 0 }, // RULE_type_id
+            { "abstract-declarator", 312, 3, 178, 0 }, // RULE_abstract_declarator
+            { "ptr-abstract-declarator", 315, 2, 181, 0 }, // RULE_ptr_abstract_declarator
+            { "noptr-abstract-declarator", 317, 2, 173, 0 }, // RULE_noptr_abstract_declarator
+            { "noptr-abstract-declarator-root", 319, 2, 173, 0 }, // RULE_noptr_abstract_declarator_root
+            { "abstract-pack-declarator", 321, 1, 180, 0 }, // RULE_abstract_pack_declarator
+            { "noptr-abstract-pack-declarator", 322, 1, 182, 0 }, // RULE_noptr_abstract_pack_declarator
+            { "parameter-declaration-clause", 323, 2, 183, 1 }, // RULE_parameter_declaration_clause
+            { "parameter-declaration-list", 325, 1, 110, 0 }, // RULE_parameter_declaration_list
+            { "parameter-declaration", 326, 2, 110, 0 }, // RULE_parameter_declaration
+            { "function-definition", 328, 1, 110, 0 }, // RULE_function_definition
+            { "function-body", 329, 4, 184, 0 }, // RULE_function_body
+            { "initializer", 333, 2, 187, 0 }, // RULE_initializer
+            { "brace-or-equal-initializer", 335, 2, 188, 0 }, // RULE_brace_or_equal_initializer
+            { "initializer-clause", 337, 2, 45, 0 }, // RULE_initializer_clause
+            { "initializer-list", 339, 1, 45, 0 }, // RULE_initializer_list
+            { "initializer-clause-dots", 340, 1, 45, 0 }, // RULE_initializer_clause_dots
+            { "braced-init-list", 341, 2, 62, 0 }, // RULE_braced_init_list
+            { "class-specifier", 343, 1, 148, 0 }, // RULE_class_specifier
+            { "class-head", 344, 2, 148, 0 }, // RULE_class_head
+            { "class-head-name", 346, 1, 17, 0 }, // RULE_class_head_name
+            { "class-virt-specifier", 347, 1, 189, 0 }, // RULE_class_virt_specifier
+            { "class-key", 348, 3, 148, 0 }, // RULE_class_key
+            { "member-specification", 351, 2, 193, 0 }, // RULE_member_specification
+            { "member-declaration", 353, 6, 195, 0 }, // RULE_member_declaration
+            { "member-declarator-list", 359, 1, 196, 0 }, // RULE_member_declarator_list
+            { "member-declarator", 360, 3, 196, 0 }, // RULE_member_declarator
+            { "virt-specifier", 363, 2, 198, 0 }, // RULE_virt_specifier
+            { "pure-specifier", 365, 1, 30, 0 }, // RULE_pure_specifier
+            { "base-clause", 366, 1, 165, 0 }, // RULE_base_clause
+            { "base-specifier-list", 367, 1, 200, 0 }, // RULE_base_specifier_list
+            { "base-specifier-dots", 368, 1, 200, 0 }, // RULE_base_specifier_dots
+            { "base-specifier", 369, 3, 200, 0 }, // RULE_base_specifier
+            { "class-or-decltype", 372, 2, 17, 0 }, // RULE_class_or_decltype
+            { "base-type-specifier", 374, 1, 17, 0 }, // RULE_base_type_specifier
+            { "access-specifier", 375, 3, 194, 0 }, // RULE_access_specifier
+            { "conversion-function-id", 378, 1, 21, 0 }, // RULE_conversion_function_id
+            { "conversion-type-id", 379, 1, 58, 0 }, // RULE_conversion_type_id
+            { "ctor-initializer", 380, 1, 165, 0 }, // RULE_ctor_initializer
+            { "mem-initializer-list", 381, 1, 207, 0 }, // RULE_mem_initializer_list
+            { "mem-initializer-dots", 382, 1, 207, 0 }, // RULE_mem_initializer_dots
+            { "mem-initializer", 383, 2, 207, 0 }, // RULE_mem_initializer
+            { "mem-initializer-id", 385, 2, 207, 0 }, // RULE_mem_initializer_id
+            { "operator-function-id", 387, 42, 21, 0 }, // RULE_operator_function_id
+            { "literal-operator-id", 429, 1, 21, 0 }, // RULE_literal_operator_id
+            { "template-declaration", 430, 1, 127, 0 }, // RULE_template_declaration
+            { "template-parameter-list", 431, 1, 208, 0 }, // RULE_template_parameter_list
+            { "template-parameter", 432, 2, 208, 0 }, // RULE_template_parameter
+            { "type-parameter", 434, 6, 209, 0 }, // RULE_type_parameter
+            { "template-id", 440, 3, 20, 0 }, // RULE_template_id
+            { "template-argument-list", 443, 1, 210, 0 }, // RULE_template_argument_list
+            { "template-argument-dots", 444, 1, 210, 0 }, // RULE_template_argument_dots
+            { "template-argument", 445, 3, 210, 0 }, // RULE_template_argument
+            { "typename-specifier", 448, 2, 38, 0 }, // RULE_typename_specifier
+            { "explicit-instantiation", 450, 1, 128, 0 }, // RULE_explicit_instantiation
+            { "explicit-specialization", 451, 1, 127, 0 }, // RULE_explicit_specialization
+            { "try-block", 452, 1, 186, 0 }, // RULE_try_block
+            { "function-try-block", 453, 1, 186, 0 }, // RULE_function_try_block
+            { "handler", 454, 1, 211, 0 }, // RULE_handler
+            { "exception-declaration", 455, 3, 212, 0 }, // RULE_exception_declaration
+            { "throw-expression", 458, 1, 82, 0 }, // RULE_throw_expression
+            { "exception-specification", 459, 2, 214, 0 }, // RULE_exception_specification
+            { "dynamic-exception-specification", 461, 1, 82, 0 }, // RULE_dynamic_exception_specification
+            { "type-id-list", 462, 1, 58, 0 }, // RULE_type_id_list
+            { "type-id-dots", 463, 1, 58, 0 }, // RULE_type_id_dots
+            { "noexcept-specification", 464, 1, 53, 0 }, // RULE_noexcept_specification
+        };
+        return rules;
+    }
+
+    static const TableAlt* tableAlts()
+    {
+        static const TableAlt alts[] = {
+            { 0, 2, 0, 0 }, // translation-unit 0
+            { 2, 3, 2, 0 }, // primary-expression 0
+            { 5, 1, 3, 0 }, // primary-expression 1
+            { 6, 1, 4, 0 }, // primary-expression 2
+            { 7, 1, 5, 0 }, // primary-expression 3
+            { 8, 1, 6, 0 }, // primary-expression 4
+            { 9, 1, 7, 0 }, // primary-expression 5
+            { 10, 1, 8, 0 }, // primary-expression 6
+            { 11, 1, 9, 0 }, // primary-expression 7
+            { 12, 1, 11, 0 }, // type-name 0
+            { 13, 1, 12, 0 }, // type-name 1
+            { 14, 1, 13, 0 }, // type-name 2
+            { 15, 1, 14, 0 }, // type-name 3
+            { 16, 1, 11, 0 }, // class-name 0
+            { 17, 1, 15, 0 }, // class-name 1
+            { 18, 1, 13, 0 }, // enum-name 0
+            { 19, 1, 16, 0 }, // namespace-name 0
+            { 20, 1, 11, 0 }, // template-name 0
+            { 21, 1, 12, 0 }, // typedef-name 0
+            { 22, 4, 11, 0 }, // simple-template-id 0
+            { 26, 1, 17, 0 }, // id-expression 0
+            { 27, 1, 18, 0 }, // id-expression 1
+            { 28, 2, 19, 0 }, // unqualified-id 0
+            { 30, 2, 19, 0 }, // unqualified-id 1
+            { 32, 1, 20, 0 }, // unqualified-id 2
+            { 33, 1, 21, 0 }, // unqualified-id 3
+            { 34, 1, 21, 0 }, // unqualified-id 4
+            { 35, 1, 21, 0 }, // unqualified-id 5
+            { 36, 1, 22, 0 }, // unqualified-id 6
+            { 37, 3, 17, 0 }, // qualified-id 0
+            { 40, 2, 17, 0 }, // nested-name-specifier 0
+            { 42, 2, 23, 0 }, // nested-name-specifier-root 0
+            { 44, 2, 16, 0 }, // nested-name-specifier-root 1
+            { 46, 2, 10, 0 }, // nested-name-specifier-root 2
+            { 48, 1, 24, 0 }, // nested-name-specifier-root 3
+            { 49, 3, 26, 0 }, // nested-name-specifier-suffix 0
+            { 52, 2, 22, 0 }, // nested-name-specifier-suffix 1
+            { 54, 3, 3, 0 }, // lambda-expression 0
+            { 57, 3, 3, 0 }, // lambda-introducer 0
+            { 60, 3, 28, 0 }, // lambda-capture 0
+            { 63, 1, 29, 0 }, // lambda-capture 1
+            { 64, 1, 28, 0 }, // lambda-capture 2
+            { 65, 1, 30, 0 }, // capture-default 0
+            { 66, 1, 31, 0 }, // capture-default 1
+            { 67, 3, 29, 0 }, // capture-list 0
+            { 70, 2, 31, 0 }, // capture 0
+            { 72, 1, 5, 0 }, // capture 1
+            { 73, 1, 22, 0 }, // capture 2
+            { 74, 7, 2, 0 }, // lambda-declarator 0
+            { 81, 2, 32, 0 }, // postfix-expression 0
+            { 83, 7, 33, 0 }, // postfix-root 0
+            { 90, 7, 34, 0 }, // postfix-root 1
+            { 97, 7, 35, 0 }, // postfix-root 2
+            { 104, 7, 36, 0 }, // postfix-root 3
+            { 111, 4, 37, 0 }, // postfix-root 4
+            { 115, 4, 37, 0 }, // postfix-root 5
+            { 119, 4, 38, 0 }, // postfix-root 6
+            { 123, 4, 39, 0 }, // postfix-root 7
+            { 127, 2, 38, 0 }, // postfix-root 8
+            { 129, 2, 39, 0 }, // postfix-root 9
+            { 131, 1, 1, 0 }, // postfix-root 10
+            { 132, 3, 41, 0 }, // postfix-suffix 0
+            { 135, 3, 42, 0 }, // postfix-suffix 1
+            { 138, 3, 2, 0 }, // postfix-suffix 2
+            { 141, 3, 3, 0 }, // postfix-suffix 3
+            { 144, 3, 3, 0 }, // postfix-suffix 4
+            { 147, 2, 41, 0 }, // postfix-suffix 5
+            { 149, 2, 42, 0 }, // postfix-suffix 6
+            { 151, 1, 43, 0 }, // postfix-suffix 7
+            { 152, 1, 44, 0 }, // postfix-suffix 8
+            { 153, 1, 45, 0 }, // expression-list 0
+            { 154, 3, 46, 0 }, // pseudo-destructor-name 0
+            { 157, 2, 19, 0 }, // pseudo-destructor-name 1
+            { 159, 5, 48, 0 }, // unary-expression 0
+            { 164, 4, 49, 0 }, // unary-expression 1
+            { 168, 4, 48, 0 }, // unary-expression 2
+            { 172, 2, 48, 0 }, // unary-expression 3
+            { 174, 2, 50, 0 }, // unary-expression 4
+            { 176, 1, 51, 0 }, // unary-expression 5
+            { 177, 1, 52, 0 }, // unary-expression 6
+            { 178, 1, 53, 0 }, // unary-expression 7
+            { 179, 1, 32, 0 }, // unary-expression 8
+            { 180, 1, 19, 0 }, // unary-operator 0
+            { 181, 1, 54, 0 }, // unary-operator 1
+            { 182, 1, 55, 0 }, // unary-operator 2
+            { 183, 1, 56, 0 }, // unary-operator 3
+            { 184, 1, 31, 0 }, // unary-operator 4
+            { 185, 1, 57, 0 }, // unary-operator 5
+            { 186, 1, 43, 0 }, // unary-operator 6
+            { 187, 1, 44, 0 }, // unary-operator 7
+            { 188, 7, 52, 0 }, // new-expression 0
+            { 195, 5, 52, 0 }, // new-expression 1
+            { 200, 3, 2, 0 }, // new-placement 0
+            { 203, 2, 58, 0 }, // new-type-id 0
+            { 205, 2, 59, 0 }, // new-declarator 0
+            { 207, 1, 60, 0 }, // new-declarator 1
+            { 208, 5, 3, 0 }, // noptr-new-declarator 0
+            { 213, 3, 2, 0 }, // new-initializer 0
+            { 216, 1, 62, 0 }, // new-initializer 1
+            { 217, 5, 51, 0 }, // delete-expression 0
+            { 222, 3, 51, 0 }, // delete-expression 1
+            { 225, 4, 53, 0 }, // noexcept-expression 0
+            { 229, 2, 2, 0 }, // cast-expression 0
+            { 231, 1, 47, 0 }, // cast-expression 1
+            { 232, 3, 2, 0 }, // cast-operator 0
+            { 235, 2, 47, 0 }, // pm-expression 0
+            { 237, 1, 64, 0 }, // pm-operator 0
+            { 238, 1, 65, 0 }, // pm-operator 1
+            { 239, 2, 47, 0 }, // multiplicative-expression 0
+            { 241, 1, 67, 0 }, // multiplicative-operator 0
+            { 242, 1, 68, 0 }, // multiplicative-operator 1
+            { 243, 1, 57, 0 }, // multiplicative-operator 2
+            { 244, 2, 47, 0 }, // additive-expression 0
+            { 246, 1, 55, 0 }, // additive-operator 0
+            { 247, 1, 56, 0 }, // additive-operator 1
+            { 248, 2, 47, 0 }, // shift-expression 0
+            { 250, 2, 71, 0 }, // shift-operator 0
+            { 252, 1, 72, 0 }, // shift-operator 1
+            { 253, 2, 47, 0 }, // relational-expression 0
+            { 255, 1, 74, 0 }, // relational-operator 0
+            { 256, 1, 75, 0 }, // relational-operator 1
+            { 257, 1, 76, 0 }, // relational-operator 2
+            { 258, 1, 77, 0 }, // relational-operator 3
+            { 259, 2, 47, 0 }, // equality-expression 0
+            { 261, 1, 79, 0 }, // equality-operator 0
+            { 262, 1, 80, 0 }, // equality-operator 1
+            { 263, 2, 47, 0 }, // and-expression 0
+            { 265, 2, 47, 0 }, // exclusive-or-expression 0
+            { 267, 2, 47, 0 }, // inclusive-or-expression 0
+            { 269, 2, 47, 0 }, // logical-and-expression 0
+            { 271, 2, 47, 0 }, // logical-or-expression 0
+            { 273, 2, 47, 0 }, // conditional-expression 0
+            { 275, 3, 47, 0 }, // assignment-expression 0
+            { 278, 1, 82, 0 }, // assignment-expression 1
+            { 279, 1, 47, 0 }, // assignment-expression 2
+            { 280, 1, 84, 0 }, // assignment-operator 0
+            { 281, 1, 85, 0 }, // assignment-operator 1
+            { 282, 1, 86, 0 }, // assignment-operator 2
+            { 283, 1, 87, 0 }, // assignment-operator 3
+            { 284, 1, 88, 0 }, // assignment-operator 4
+            { 285, 1, 89, 0 }, // assignment-operator 5
+            { 286, 1, 90, 0 }, // assignment-operator 6
+            { 287, 1, 91, 0 }, // assignment-operator 7
+            { 288, 1, 92, 0 }, // assignment-operator 8
+            { 289, 1, 93, 0 }, // assignment-operator 9
+            { 290, 1, 30, 0 }, // assignment-operator 10
+            { 291, 2, 81, 0 }, // expression 0
+            { 293, 1, 47, 0 }, // constant-expression 0
+            { 294, 2, 95, 0 }, // statement 0
+            { 296, 2, 96, 0 }, // statement 1
+            { 298, 2, 97, 0 }, // statement 2
+            { 300, 2, 98, 0 }, // statement 3
+            { 302, 2, 99, 0 }, // statement 4
+            { 304, 2, 100, 0 }, // statement 5
+            { 306, 1, 101, 0 }, // statement 6
+            { 307, 1, 102, 0 }, // statement 7
+            { 308, 5, 103, 0 }, // labeled-statement 0
+            { 313, 4, 104, 0 }, // labeled-statement 1
+            { 317, 4, 105, 0 }, // labeled-statement 2
+            { 321, 2, 106, 0 }, // expression-statement 0
+            { 323, 3, 62, 0 }, // compound-statement 0
+            { 326, 7, 108, 0 }, // selection-statement 0
+            { 333, 5, 109, 0 }, // selection-statement 1
+            { 338, 5, 108, 0 }, // selection-statement 2
+            { 343, 5, 110, 0 }, // condition-declaration 0
+            { 348, 4, 110, 0 }, // condition-declaration 1
+            { 352, 1, 81, 0 }, // condition 0
+            { 353, 1, 110, 0 }, // condition 1
+            { 354, 8, 113, 0 }, // iteration-statement 0
+            { 362, 7, 113, 0 }, // iteration-statement 1
+            { 369, 7, 114, 0 }, // iteration-statement 2
+            { 376, 5, 115, 0 }, // iteration-statement 3
+            { 381, 1, 110, 0 }, // for-init-statement 0
+            { 382, 1, 106, 0 }, // for-init-statement 1
+            { 383, 3, 110, 0 }, // for-range-declaration 0
+            { 386, 1, 62, 0 }, // for-range-initializer 0
+            { 387, 1, 81, 0 }, // for-range-initializer 1
+            { 388, 3, 118, 0 }, // jump-statement 0
+            { 391, 3, 119, 0 }, // jump-statement 1
+            { 394, 3, 119, 0 }, // jump-statement 2
+            { 397, 2, 120, 0 }, // jump-statement 3
+            { 399, 2, 121, 0 }, // jump-statement 4
+            { 401, 1, 101, 0 }, // declaration-statement 0
+            { 402, 1, 123, 0 }, // declaration 0
+            { 403, 1, 124, 0 }, // declaration 1
+            { 404, 1, 125, 0 }, // declaration 2
+            { 405, 1, 126, 0 }, // declaration 3
+            { 406, 1, 127, 0 }, // declaration 4
+            { 407, 1, 128, 0 }, // declaration 5
+            { 408, 1, 127, 0 }, // declaration 6
+            { 409, 1, 110, 0 }, // declaration 7
+            { 410, 1, 101, 0 }, // declaration 8
+            { 411, 1, 129, 0 }, // block-declaration 0
+            { 412, 1, 130, 0 }, // block-declaration 1
+            { 413, 1, 131, 0 }, // block-declaration 2
+            { 414, 1, 132, 0 }, // block-declaration 3
+            { 415, 1, 130, 0 }, // block-declaration 4
+            { 416, 1, 133, 0 }, // block-declaration 5
+            { 417, 1, 134, 0 }, // block-declaration 6
+            { 418, 1, 110, 0 }, // block-declaration 7
+            { 419, 6, 130, 0 }, // alias-declaration 0
+            { 425, 4, 110, 0 }, // simple-declaration 0
+            { 429, 7, 131, 0 }, // static_assert-declaration 0
+            { 436, 1, 124, 0 }, // empty-declaration 0
+            { 437, 2, 123, 0 }, // attribute-declaration 0
+            { 439, 1, 136, 0 }, // decl-specifier 0
+            { 440, 1, 137, 0 }, // decl-specifier 1
+            { 441, 1, 138, 0 }, // decl-specifier 2
+            { 442, 1, 139, 0 }, // decl-specifier 3
+            { 443, 1, 58, 0 }, // decl-specifier 4
+            { 444, 1, 140, 0 }, // decl-specifier 5
+            { 445, 2, 135, 0 }, // decl-specifier-seq 0
+            { 447, 1, 141, 0 }, // storage-class-specifier 0
+            { 448, 1, 126, 0 }, // storage-class-specifier 1
+            { 449, 1, 142, 0 }, // storage-class-specifier 2
+            { 450, 1, 143, 0 }, // storage-class-specifier 3
+            { 451, 1, 144, 0 }, // storage-class-specifier 4
+            { 452, 1, 145, 0 }, // function-specifier 0
+            { 453, 1, 146, 0 }, // function-specifier 1
+            { 454, 1, 147, 0 }, // function-specifier 2
+            { 455, 1, 129, 0 }, // type-specifier 0
+            { 456, 1, 148, 0 }, // type-specifier 1
+            { 457, 1, 58, 0 }, // type-specifier 2
+            { 458, 1, 149, 0 }, // trailing-type-specifier 0
+            { 459, 1, 38, 0 }, // trailing-type-specifier 1
+            { 460, 1, 150, 0 }, // trailing-type-specifier 2
+            { 461, 1, 39, 0 }, // trailing-type-specifier 3
+            { 462, 2, 58, 0 }, // type-specifier-seq 0
+            { 464, 2, 58, 0 }, // trailing-type-specifier-seq 0
+            { 466, 3, 17, 0 }, // simple-type-specifier 0
+            { 469, 2, 17, 0 }, // simple-type-specifier 1
+            { 471, 1, 151, 0 }, // simple-type-specifier 2
+            { 472, 1, 23, 0 }, // simple-type-specifier 3
+            { 473, 1, 152, 0 }, // simple-type-specifier 4
+            { 474, 1, 153, 0 }, // simple-type-specifier 5
+            { 475, 1, 154, 0 }, // simple-type-specifier 6
+            { 476, 1, 155, 0 }, // simple-type-specifier 7
+            { 477, 1, 156, 0 }, // simple-type-specifier 8
+            { 478, 1, 157, 0 }, // simple-type-specifier 9
+            { 479, 1, 158, 0 }, // simple-type-specifier 10
+            { 480, 1, 159, 0 }, // simple-type-specifier 11
+            { 481, 1, 160, 0 }, // simple-type-specifier 12
+            { 482, 1, 161, 0 }, // simple-type-specifier 13
+            { 483, 1, 162, 0 }, // simple-type-specifier 14
+            { 484, 1, 163, 0 }, // simple-type-specifier 15
+            { 485, 1, 164, 0 }, // simple-type-specifier 16
+            { 486, 4, 23, 0 }, // decltype-specifier 0
+            { 490, 4, 148, 0 }, // elaborated-type-specifier 0
+            { 494, 4, 148, 0 }, // elaborated-type-specifier 1
+            { 498, 3, 129, 0 }, // elaborated-type-specifier 2
+            { 501, 5, 129, 0 }, // enum-specifier 0
+            { 506, 4, 129, 0 }, // enum-specifier 1
+            { 510, 5, 129, 0 }, // enum-head 0
+            { 515, 4, 129, 0 }, // enum-head 1
+            { 519, 5, 129, 0 }, // opaque-enum-declaration 0
+            { 524, 2, 129, 0 }, // enum-key 0
+            { 526, 2, 129, 0 }, // enum-key 1
+            { 528, 1, 129, 0 }, // enum-key 2
+            { 529, 2, 165, 0 }, // enum-base 0
+            { 531, 2, 22, 0 }, // enumerator-list 0
+            { 533, 3, 22, 0 }, // enumerator-definition 0
+            { 536, 1, 22, 0 }, // enumerator-definition 1
+            { 537, 1, 22, 0 }, // enumerator 0
+            { 538, 6, 125, 0 }, // namespace-definition 0
+            { 544, 1, 122, 1 }, // namespace-body 0
+            { 545, 5, 133, 0 }, // namespace-alias-definition 0
+            { 550, 2, 17, 0 }, // qualified-namespace-specifier 0
+            { 552, 5, 130, 0 }, // using-declaration 0
+            { 557, 4, 130, 0 }, // using-declaration 1
+            { 561, 6, 132, 0 }, // using-directive 0
+            { 567, 5, 134, 0 }, // asm-definition 0
+            { 572, 5, 126, 0 }, // linkage-specification 0
+            { 577, 3, 126, 0 }, // linkage-specification 1
+            { 580, 5, 3, 0 }, // attribute-specifier 0
+            { 585, 1, 166, 0 }, // attribute-specifier 1
+            { 586, 5, 166, 0 }, // alignment-specifier 0
+            { 591, 5, 166, 0 }, // alignment-specifier 1
+            { 596, 2, 167, 1 }, // attribute-list 0
+            { 598, 2, 22, 0 }, // attribute-part 0
+            { 600, 1, 22, 1 }, // attribute-part 1
+            { 601, 2, 22, 0 }, // attribute 0
+            { 603, 1, 22, 0 }, // attribute-token 0
+            { 604, 1, 22, 0 }, // attribute-token 1
+            { 605, 3, 22, 0 }, // attribute-scoped-token 0
+            { 608, 1, 22, 0 }, // attribute-namespace 0
+            { 609, 3, 2, 0 }, // attribute-argument-clause 0
+            { 612, 3, 62, 0 }, // balanced-token 0
+            { 615, 3, 3, 0 }, // balanced-token 1
+            { 618, 3, 2, 0 }, // balanced-token 2
+            { 621, 1, 169, 0 }, // balanced-token 3
+            { 622, 2, 170, 0 }, // init-declarator-list 0
+            { 624, 2, 170, 0 }, // init-declarator 0
+            { 626, 2, 171, 0 }, // declarator 0
+            { 628, 1, 170, 0 }, // declarator 1
+            { 629, 2, 170, 0 }, // ptr-declarator 0
+            { 631, 2, 171, 0 }, // noptr-declarator 0
+            { 633, 3, 2, 0 }, // noptr-declarator-root 0
+            { 636, 2, 172, 0 }, // noptr-declarator-root 1
+            { 638, 4, 3, 0 }, // noptr-declarator-suffix 0
+            { 642, 1, 2, 0 }, // noptr-declarator-suffix 1
+            { 643, 7, 2, 0 }, // parameters-and-qualifiers 0
+            { 650, 3, 41, 0 }, // trailing-return-type 0
+            { 653, 4, 17, 0 }, // ptr-operator 0
+            { 657, 3, 57, 0 }, // ptr-operator 1
+            { 660, 2, 174, 0 }, // ptr-operator 2
+            { 662, 2, 31, 0 }, // ptr-operator 3
+            { 664, 1, 175, 0 }, // cv-qualifier 0
+            { 665, 1, 176, 0 }, // cv-qualifier 1
+            { 666, 1, 174, 0 }, // ref-qualifier 0
+            { 667, 1, 31, 0 }, // ref-qualifier 1
+            { 668, 2, 172, 0 }, // declarator-id 0
+            { 670, 2, 58, 0 }, // type-id 0
+            { 672, 2, 179, 0 }, // abstract-declarator 0
+            { 674, 1, 180, 0 }, // abstract-declarator 1
+            { 675, 1, 181, 0 }, // abstract-declarator 2
+            { 676, 2, 181, 0 }, // ptr-abstract-declarator 0
+            { 678, 1, 60, 0 }, // ptr-abstract-declarator 1
+            { 679, 2, 173, 0 }, // noptr-abstract-declarator 0
+            { 681, 1, 173, 0 }, // noptr-abstract-declarator 1
+            { 682, 3, 2, 0 }, // noptr-abstract-declarator-root 0
+            { 685, 1, 173, 0 }, // noptr-abstract-declarator-root 1
+            { 686, 2, 180, 0 }, // abstract-pack-declarator 0
+            { 688, 2, 182, 0 }, // noptr-abstract-pack-declarator 0
+            { 690, 3, 110, 0 }, // parameter-declaration-clause 0
+            { 693, 2, 183, 1 }, // parameter-declaration-clause 1
+            { 695, 2, 110, 0 }, // parameter-declaration-list 0
+            { 697, 4, 110, 0 }, // parameter-declaration 0
+            { 701, 4, 110, 0 }, // parameter-declaration 1
+            { 705, 5, 110, 0 }, // function-definition 0
+            { 710, 3, 30, 0 }, // function-body 0
+            { 713, 3, 30, 0 }, // function-body 1
+            { 716, 2, 185, 0 }, // function-body 2
+            { 718, 1, 186, 0 }, // function-body 3
+            { 719, 3, 2, 0 }, // initializer 0
+            { 722, 1, 188, 0 }, // initializer 1
+            { 723, 2, 30, 0 }, // brace-or-equal-initializer 0
+            { 725, 1, 62, 0 }, // brace-or-equal-initializer 1
+            { 726, 1, 62, 0 }, // initializer-clause 0
+            { 727, 1, 81, 0 }, // initializer-clause 1
+            { 728, 2, 45, 0 }, // initializer-list 0
+            { 730, 2, 45, 0 }, // initializer-clause-dots 0
+            { 732, 4, 62, 0 }, // braced-init-list 0
+            { 736, 2, 62, 0 }, // braced-init-list 1
+            { 738, 4, 148, 0 }, // class-specifier 0
+            { 742, 5, 148, 0 }, // class-head 0
+            { 747, 3, 148, 0 }, // class-head 1
+            { 750, 2, 17, 0 }, // class-head-name 0
+            { 752, 1, 189, 0 }, // class-virt-specifier 0
+            { 753, 1, 190, 0 }, // class-key 0
+            { 754, 1, 191, 0 }, // class-key 1
+            { 755, 1, 192, 0 }, // class-key 2
+            { 756, 2, 194, 0 }, // member-specification 0
+            { 758, 1, 195, 0 }, // member-specification 1
+            { 759, 4, 110, 0 }, // member-declaration 0
+            { 763, 2, 110, 0 }, // member-declaration 1
+            { 765, 1, 130, 0 }, // member-declaration 2
+            { 766, 1, 127, 0 }, // member-declaration 3
+            { 767, 1, 131, 0 }, // member-declaration 4
+            { 768, 1, 130, 0 }, // member-declaration 5
+            { 769, 2, 196, 0 }, // member-declarator-list 0
+            { 771, 4, 197, 0 }, // member-declarator 0
+            { 775, 2, 170, 0 }, // member-declarator 1
+            { 777, 3, 170, 0 }, // member-declarator 2
+            { 780, 1, 189, 0 }, // virt-specifier 0
+            { 781, 1, 199, 0 }, // virt-specifier 1
+            { 782, 2, 30, 0 }, // pure-specifier 0
+            { 784, 2, 165, 0 }, // base-clause 0
+            { 786, 2, 200, 0 }, // base-specifier-list 0
+            { 788, 2, 200, 0 }, // base-specifier-dots 0
+            { 790, 4, 201, 0 }, // base-specifier 0
+            { 794, 4, 202, 0 }, // base-specifier 1
+            { 798, 2, 203, 0 }, // base-specifier 2
+            { 800, 2, 17, 0 }, // class-or-decltype 0
+            { 802, 1, 23, 0 }, // class-or-decltype 1
+            { 803, 1, 17, 0 }, // base-type-specifier 0
+            { 804, 1, 204, 0 }, // access-specifier 0
+            { 805, 1, 205, 0 }, // access-specifier 1
+            { 806, 1, 206, 0 }, // access-specifier 2
+            { 807, 2, 21, 0 }, // conversion-function-id 0
+            { 809, 2, 58, 0 }, // conversion-type-id 0
+            { 811, 2, 165, 0 }, // ctor-initializer 0
+            { 813, 2, 207, 0 }, // mem-initializer-list 0
+            { 815, 2, 207, 0 }, // mem-initializer-dots 0
+            { 817, 4, 207, 0 }, // mem-initializer 0
+            { 821, 2, 207, 0 }, // mem-initializer 1
+            { 823, 1, 22, 0 }, // mem-initializer-id 0
+            { 824, 1, 17, 0 }, // mem-initializer-id 1
+            { 825, 4, 21, 0 }, // operator-function-id 0
+            { 829, 4, 21, 0 }, // operator-function-id 1
+            { 833, 3, 21, 0 }, // operator-function-id 2
+            { 836, 3, 21, 0 }, // operator-function-id 3
+            { 839, 3, 21, 0 }, // operator-function-id 4
+            { 842, 2, 21, 0 }, // operator-function-id 5
+            { 844, 2, 21, 0 }, // operator-function-id 6
+            { 846, 2, 21, 0 }, // operator-function-id 7
+            { 848, 2, 21, 0 }, // operator-function-id 8
+            { 850, 2, 21, 0 }, // operator-function-id 9
+            { 852, 2, 21, 0 }, // operator-function-id 10
+            { 854, 2, 21, 0 }, // operator-function-id 11
+            { 856, 2, 21, 0 }, // operator-function-id 12
+            { 858, 2, 21, 0 }, // operator-function-id 13
+            { 860, 2, 21, 0 }, // operator-function-id 14
+            { 862, 2, 21, 0 }, // operator-function-id 15
+            { 864, 2, 21, 0 }, // operator-function-id 16
+            { 866, 2, 21, 0 }, // operator-function-id 17
+            { 868, 2, 21, 0 }, // operator-function-id 18
+            { 870, 2, 21, 0 }, // operator-function-id 19
+            { 872, 2, 21, 0 }, // operator-function-id 20
+            { 874, 2, 21, 0 }, // operator-function-id 21
+            { 876, 2, 21, 0 }, // operator-function-id 22
+            { 878, 2, 21, 0 }, // operator-function-id 23
+            { 880, 2, 21, 0 }, // operator-function-id 24
+            { 882, 2, 21, 0 }, // operator-function-id 25
+            { 884, 2, 21, 0 }, // operator-function-id 26
+            { 886, 2, 21, 0 }, // operator-function-id 27
+            { 888, 2, 21, 0 }, // operator-function-id 28
+            { 890, 2, 21, 0 }, // operator-function-id 29
+            { 892, 2, 21, 0 }, // operator-function-id 30
+            { 894, 2, 21, 0 }, // operator-function-id 31
+            { 896, 2, 21, 0 }, // operator-function-id 32
+            { 898, 2, 21, 0 }, // operator-function-id 33
+            { 900, 2, 21, 0 }, // operator-function-id 34
+            { 902, 2, 21, 0 }, // operator-function-id 35
+            { 904, 2, 21, 0 }, // operator-function-id 36
+            { 906, 2, 21, 0 }, // operator-function-id 37
+            { 908, 2, 21, 0 }, // operator-function-id 38
+            { 910, 2, 21, 0 }, // operator-function-id 39
+            { 912, 2, 21, 0 }, // operator-function-id 40
+            { 914, 2, 21, 0 }, // operator-function-id 41
+            { 916, 3, 21, 0 }, // literal-operator-id 0
+            { 919, 5, 127, 0 }, // template-declaration 0
+            { 924, 2, 208, 0 }, // template-parameter-list 0
+            { 926, 1, 110, 0 }, // template-parameter 0
+            { 927, 1, 209, 0 }, // template-parameter 1
+            { 928, 8, 127, 0 }, // type-parameter 0
+            { 936, 7, 127, 0 }, // type-parameter 1
+            { 943, 4, 38, 0 }, // type-parameter 2
+            { 947, 4, 192, 0 }, // type-parameter 3
+            { 951, 3, 38, 0 }, // type-parameter 4
+            { 954, 3, 192, 0 }, // type-parameter 5
+            { 957, 4, 21, 0 }, // template-id 0
+            { 961, 4, 21, 0 }, // template-id 1
+            { 965, 1, 11, 0 }, // template-id 2
+            { 966, 2, 210, 0 }, // template-argument-list 0
+            { 968, 2, 210, 0 }, // template-argument-dots 0
+            { 970, 1, 4, 0 }, // template-argument 0
+            { 971, 1, 58, 0 }, // template-argument 1
+            { 972, 1, 47, 0 }, // template-argument 2
+            { 973, 4, 38, 0 }, // typename-specifier 0
+            { 977, 3, 38, 0 }, // typename-specifier 1
+            { 980, 3, 128, 0 }, // explicit-instantiation 0
+            { 983, 4, 127, 0 }, // explicit-specialization 0
+            { 987, 3, 186, 0 }, // try-block 0
+            { 990, 4, 186, 0 }, // function-try-block 0
+            { 994, 5, 211, 0 }, // handler 0
+            { 999, 4, 213, 0 }, // exception-declaration 0
+            { 1003, 4, 213, 0 }, // exception-declaration 1
+            { 1007, 1, 182, 0 }, // exception-declaration 2
+            { 1008, 2, 82, 0 }, // throw-expression 0
+            { 1010, 1, 53, 0 }, // exception-specification 0
+            { 1011, 1, 82, 0 }, // exception-specification 1
+            { 1012, 4, 82, 0 }, // dynamic-exception-specification 0
+            { 1016, 2, 58, 0 }, // type-id-list 0
+            { 1018, 2, 58, 0 }, // type-id-dots 0
+            { 1020, 2, 53, 0 }, // noexcept-specification 0
+        };
+        return alts;
+    }
+
+    static const TableTerm* tableTerms()
+    {
+        static const TableTerm terms[] = {
+            { TABLE_RULE, TABLE_STAR, RULE_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_EOF, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_lambda_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_id_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_THIS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_LITERAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NULLPTR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_FALSE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TRUE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_template_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_typedef_name, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enum_name, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_name, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_template_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER_C, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER_E, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER_N, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER_T, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER_Y, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_template_argument_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_qualified_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_unqualified_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMPL, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decltype_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMPL, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_name, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_literal_operator_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_conversion_function_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_operator_function_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_unqualified_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier_root, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_nested_name_specifier_suffix, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decltype_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_namespace_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_template_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_lambda_introducer, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_lambda_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_compound_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_lambda_capture, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_capture_default, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_capture_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_capture_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_capture_default, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_AMP, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_capture, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_GROUP, TABLE_STAR, 0, 3 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_AMP, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_THIS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_parameter_declaration_clause, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_MUTABLE, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_exception_specification, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_trailing_return_type, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_postfix_root, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_postfix_suffix, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CONST_CAST, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_REINTERPET_CAST, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_STATIC_CAST, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DYNAMIC_CAST, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TYPEID, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TYPEID, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_typename_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_type_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_typename_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_type_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_primary_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ARROW, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_id_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOT, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_id_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ARROW, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_pseudo_destructor_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_pseudo_destructor_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DEC, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_INC, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_list, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMPL, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMPL, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decltype_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_SIZEOF, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ALIGNOF, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_SIZEOF, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_SIZEOF, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_unary_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_unary_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cast_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_delete_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_new_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noexcept_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_postfix_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMPL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LNOT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MINUS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_PLUS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_AMP, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_STAR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DEC, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_INC, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NEW, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_new_placement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_new_initializer, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NEW, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_new_placement, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_new_type_id, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_new_initializer, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_new_declarator, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_ptr_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_new_declarator, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_ptr_operator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_GROUP, TABLE_STAR, 3, 4 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DELETE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cast_expression, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DELETE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cast_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NOEXCEPT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cast_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cast_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_unary_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cast_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 7, 2 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ARROWSTAR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOTSTAR, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_pm_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 9, 2 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MOD, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DIV, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_STAR, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_multiplicative_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 11, 2 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MINUS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_PLUS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_additive_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 13, 2 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_RSHIFT_1, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_RSHIFT_2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSHIFT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_shift_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 15, 2 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_GE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_relational_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 17, 2 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_NE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_EQ, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_equality_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 19, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_and_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 21, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_exclusive_or_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 23, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_inclusive_or_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 25, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_logical_and_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 27, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_logical_or_expression, 0 },
+            { TABLE_GROUP, TABLE_QUES, 29, 4 },
+            { TABLE_RULE, TABLE_ONCE, RULE_logical_or_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_assignment_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_throw_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_conditional_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_BORASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_XORASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_BANDASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSHIFTASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSHIFTASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MINUSASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_PLUSASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MODASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DIVASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_STARASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_assignment_expression, 0 },
+            { TABLE_GROUP, TABLE_STAR, 33, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_conditional_expression, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_try_block, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_jump_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_iteration_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_selection_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_compound_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression_statement, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declaration_statement, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_labeled_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CASE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_constant_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DEFAULT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_IF, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_condition, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ELSE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_SWITCH, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_condition, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_IF, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_condition, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_condition_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_FOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_for_init_statement, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_condition, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_FOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_for_range_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_for_range_initializer, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DO, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_WHILE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_WHILE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_condition, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_statement, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_GOTO, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_RETURN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_RETURN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CONTINUE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_BREAK, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_block_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_empty_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_namespace_definition, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_linkage_specification, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_explicit_specialization, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_explicit_instantiation, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_function_definition, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_block_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_opaque_enum_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_alias_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_static_assert_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_using_directive, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_using_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_namespace_alias_definition, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_asm_definition, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_USING, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_init_declarator_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_STATIC_ASSERT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_constant_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_LITERAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CONSTEXPR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TYPEDEF, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_FRIEND, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_function_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_storage_class_specifier, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_decl_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_MUTABLE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_EXTERN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_THREAD_LOCAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_STATIC, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_REGISTER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_EXPLICIT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_VIRTUAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_INLINE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enum_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_trailing_type_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cv_qualifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_typename_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_elaborated_type_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_type_specifier, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_type_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_trailing_type_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_template_id, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CHAR, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decltype_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CHAR16_T, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_WCHAR_T, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_AUTO, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_VOID, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DOUBLE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_FLOAT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_UNSIGNED, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_LONG, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_SIGNED, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_INT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_SHORT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_BOOL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CHAR32_T, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DECLTYPE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_key, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_template_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_key, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ENUM, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enum_head, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enumerator_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enum_head, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_enumerator_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enum_key, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_enum_base, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enum_key, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_enum_base, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enum_key, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_enum_base, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ENUM, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_STRUCT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ENUM, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CLASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ENUM, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enumerator_definition, 0 },
+            { TABLE_GROUP, TABLE_STAR, 35, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enumerator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_constant_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enumerator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_INLINE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NAMESPACE, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_namespace_body, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NAMESPACE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_qualified_namespace_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_namespace_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_USING, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_TYPENAME, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_unqualified_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_USING, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_unqualified_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_USING, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NAMESPACE, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ASM, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_LITERAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_EXTERN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_LITERAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_EXTERN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_LITERAL, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_alignment_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ALIGNAS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_assignment_expression, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_ALIGNAS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute_part, 0 },
+            { TABLE_GROUP, TABLE_STAR, 37, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_attribute, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute_token, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_attribute_argument_clause, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute_scoped_token, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute_namespace, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_balanced_token, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_balanced_token, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_balanced_token, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_balanced_token, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_NONPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_init_declarator, 0 },
+            { TABLE_GROUP, TABLE_STAR, 39, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_initializer, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_trailing_return_type, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_ptr_declarator, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_ptr_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_declarator_root, 0 },
+            { TABLE_GROUP, TABLE_STAR, 41, 1 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_ptr_declarator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator_id, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_constant_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_parameters_and_qualifiers, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_parameter_declaration_clause, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_cv_qualifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_ref_qualifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_exception_specification, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ARROW, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_trailing_type_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_abstract_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_STAR, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_cv_qualifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_STAR, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_cv_qualifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LAND, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_AMP, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_VOLATILE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CONST, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LAND, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_AMP, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_id_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_abstract_declarator, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_noptr_abstract_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_trailing_return_type, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_abstract_pack_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_ptr_abstract_declarator, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_ptr_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_abstract_declarator, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_ptr_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_abstract_declarator_root, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_noptr_declarator_suffix, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_noptr_declarator_suffix, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_ptr_abstract_declarator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_declarator_suffix, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_ptr_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_abstract_pack_declarator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_noptr_declarator_suffix, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_parameter_declaration_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_parameter_declaration_list, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_parameter_declaration, 0 },
+            { TABLE_GROUP, TABLE_STAR, 42, 2 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_GROUP, TABLE_QUES, 44, 2 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_abstract_declarator, 0 },
+            { TABLE_GROUP, TABLE_QUES, 46, 2 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_virt_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_function_body, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DELETE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DEFAULT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_ctor_initializer, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_compound_statement, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_function_try_block, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_brace_or_equal_initializer, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_assignment_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause_dots, 0 },
+            { TABLE_GROUP, TABLE_STAR, 48, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_list, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_COMMA, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_head, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LBRACE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_member_specification, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RBRACE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_key, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_head_name, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_class_virt_specifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_base_clause, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_key, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_base_clause, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_name, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_FINAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_UNION, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_STRUCT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CLASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_access_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_member_declaration, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decl_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_member_declarator_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_function_definition, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_SEMICOLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_alias_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_static_assert_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_using_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_member_declarator, 0 },
+            { TABLE_GROUP, TABLE_STAR, 50, 2 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_constant_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_brace_or_equal_initializer, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_virt_specifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_pure_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_FINAL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_OVERRIDE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_ZERO, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_base_specifier_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_base_specifier_dots, 0 },
+            { TABLE_GROUP, TABLE_STAR, 52, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_base_specifier, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_access_specifier, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_VIRTUAL, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_base_type_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_VIRTUAL, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_access_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_base_type_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_base_type_specifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_nested_name_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_name, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_decltype_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_or_decltype, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_PUBLIC, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_PROTECTED, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_PRIVATE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_conversion_type_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_specifier_seq, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_ptr_operator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_mem_initializer_list, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_mem_initializer_dots, 0 },
+            { TABLE_GROUP, TABLE_STAR, 54, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_mem_initializer, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_mem_initializer_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_expression_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_mem_initializer_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_braced_init_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_class_or_decltype, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DELETE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NEW, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_RSHIFT_1, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_RSHIFT_2, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_XORASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NEW, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_PLUS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ARROW, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ARROWSTAR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DEC, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_INC, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_STAR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LAND, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_GE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_NE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_EQ, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSHIFTASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSHIFTASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_AMP, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSHIFT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_BORASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_BANDASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_DELETE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MODASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DIVASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MINUSASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_PLUSASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LNOT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMPL, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_STARASS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_BOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_XOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MOD, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DIV, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_MINUS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_OPERATOR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_EMPTYSTR, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TEMPLATE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_parameter_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_parameter, 0 },
+            { TABLE_GROUP, TABLE_STAR, 56, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_parameter_declaration, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_parameter, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TEMPLATE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_parameter_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CLASS, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_id_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TEMPLATE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_parameter_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CLASS, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TYPENAME, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CLASS, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TYPENAME, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CLASS, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_TT_IDENTIFIER, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_literal_operator_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_template_argument_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_operator_function_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_template_argument_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_template_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_argument_dots, 0 },
+            { TABLE_GROUP, TABLE_STAR, 58, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_argument, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_id_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_constant_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TYPENAME, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_simple_template_id, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TYPENAME, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_nested_name_specifier, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_TT_IDENTIFIER, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_KW_EXTERN, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TEMPLATE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TEMPLATE, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_LT, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_ST_GT, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TRY, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_compound_statement, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_handler, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_TRY, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_ctor_initializer, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_compound_statement, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_handler, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_CATCH, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_exception_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_compound_statement, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_type_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_declarator, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_PLUS, RULE_type_specifier, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_abstract_declarator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_THROW, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_assignment_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noexcept_specification, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_dynamic_exception_specification, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_THROW, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_QUES, RULE_type_id_list, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id_dots, 0 },
+            { TABLE_GROUP, TABLE_STAR, 60, 2 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_KW_NOEXCEPT, 0 },
+            { TABLE_GROUP, TABLE_QUES, 62, 3 },
+        };
+        return terms;
+    }
+
+    static const TableTerm* tableGroupTerms()
+    {
+        static const TableTerm terms[] = {
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_capture, 0 },
+            { TABLE_TOKEN, TABLE_QUES, PT_OP_DOTS, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LSQUARE, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_constant_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RSQUARE, 0 },
+            { TABLE_RULE, TABLE_STAR, RULE_attribute_specifier, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_pm_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_cast_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_multiplicative_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_pm_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_additive_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_multiplicative_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_shift_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_additive_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_relational_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_shift_expression, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_equality_operator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_relational_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_AMP, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_equality_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_XOR, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_and_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_BOR, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_exclusive_or_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LAND, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_inclusive_or_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LOR, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_logical_and_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_QMARK, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COLON, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_assignment_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_assignment_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_enumerator_definition, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_attribute_part, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_init_declarator, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_noptr_declarator_suffix, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_parameter_declaration, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_ASS, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_initializer_clause_dots, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_member_declarator, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_base_specifier_dots, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_mem_initializer_dots, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_parameter, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_template_argument_dots, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_COMMA, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_type_id_dots, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_LPAREN, 0 },
+            { TABLE_RULE, TABLE_ONCE, RULE_constant_expression, 0 },
+            { TABLE_TOKEN, TABLE_ONCE, PT_OP_RPAREN, 0 },
+        };
+        return terms;
+    }
+
+    static const EPostTokenType* tableSetLists()
+    {
+        static const EPostTokenType lists[] = {
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 0
+            PT_KW_DECLTYPE, PT_KW_FALSE, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_THIS, PT_KW_TRUE, PT_OP_COLON2, PT_OP_COMPL, PT_OP_LPAREN, PT_OP_LSQUARE, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 1
+            PT_OP_LPAREN, PT_WHITESPACE, // 2
+            PT_OP_LSQUARE, PT_WHITESPACE, // 3
+            PT_KW_DECLTYPE, PT_KW_OPERATOR, PT_OP_COLON2, PT_OP_COMPL, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 4
+            PT_KW_THIS, PT_WHITESPACE, // 5
+            PT_TT_LITERAL, PT_WHITESPACE, // 6
+            PT_KW_NULLPTR, PT_WHITESPACE, // 7
+            PT_KW_FALSE, PT_WHITESPACE, // 8
+            PT_KW_TRUE, PT_WHITESPACE, // 9
+            PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 10
+            PT_TT_IDENTIFIER_T, PT_WHITESPACE, // 11
+            PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 12
+            PT_TT_IDENTIFIER_E, PT_WHITESPACE, // 13
+            PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_T, PT_WHITESPACE, // 14
+            PT_TT_IDENTIFIER_C, PT_WHITESPACE, // 15
+            PT_TT_IDENTIFIER_N, PT_WHITESPACE, // 16
+            PT_KW_DECLTYPE, PT_OP_COLON2, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 17
+            PT_KW_OPERATOR, PT_OP_COMPL, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_T, PT_WHITESPACE, // 18
+            PT_OP_COMPL, PT_WHITESPACE, // 19
+            PT_KW_OPERATOR, PT_TT_IDENTIFIER_T, PT_WHITESPACE, // 20
+            PT_KW_OPERATOR, PT_WHITESPACE, // 21
+            PT_TT_IDENTIFIER, PT_WHITESPACE, // 22
+            PT_KW_DECLTYPE, PT_WHITESPACE, // 23
+            PT_OP_COLON2, PT_WHITESPACE, // 24
+            PT_KW_TEMPLATE, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_T, PT_WHITESPACE, // 25
+            PT_KW_TEMPLATE, PT_TT_IDENTIFIER_T, PT_WHITESPACE, // 26
+            PT_KW_THIS, PT_OP_AMP, PT_OP_ASS, PT_TT_IDENTIFIER, PT_WHITESPACE, // 27
+            PT_OP_AMP, PT_OP_ASS, PT_WHITESPACE, // 28
+            PT_KW_THIS, PT_OP_AMP, PT_TT_IDENTIFIER, PT_WHITESPACE, // 29
+            PT_OP_ASS, PT_WHITESPACE, // 30
+            PT_OP_AMP, PT_WHITESPACE, // 31
+            PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_COMPL, PT_OP_LPAREN, PT_OP_LSQUARE, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 32
+            PT_KW_CONST_CAST, PT_WHITESPACE, // 33
+            PT_KW_REINTERPET_CAST, PT_WHITESPACE, // 34
+            PT_KW_STATIC_CAST, PT_WHITESPACE, // 35
+            PT_KW_DYNAMIC_CAST, PT_WHITESPACE, // 36
+            PT_KW_TYPEID, PT_WHITESPACE, // 37
+            PT_KW_TYPENAME, PT_WHITESPACE, // 38
+            PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_COLON2, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 39
+            PT_OP_ARROW, PT_OP_DEC, PT_OP_DOT, PT_OP_INC, PT_OP_LPAREN, PT_OP_LSQUARE, PT_WHITESPACE, // 40
+            PT_OP_ARROW, PT_WHITESPACE, // 41
+            PT_OP_DOT, PT_WHITESPACE, // 42
+            PT_OP_DEC, PT_WHITESPACE, // 43
+            PT_OP_INC, PT_WHITESPACE, // 44
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 45
+            PT_KW_DECLTYPE, PT_OP_COLON2, PT_OP_COMPL, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 46
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 47
+            PT_KW_SIZEOF, PT_WHITESPACE, // 48
+            PT_KW_ALIGNOF, PT_WHITESPACE, // 49
+            PT_OP_AMP, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_WHITESPACE, // 50
+            PT_KW_DELETE, PT_OP_COLON2, PT_WHITESPACE, // 51
+            PT_KW_NEW, PT_OP_COLON2, PT_WHITESPACE, // 52
+            PT_KW_NOEXCEPT, PT_WHITESPACE, // 53
+            PT_OP_LNOT, PT_WHITESPACE, // 54
+            PT_OP_MINUS, PT_WHITESPACE, // 55
+            PT_OP_PLUS, PT_WHITESPACE, // 56
+            PT_OP_STAR, PT_WHITESPACE, // 57
+            PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STRUCT, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 58
+            PT_KW_DECLTYPE, PT_OP_AMP, PT_OP_COLON2, PT_OP_LAND, PT_OP_LSQUARE, PT_OP_STAR, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 59
+            PT_KW_DECLTYPE, PT_OP_AMP, PT_OP_COLON2, PT_OP_LAND, PT_OP_STAR, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 60
+            PT_OP_LBRACE, PT_OP_LPAREN, PT_WHITESPACE, // 61
+            PT_OP_LBRACE, PT_WHITESPACE, // 62
+            PT_OP_ARROWSTAR, PT_OP_DOTSTAR, PT_WHITESPACE, // 63
+            PT_OP_ARROWSTAR, PT_WHITESPACE, // 64
+            PT_OP_DOTSTAR, PT_WHITESPACE, // 65
+            PT_OP_DIV, PT_OP_MOD, PT_OP_STAR, PT_WHITESPACE, // 66
+            PT_OP_MOD, PT_WHITESPACE, // 67
+            PT_OP_DIV, PT_WHITESPACE, // 68
+            PT_OP_MINUS, PT_OP_PLUS, PT_WHITESPACE, // 69
+            PT_OP_LSHIFT, PT_ST_RSHIFT_1, PT_WHITESPACE, // 70
+            PT_ST_RSHIFT_1, PT_WHITESPACE, // 71
+            PT_OP_LSHIFT, PT_WHITESPACE, // 72
+            PT_OP_GE, PT_OP_GT, PT_OP_LE, PT_OP_LT, PT_WHITESPACE, // 73
+            PT_OP_GE, PT_WHITESPACE, // 74
+            PT_OP_LE, PT_WHITESPACE, // 75
+            PT_OP_GT, PT_WHITESPACE, // 76
+            PT_OP_LT, PT_WHITESPACE, // 77
+            PT_OP_EQ, PT_OP_NE, PT_WHITESPACE, // 78
+            PT_OP_NE, PT_WHITESPACE, // 79
+            PT_OP_EQ, PT_WHITESPACE, // 80
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 81
+            PT_KW_THROW, PT_WHITESPACE, // 82
+            PT_OP_ASS, PT_OP_BANDASS, PT_OP_BORASS, PT_OP_DIVASS, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_PLUSASS, PT_OP_RSHIFTASS, PT_OP_STARASS, PT_OP_XORASS, PT_WHITESPACE, // 83
+            PT_OP_BORASS, PT_WHITESPACE, // 84
+            PT_OP_XORASS, PT_WHITESPACE, // 85
+            PT_OP_BANDASS, PT_WHITESPACE, // 86
+            PT_OP_LSHIFTASS, PT_WHITESPACE, // 87
+            PT_OP_RSHIFTASS, PT_WHITESPACE, // 88
+            PT_OP_MINUSASS, PT_WHITESPACE, // 89
+            PT_OP_PLUSASS, PT_WHITESPACE, // 90
+            PT_OP_MODASS, PT_WHITESPACE, // 91
+            PT_OP_DIVASS, PT_WHITESPACE, // 92
+            PT_OP_STARASS, PT_WHITESPACE, // 93
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 94
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_LSQUARE, PT_WHITESPACE, // 95
+            PT_KW_ALIGNAS, PT_KW_BREAK, PT_KW_CONTINUE, PT_KW_GOTO, PT_KW_RETURN, PT_OP_LSQUARE, PT_WHITESPACE, // 96
+            PT_KW_ALIGNAS, PT_KW_DO, PT_KW_FOR, PT_KW_WHILE, PT_OP_LSQUARE, PT_WHITESPACE, // 97
+            PT_KW_ALIGNAS, PT_KW_IF, PT_KW_SWITCH, PT_OP_LSQUARE, PT_WHITESPACE, // 98
+            PT_KW_ALIGNAS, PT_OP_LBRACE, PT_OP_LSQUARE, PT_WHITESPACE, // 99
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 100
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 101
+            PT_KW_ALIGNAS, PT_KW_CASE, PT_KW_DEFAULT, PT_OP_LSQUARE, PT_TT_IDENTIFIER, PT_WHITESPACE, // 102
+            PT_KW_ALIGNAS, PT_KW_CASE, PT_OP_LSQUARE, PT_WHITESPACE, // 103
+            PT_KW_ALIGNAS, PT_KW_DEFAULT, PT_OP_LSQUARE, PT_WHITESPACE, // 104
+            PT_KW_ALIGNAS, PT_OP_LSQUARE, PT_TT_IDENTIFIER, PT_WHITESPACE, // 105
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 106
+            PT_KW_IF, PT_KW_SWITCH, PT_WHITESPACE, // 107
+            PT_KW_IF, PT_WHITESPACE, // 108
+            PT_KW_SWITCH, PT_WHITESPACE, // 109
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 110
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 111
+            PT_KW_DO, PT_KW_FOR, PT_KW_WHILE, PT_WHITESPACE, // 112
+            PT_KW_FOR, PT_WHITESPACE, // 113
+            PT_KW_DO, PT_WHITESPACE, // 114
+            PT_KW_WHILE, PT_WHITESPACE, // 115
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 116
+            PT_KW_BREAK, PT_KW_CONTINUE, PT_KW_GOTO, PT_KW_RETURN, PT_WHITESPACE, // 117
+            PT_KW_GOTO, PT_WHITESPACE, // 118
+            PT_KW_RETURN, PT_WHITESPACE, // 119
+            PT_KW_CONTINUE, PT_WHITESPACE, // 120
+            PT_KW_BREAK, PT_WHITESPACE, // 121
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_SEMICOLON, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 122
+            PT_KW_ALIGNAS, PT_OP_LSQUARE, PT_WHITESPACE, // 123
+            PT_OP_SEMICOLON, PT_WHITESPACE, // 124
+            PT_KW_INLINE, PT_KW_NAMESPACE, PT_WHITESPACE, // 125
+            PT_KW_EXTERN, PT_WHITESPACE, // 126
+            PT_KW_TEMPLATE, PT_WHITESPACE, // 127
+            PT_KW_EXTERN, PT_KW_TEMPLATE, PT_WHITESPACE, // 128
+            PT_KW_ENUM, PT_WHITESPACE, // 129
+            PT_KW_USING, PT_WHITESPACE, // 130
+            PT_KW_STATIC_ASSERT, PT_WHITESPACE, // 131
+            PT_KW_ALIGNAS, PT_KW_USING, PT_OP_LSQUARE, PT_WHITESPACE, // 132
+            PT_KW_NAMESPACE, PT_WHITESPACE, // 133
+            PT_KW_ASM, PT_WHITESPACE, // 134
+            PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 135
+            PT_KW_CONSTEXPR, PT_WHITESPACE, // 136
+            PT_KW_TYPEDEF, PT_WHITESPACE, // 137
+            PT_KW_FRIEND, PT_WHITESPACE, // 138
+            PT_KW_EXPLICIT, PT_KW_INLINE, PT_KW_VIRTUAL, PT_WHITESPACE, // 139
+            PT_KW_EXTERN, PT_KW_MUTABLE, PT_KW_REGISTER, PT_KW_STATIC, PT_KW_THREAD_LOCAL, PT_WHITESPACE, // 140
+            PT_KW_MUTABLE, PT_WHITESPACE, // 141
+            PT_KW_THREAD_LOCAL, PT_WHITESPACE, // 142
+            PT_KW_STATIC, PT_WHITESPACE, // 143
+            PT_KW_REGISTER, PT_WHITESPACE, // 144
+            PT_KW_EXPLICIT, PT_WHITESPACE, // 145
+            PT_KW_VIRTUAL, PT_WHITESPACE, // 146
+            PT_KW_INLINE, PT_WHITESPACE, // 147
+            PT_KW_CLASS, PT_KW_STRUCT, PT_KW_UNION, PT_WHITESPACE, // 148
+            PT_KW_CONST, PT_KW_VOLATILE, PT_WHITESPACE, // 149
+            PT_KW_CLASS, PT_KW_ENUM, PT_KW_STRUCT, PT_KW_UNION, PT_WHITESPACE, // 150
+            PT_KW_CHAR, PT_WHITESPACE, // 151
+            PT_KW_CHAR16_T, PT_WHITESPACE, // 152
+            PT_KW_WCHAR_T, PT_WHITESPACE, // 153
+            PT_KW_AUTO, PT_WHITESPACE, // 154
+            PT_KW_VOID, PT_WHITESPACE, // 155
+            PT_KW_DOUBLE, PT_WHITESPACE, // 156
+            PT_KW_FLOAT, PT_WHITESPACE, // 157
+            PT_KW_UNSIGNED, PT_WHITESPACE, // 158
+            PT_KW_LONG, PT_WHITESPACE, // 159
+            PT_KW_SIGNED, PT_WHITESPACE, // 160
+            PT_KW_INT, PT_WHITESPACE, // 161
+            PT_KW_SHORT, PT_WHITESPACE, // 162
+            PT_KW_BOOL, PT_WHITESPACE, // 163
+            PT_KW_CHAR32_T, PT_WHITESPACE, // 164
+            PT_OP_COLON, PT_WHITESPACE, // 165
+            PT_KW_ALIGNAS, PT_WHITESPACE, // 166
+            PT_OP_COMMA, PT_TT_IDENTIFIER, PT_WHITESPACE, // 167
+            PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_ST_NONPAREN, PT_WHITESPACE, // 168
+            PT_ST_NONPAREN, PT_WHITESPACE, // 169
+            PT_KW_DECLTYPE, PT_KW_OPERATOR, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DOTS, PT_OP_LAND, PT_OP_LPAREN, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 170
+            PT_KW_DECLTYPE, PT_KW_OPERATOR, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DOTS, PT_OP_LPAREN, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 171
+            PT_KW_DECLTYPE, PT_KW_OPERATOR, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DOTS, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 172
+            PT_OP_LPAREN, PT_OP_LSQUARE, PT_WHITESPACE, // 173
+            PT_OP_LAND, PT_WHITESPACE, // 174
+            PT_KW_VOLATILE, PT_WHITESPACE, // 175
+            PT_KW_CONST, PT_WHITESPACE, // 176
+            PT_OP_AMP, PT_OP_LAND, PT_WHITESPACE, // 177
+            PT_KW_DECLTYPE, PT_OP_AMP, PT_OP_ARROW, PT_OP_COLON2, PT_OP_DOTS, PT_OP_LAND, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_STAR, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 178
+            PT_OP_ARROW, PT_OP_LPAREN, PT_OP_LSQUARE, PT_WHITESPACE, // 179
+            PT_KW_DECLTYPE, PT_OP_AMP, PT_OP_COLON2, PT_OP_DOTS, PT_OP_LAND, PT_OP_STAR, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 180
+            PT_KW_DECLTYPE, PT_OP_AMP, PT_OP_COLON2, PT_OP_LAND, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_STAR, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 181
+            PT_OP_DOTS, PT_WHITESPACE, // 182
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_DOTS, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 183
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_LBRACE, PT_WHITESPACE, // 184
+            PT_OP_COLON, PT_OP_LBRACE, PT_WHITESPACE, // 185
+            PT_KW_TRY, PT_WHITESPACE, // 186
+            PT_OP_ASS, PT_OP_LBRACE, PT_OP_LPAREN, PT_WHITESPACE, // 187
+            PT_OP_ASS, PT_OP_LBRACE, PT_WHITESPACE, // 188
+            PT_ST_FINAL, PT_WHITESPACE, // 189
+            PT_KW_UNION, PT_WHITESPACE, // 190
+            PT_KW_STRUCT, PT_WHITESPACE, // 191
+            PT_KW_CLASS, PT_WHITESPACE, // 192
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 193
+            PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_WHITESPACE, // 194
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 195
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_KW_OPERATOR, PT_OP_AMP, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DOTS, PT_OP_LAND, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 196
+            PT_KW_ALIGNAS, PT_OP_COLON, PT_OP_LSQUARE, PT_TT_IDENTIFIER, PT_WHITESPACE, // 197
+            PT_ST_FINAL, PT_ST_OVERRIDE, PT_WHITESPACE, // 198
+            PT_ST_OVERRIDE, PT_WHITESPACE, // 199
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_VIRTUAL, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 200
+            PT_KW_ALIGNAS, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_OP_LSQUARE, PT_WHITESPACE, // 201
+            PT_KW_ALIGNAS, PT_KW_VIRTUAL, PT_OP_LSQUARE, PT_WHITESPACE, // 202
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 203
+            PT_KW_PUBLIC, PT_WHITESPACE, // 204
+            PT_KW_PROTECTED, PT_WHITESPACE, // 205
+            PT_KW_PRIVATE, PT_WHITESPACE, // 206
+            PT_KW_DECLTYPE, PT_OP_COLON2, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 207
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 208
+            PT_KW_CLASS, PT_KW_TEMPLATE, PT_KW_TYPENAME, PT_WHITESPACE, // 209
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ENUM, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // 210
+            PT_KW_CATCH, PT_WHITESPACE, // 211
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STRUCT, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_DOTS, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 212
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STRUCT, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // 213
+            PT_KW_NOEXCEPT, PT_KW_THROW, PT_WHITESPACE, // 214
+        };
+        return lists;
+    }
+
+    static const int TABLE_SETS = 215;
+
+    static const EPostTokenType* followLists()
+    {
+        static const EPostTokenType lists[] = {
+            PT_WHITESPACE, // translation-unit
+            PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // primary-expression
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // type-name
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // class-name
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // enum-name
+            PT_OP_COLON2, PT_OP_SEMICOLON, PT_WHITESPACE, // namespace-name
+            PT_ST_LT, PT_WHITESPACE, // template-name
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // typedef-name
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // simple-template-id
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // id-expression
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // unqualified-id
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // qualified-id
+            PT_KW_OPERATOR, PT_KW_TEMPLATE, PT_OP_COMPL, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // nested-name-specifier
+            PT_KW_OPERATOR, PT_KW_TEMPLATE, PT_OP_COMPL, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // nested-name-specifier-root
+            PT_KW_OPERATOR, PT_KW_TEMPLATE, PT_OP_COMPL, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // nested-name-specifier-suffix
+            PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // lambda-expression
+            PT_OP_LBRACE, PT_OP_LPAREN, PT_WHITESPACE, // lambda-introducer
+            PT_OP_RSQUARE, PT_WHITESPACE, // lambda-capture
+            PT_OP_COMMA, PT_OP_RSQUARE, PT_WHITESPACE, // capture-default
+            PT_OP_RSQUARE, PT_WHITESPACE, // capture-list
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_RSQUARE, PT_WHITESPACE, // capture
+            PT_OP_LBRACE, PT_WHITESPACE, // lambda-declarator
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // postfix-expression
+            PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // postfix-root
+            PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // postfix-suffix
+            PT_OP_RPAREN, PT_WHITESPACE, // expression-list
+            PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // pseudo-destructor-name
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // unary-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // unary-operator
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // new-expression
+            PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STRUCT, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LPAREN, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // new-placement
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // new-type-id
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // new-declarator
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // noptr-new-declarator
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // new-initializer
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // delete-expression
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // noexcept-expression
+            PT_OP_AMP, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // cast-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // cast-operator
+            PT_OP_AMP, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // pm-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // pm-operator
+            PT_OP_AMP, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // multiplicative-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // multiplicative-operator
+            PT_OP_AMP, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // additive-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // additive-operator
+            PT_OP_AMP, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_LAND, PT_OP_LE, PT_OP_LOR, PT_OP_LSHIFTASS, PT_OP_LT, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // shift-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // shift-operator
+            PT_OP_AMP, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_EQ, PT_OP_LAND, PT_OP_LOR, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // relational-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // relational-operator
+            PT_OP_AMP, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_LAND, PT_OP_LOR, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // equality-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // equality-operator
+            PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_LAND, PT_OP_LOR, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // and-expression
+            PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_LAND, PT_OP_LOR, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // exclusive-or-expression
+            PT_OP_ASS, PT_OP_BANDASS, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_LAND, PT_OP_LOR, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // inclusive-or-expression
+            PT_OP_ASS, PT_OP_BANDASS, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_LOR, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // logical-and-expression
+            PT_OP_ASS, PT_OP_BANDASS, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DIVASS, PT_OP_DOTS, PT_OP_LSHIFTASS, PT_OP_MINUSASS, PT_OP_MODASS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STARASS, PT_OP_XORASS, PT_ST_GT, PT_WHITESPACE, // logical-or-expression
+            PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_ST_GT, PT_WHITESPACE, // conditional-expression
+            PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_ST_GT, PT_WHITESPACE, // assignment-expression
+            PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_INT, PT_KW_LONG, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC_CAST, PT_KW_THIS, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNSIGNED, PT_KW_VOID, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // assignment-operator
+            PT_OP_COLON, PT_OP_RPAREN, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_WHITESPACE, // expression
+            PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_ST_GT, PT_WHITESPACE, // constant-expression
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // statement
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // labeled-statement
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // expression-statement
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CATCH, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LNOT, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_EOF, PT_ST_GT, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // compound-statement
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // selection-statement
+            PT_OP_RPAREN, PT_OP_SEMICOLON, PT_WHITESPACE, // condition-declaration
+            PT_OP_RPAREN, PT_OP_SEMICOLON, PT_WHITESPACE, // condition
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // iteration-statement
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_DECLTYPE, PT_KW_DELETE, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // for-init-statement
+            PT_OP_COLON, PT_WHITESPACE, // for-range-declaration
+            PT_OP_RPAREN, PT_WHITESPACE, // for-range-initializer
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // jump-statement
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // declaration-statement
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // declaration
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // block-declaration
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // alias-declaration
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // simple-declaration
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // static_assert-declaration
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // empty-declaration
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // attribute-declaration
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DOTS, PT_OP_LAND, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_GT, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // decl-specifier
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_KW_OPERATOR, PT_OP_AMP, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DOTS, PT_OP_LAND, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_GT, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // decl-specifier-seq
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DOTS, PT_OP_LAND, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_GT, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // storage-class-specifier
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DOTS, PT_OP_LAND, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_GT, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // function-specifier
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // type-specifier
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // trailing-type-specifier
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // type-specifier-seq
+            PT_KW_DECLTYPE, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // trailing-type-specifier-seq
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // simple-type-specifier
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // decltype-specifier
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // elaborated-type-specifier
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // enum-specifier
+            PT_OP_LBRACE, PT_WHITESPACE, // enum-head
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // opaque-enum-declaration
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_OP_COLON, PT_OP_COLON2, PT_OP_LBRACE, PT_OP_LSQUARE, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // enum-key
+            PT_OP_LBRACE, PT_OP_SEMICOLON, PT_WHITESPACE, // enum-base
+            PT_OP_COMMA, PT_OP_RBRACE, PT_WHITESPACE, // enumerator-list
+            PT_OP_COMMA, PT_OP_RBRACE, PT_WHITESPACE, // enumerator-definition
+            PT_OP_ASS, PT_OP_COMMA, PT_OP_RBRACE, PT_WHITESPACE, // enumerator
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // namespace-definition
+            PT_OP_RBRACE, PT_WHITESPACE, // namespace-body
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // namespace-alias-definition
+            PT_OP_SEMICOLON, PT_WHITESPACE, // qualified-namespace-specifier
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // using-declaration
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // using-directive
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // asm-definition
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // linkage-specification
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LNOT, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // attribute-specifier
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LNOT, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // alignment-specifier
+            PT_OP_RSQUARE, PT_WHITESPACE, // attribute-list
+            PT_OP_COMMA, PT_OP_RSQUARE, PT_WHITESPACE, // attribute-part
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_RSQUARE, PT_WHITESPACE, // attribute
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_LPAREN, PT_OP_RSQUARE, PT_WHITESPACE, // attribute-token
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_LPAREN, PT_OP_RSQUARE, PT_WHITESPACE, // attribute-scoped-token
+            PT_OP_COLON2, PT_WHITESPACE, // attribute-namespace
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_RSQUARE, PT_WHITESPACE, // attribute-argument-clause
+            PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSQUARE, PT_ST_NONPAREN, PT_WHITESPACE, // balanced-token
+            PT_OP_SEMICOLON, PT_WHITESPACE, // init-declarator-list
+            PT_OP_COMMA, PT_OP_SEMICOLON, PT_WHITESPACE, // init-declarator
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // declarator
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // ptr-declarator
+            PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // noptr-declarator
+            PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // noptr-declarator-root
+            PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // noptr-declarator-suffix
+            PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // parameters-and-qualifiers
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // trailing-return-type
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_KW_OPERATOR, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // ptr-operator
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NOEXCEPT, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // cv-qualifier
+            PT_KW_ALIGNAS, PT_KW_NOEXCEPT, PT_KW_THROW, PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // ref-qualifier
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // declarator-id
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_GT, PT_WHITESPACE, // type-id
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // abstract-declarator
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // ptr-abstract-declarator
+            PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // noptr-abstract-declarator
+            PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // noptr-abstract-declarator-root
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // abstract-pack-declarator
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // noptr-abstract-pack-declarator
+            PT_OP_RPAREN, PT_WHITESPACE, // parameter-declaration-clause
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_RPAREN, PT_WHITESPACE, // parameter-declaration-list
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_RPAREN, PT_ST_GT, PT_WHITESPACE, // parameter-declaration
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // function-definition
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // function-body
+            PT_OP_COMMA, PT_OP_SEMICOLON, PT_WHITESPACE, // initializer
+            PT_OP_COMMA, PT_OP_SEMICOLON, PT_WHITESPACE, // brace-or-equal-initializer
+            PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_ST_GT, PT_WHITESPACE, // initializer-clause
+            PT_OP_COMMA, PT_OP_RBRACE, PT_OP_RPAREN, PT_WHITESPACE, // initializer-list
+            PT_OP_COMMA, PT_OP_RBRACE, PT_OP_RPAREN, PT_WHITESPACE, // initializer-clause-dots
+            PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_GT, PT_ST_RSHIFT_1, PT_WHITESPACE, // braced-init-list
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // class-specifier
+            PT_OP_LBRACE, PT_WHITESPACE, // class-head
+            PT_OP_COLON, PT_OP_LBRACE, PT_ST_FINAL, PT_WHITESPACE, // class-head-name
+            PT_OP_COLON, PT_OP_LBRACE, PT_WHITESPACE, // class-virt-specifier
+            PT_KW_ALIGNAS, PT_KW_DECLTYPE, PT_KW_TEMPLATE, PT_OP_COLON, PT_OP_COLON2, PT_OP_LBRACE, PT_OP_LSQUARE, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // class-key
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // member-specification
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // member-declaration
+            PT_OP_SEMICOLON, PT_WHITESPACE, // member-declarator-list
+            PT_OP_COMMA, PT_OP_SEMICOLON, PT_WHITESPACE, // member-declarator
+            PT_KW_TRY, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_LBRACE, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_OVERRIDE, PT_WHITESPACE, // virt-specifier
+            PT_OP_COMMA, PT_OP_SEMICOLON, PT_WHITESPACE, // pure-specifier
+            PT_OP_LBRACE, PT_WHITESPACE, // base-clause
+            PT_OP_LBRACE, PT_WHITESPACE, // base-specifier-list
+            PT_OP_COMMA, PT_OP_LBRACE, PT_WHITESPACE, // base-specifier-dots
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_WHITESPACE, // base-specifier
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_WHITESPACE, // class-or-decltype
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_WHITESPACE, // base-type-specifier
+            PT_KW_DECLTYPE, PT_KW_VIRTUAL, PT_OP_COLON, PT_OP_COLON2, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // access-specifier
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // conversion-function-id
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // conversion-type-id
+            PT_OP_LBRACE, PT_WHITESPACE, // ctor-initializer
+            PT_OP_LBRACE, PT_WHITESPACE, // mem-initializer-list
+            PT_OP_COMMA, PT_OP_LBRACE, PT_WHITESPACE, // mem-initializer-dots
+            PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_WHITESPACE, // mem-initializer
+            PT_OP_LBRACE, PT_OP_LPAREN, PT_WHITESPACE, // mem-initializer-id
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_LT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // operator-function-id
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_LT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // literal-operator-id
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // template-declaration
+            PT_ST_GT, PT_WHITESPACE, // template-parameter-list
+            PT_OP_COMMA, PT_ST_GT, PT_WHITESPACE, // template-parameter
+            PT_OP_COMMA, PT_ST_GT, PT_WHITESPACE, // type-parameter
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_WHITESPACE, // template-id
+            PT_ST_GT, PT_WHITESPACE, // template-argument-list
+            PT_OP_COMMA, PT_ST_GT, PT_WHITESPACE, // template-argument-dots
+            PT_OP_COMMA, PT_OP_DOTS, PT_ST_GT, PT_WHITESPACE, // template-argument
+            PT_KW_ALIGNAS, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STRUCT, PT_KW_THREAD_LOCAL, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_AMP, PT_OP_ARROW, PT_OP_ARROWSTAR, PT_OP_ASS, PT_OP_BANDASS, PT_OP_BOR, PT_OP_BORASS, PT_OP_COLON, PT_OP_COLON2, PT_OP_COMMA, PT_OP_COMPL, PT_OP_DEC, PT_OP_DIV, PT_OP_DIVASS, PT_OP_DOT, PT_OP_DOTS, PT_OP_DOTSTAR, PT_OP_EQ, PT_OP_GE, PT_OP_GT, PT_OP_INC, PT_OP_LAND, PT_OP_LBRACE, PT_OP_LE, PT_OP_LOR, PT_OP_LPAREN, PT_OP_LSHIFT, PT_OP_LSHIFTASS, PT_OP_LSQUARE, PT_OP_LT, PT_OP_MINUS, PT_OP_MINUSASS, PT_OP_MOD, PT_OP_MODASS, PT_OP_NE, PT_OP_PLUS, PT_OP_PLUSASS, PT_OP_QMARK, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSHIFTASS, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_OP_STAR, PT_OP_STARASS, PT_OP_XOR, PT_OP_XORASS, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_ST_RSHIFT_1, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // typename-specifier
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // explicit-instantiation
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // explicit-specialization
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // try-block
+            PT_KW_ALIGNAS, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_DECLTYPE, PT_KW_DOUBLE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FLOAT, PT_KW_FRIEND, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STRUCT, PT_KW_TEMPLATE, PT_KW_THREAD_LOCAL, PT_KW_TYPEDEF, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_OP_COLON2, PT_OP_LSQUARE, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_ST_EOF, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_WHITESPACE, // function-try-block
+            PT_KW_ALIGNAS, PT_KW_ALIGNOF, PT_KW_ASM, PT_KW_AUTO, PT_KW_BOOL, PT_KW_BREAK, PT_KW_CASE, PT_KW_CATCH, PT_KW_CHAR, PT_KW_CHAR16_T, PT_KW_CHAR32_T, PT_KW_CLASS, PT_KW_CONST, PT_KW_CONSTEXPR, PT_KW_CONST_CAST, PT_KW_CONTINUE, PT_KW_DECLTYPE, PT_KW_DEFAULT, PT_KW_DELETE, PT_KW_DO, PT_KW_DOUBLE, PT_KW_DYNAMIC_CAST, PT_KW_ELSE, PT_KW_ENUM, PT_KW_EXPLICIT, PT_KW_EXTERN, PT_KW_FALSE, PT_KW_FLOAT, PT_KW_FOR, PT_KW_FRIEND, PT_KW_GOTO, PT_KW_IF, PT_KW_INLINE, PT_KW_INT, PT_KW_LONG, PT_KW_MUTABLE, PT_KW_NAMESPACE, PT_KW_NEW, PT_KW_NOEXCEPT, PT_KW_NULLPTR, PT_KW_OPERATOR, PT_KW_PRIVATE, PT_KW_PROTECTED, PT_KW_PUBLIC, PT_KW_REGISTER, PT_KW_REINTERPET_CAST, PT_KW_RETURN, PT_KW_SHORT, PT_KW_SIGNED, PT_KW_SIZEOF, PT_KW_STATIC, PT_KW_STATIC_ASSERT, PT_KW_STATIC_CAST, PT_KW_STRUCT, PT_KW_SWITCH, PT_KW_TEMPLATE, PT_KW_THIS, PT_KW_THREAD_LOCAL, PT_KW_THROW, PT_KW_TRUE, PT_KW_TRY, PT_KW_TYPEDEF, PT_KW_TYPEID, PT_KW_TYPENAME, PT_KW_UNION, PT_KW_UNSIGNED, PT_KW_USING, PT_KW_VIRTUAL, PT_KW_VOID, PT_KW_VOLATILE, PT_KW_WCHAR_T, PT_KW_WHILE, PT_OP_AMP, PT_OP_COLON2, PT_OP_COMPL, PT_OP_DEC, PT_OP_INC, PT_OP_LBRACE, PT_OP_LNOT, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_MINUS, PT_OP_PLUS, PT_OP_RBRACE, PT_OP_SEMICOLON, PT_OP_STAR, PT_ST_EOF, PT_TT_IDENTIFIER, PT_TT_IDENTIFIER_C, PT_TT_IDENTIFIER_E, PT_TT_IDENTIFIER_N, PT_TT_IDENTIFIER_T, PT_TT_IDENTIFIER_Y, PT_TT_LITERAL, PT_WHITESPACE, // handler
+            PT_OP_RPAREN, PT_WHITESPACE, // exception-declaration
+            PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_RBRACE, PT_OP_RPAREN, PT_OP_RSQUARE, PT_OP_SEMICOLON, PT_ST_GT, PT_WHITESPACE, // throw-expression
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // exception-specification
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // dynamic-exception-specification
+            PT_OP_RPAREN, PT_WHITESPACE, // type-id-list
+            PT_OP_COMMA, PT_OP_RPAREN, PT_WHITESPACE, // type-id-dots
+            PT_KW_ALIGNAS, PT_KW_TRY, PT_OP_ARROW, PT_OP_ASS, PT_OP_COLON, PT_OP_COMMA, PT_OP_DOTS, PT_OP_LBRACE, PT_OP_LPAREN, PT_OP_LSQUARE, PT_OP_RPAREN, PT_OP_SEMICOLON, PT_ST_FINAL, PT_ST_GT, PT_ST_OVERRIDE, PT_WHITESPACE, // noexcept-specification
+        };
+        return lists;
+    }
+
@@ -16,9 +16,13 @@
 #include <cstring>
 #include <cstdint>
 #include <climits>
+#include <cfloat>
 #include <map>
+#include <mutex>
 
 #include "utf16.cpp"
+#include "floatlit.cpp"
+#include "workerpool.cpp"
 #include "pptoken.cpp"
 
 using namespace std;
@@ -645,28 +649,25 @@ struct DebugPostTokenOutputStream
 
 // use these 3 functions to scan `floating-literals` (see PA2)
 // for example PA2Decode_float("12.34") returns "12.34" as a `float` type
+//
+// Like `istream >> x` out of range values saturate to the largest finite
+// value, but the result is always correctly rounded and no stream is built.
 float PA2Decode_float(const string& s)
 {
-	istringstream iss(s);
-	float x;
-	iss >> x;
-	return x;
+	float x = FloatLiteralDecoder(s.data(), s.data() + s.size()).toFloat();
+	return isinf(x) ? FLT_MAX : x;
 }
 
 double PA2Decode_double(const string& s)
 {
-	istringstream iss(s);
-	double x;
-	iss >> x;
-	return x;
+	double x = FloatLiteralDecoder(s.data(), s.data() + s.size()).toDouble();
+	return isinf(x) ? DBL_MAX : x;
 }
 
 long double PA2Decode_long_double(const string& s)
 {
-	istringstream iss(s);
-	long double x;
-	iss >> x;
-	return x;
+	long double x = FloatLiteralDecoder(s.data(), s.data() + s.size()).toLongDouble();
+	return isinf(x) ? LDBL_MAX : x;
 }
 
 
@@ -693,7 +694,8 @@ class PostTokenizerException : public exception
 };
 
 
-enum EPostTokenType
+// 16 bits wide, see PostToken::tclass
+enum EPostTokenType : unsigned short
 {
     PT_WHITESPACE=0,
     PT_NEWLINE,
@@ -857,7 +859,9 @@ enum EPostTokenType
     PT_ST_FINAL,
     PT_ST_NONPAREN,
     PT_ST_OVERRIDE,
-    PT_ST_ZERO
+    PT_ST_ZERO,
+
+    PT_COUNT    // number of token types, not a token
 };
 
 
@@ -1192,14 +1196,231 @@ const map<EPostTokenType, string> PostTokenTypeToStringMap =
 
 
 
+// PostTokenSpelling: interned spelling of a post token.  Equal spellings
+// share one pooled string, so a spelling is a single pointer that is cheap
+// to copy and compares by address.  The empty spelling is the null pointer.
+class PostTokenSpelling
+{
+  public:
+    PostTokenSpelling()
+        : _str(0)
+    {
+    }
+
+    PostTokenSpelling(const string& s)
+        : _str(intern(s))
+    {
+    }
+
+    PostTokenSpelling(const char* s)
+        : _str(intern(s))
+    {
+    }
+
+    const string& str() const
+    {
+        return _str ? *_str : emptyStr();
+    }
+
+    operator const string& () const
+    {
+        return str();
+    }
+
+    const char* c_str() const
+    {
+        return str().c_str();
+    }
+
+    bool empty() const
+    {
+        return _str == 0;
+    }
+
+    size_t size() const
+    {
+        return _str ? _str->size() : 0;
+    }
+
+    char operator[] (size_t i) const
+    {
+        return (*_str)[i];
+    }
+
+    PostTokenSpelling& operator+= (const string& s)
+    {
+        _str = intern(str() + s);
+        return *this;
+    }
+
+    bool operator== (const PostTokenSpelling& o) const
+    {
+        return _str == o._str;
+    }
+
+    bool operator!= (const PostTokenSpelling& o) const
+    {
+        return _str != o._str;
+    }
+
+    bool operator== (const char* s) const
+    {
+        return str() == s;
+    }
+
+    bool operator!= (const char* s) const
+    {
+        return str() != s;
+    }
+
+    bool operator== (const string& s) const
+    {
+        return str() == s;
+    }
+
+    bool operator!= (const string& s) const
+    {
+        return str() != s;
+    }
+
+    // the spellings in the pool
+    static size_t pooled()
+    {
+        size_t n = 0;
+        for (unsigned i=0; i<SHARDS; i++)
+        {
+            lock_guard<mutex> lock(pools()[i].lock);
+            n += pools()[i].strs.size();
+        }
+        return n;
+    }
+
+  private:
+    enum { SHARDS = 64 };
+
+    // node based sets: element addresses stay valid when they rehash.
+    // Sharded by hash, so that parallel post-tokenizers rarely contend.
+    // Spellings are never freed: SymbolTables and the SymbolDatabase of
+    // `nsdecl -merge` keep them past the units they came from and compare
+    // them by address.  So the pool grows with the distinct spellings of
+    // all the files a process reads, which bounds the memory of a long -j
+    // or -merge batch over many different sources; `nsdecl -stats` prints
+    // pooled().
+    struct Pool
+    {
+        unordered_set<string> strs;
+        mutex                 lock;
+    };
+
+    static Pool* pools()
+    {
+        static Pool p[SHARDS];
+        return p;
+    }
+
+    static const string& emptyStr()
+    {
+        static const string empty;
+        return empty;
+    }
+
+    static const string* intern(const string& s)
+    {
+        if (s.empty())
+        {
+            return 0;
+        }
+        Pool& pool = pools()[hash<string>()(s) % SHARDS];
+        lock_guard<mutex> lock(pool.lock);
+        return &*pool.strs.insert(s).first;
+    }
+
+    const string* _str;
+};
+
+inline ostream& operator<< (ostream& out, const PostTokenSpelling& sp)
+{
+    return out << sp.str();
+}
+
+
+// PostTokenArena: bump allocator holding the literal payloads that do not
+// fit inline in a PostToken.  One arena serves one translation unit and
+// releases all of its payloads at once.
+class PostTokenArena
+{
+  public:
+    PostTokenArena()
+        : _cur(0), _left(0)
+    {
+    }
+
+    ~PostTokenArena()
+    {
+        for (unsigned i=0; i<_blocks.size(); i++)
+        {
+            delete [] _blocks[i];
+        }
+    }
+
+    void* allocate(size_t nbytes)
+    {
+        nbytes = (nbytes + ALIGN - 1) & ~(size_t)(ALIGN - 1);
+
+        // big payloads get a block of their own, keep filling the current one
+        if (nbytes > BLOCKSIZE / 4)
+        {
+            char* blk = new char[nbytes];
+            _blocks.push_back(blk);
+            return blk;
+        }
+
+        if (nbytes > _left)
+        {
+            _cur = new char[BLOCKSIZE];
+            _left = BLOCKSIZE;
+            _blocks.push_back(_cur);
+        }
+
+        void* p = _cur;
+        _cur += nbytes;
+        _left -= nbytes;
+        return p;
+    }
+
+    // take over the payloads of `other`, which is left empty
+    void splice(PostTokenArena& other)
+    {
+        _blocks.insert(_blocks.end(), other._blocks.begin(), other._blocks.end());
+        other._blocks.clear();
+        other._cur = 0;
+        other._left = 0;
+    }
+
+  private:
+    enum { BLOCKSIZE = 64 * 1024, ALIGN = 16 };
+
+    // payloads are referenced by raw pointer from the tokens, never copy
+    PostTokenArena(const PostTokenArena&);
+    PostTokenArena& operator= (const PostTokenArena&);
+
+    vector<char*> _blocks;
+    char*         _cur;
+    size_t        _left;
+};
+
+
 struct PostToken
 {
 
-// file name data base
+// file name data base; like the spellings, the names are never freed, one
+// for each file read
 // 
 static map<string, string*> fdb;
+static mutex fdbLock;
 static string* setFname(const string& fname) 
 {
+    lock_guard<mutex> lock(fdbLock);
     map<string, string*>::iterator mit = fdb.find(fname);
     if (mit != fdb.end()) {
         return mit->second;
@@ -1212,22 +1433,35 @@ static string* setFname(const string& fname)
     return NULL;
 }
 
+    // payloads up to this size are stored in the token itself
+    static const int INLINE_BYTES = 16;
+
+    PostToken()
+        : type(PT_INVALID), tclass(0), ltype(FT_NULLPTR_T), size(0), fline(-1), fname(0)
+    {
+        _payload.ptr = 0;
+    }
 
+    // the scalar fields come first so that the token packs into 64 bytes
     EPostTokenType type;
-    string source;
-    string udSuffix;
-    string udPrefix;
+
+    // set by the parser: which of its token classes the token is in, so
+    // that the token is classified only once (see Recognizer::classify)
+    unsigned short tclass;
 
     // for literal
     EFundamentalType ltype;
     int   size;
-    void* data;
 
     // for token trace
-    string* fname; 
     int     fline;
+    string* fname; 
 
-    int bytes()
+    PostTokenSpelling source;
+    PostTokenSpelling udSuffix;
+    PostTokenSpelling udPrefix;
+
+    int bytes() const
     {
         int bsize = size;
         if (ltype==FT_SIGNED_CHAR || ltype==FT_UNSIGNED_CHAR || ltype==FT_CHAR || ltype==FT_BOOL)
@@ -1253,82 +1487,33 @@ static string* setFname(const string& fname)
         return bsize;
     }
 
-    void emit()
+    // literal payload, `bytes()` bytes long
+    const void* data() const
     {
-        int nbytes = bytes();
-
-        if (type == PT_INVALID)
-        {
-		    cout << "invalid " << source << endl;
-        }
-        else if (type == PT_SIMPLE)
-        {
-		    cout << "identifier " << source << endl;
-        }
-        else if (type == PT_LITERAL)
-        {
-            {
-		        cout << "literal " << source << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
-            }
-        }
-        else if (type == PT_LITERAL_ARRAY)
-        {
-            if (ltype == FT_UNSIGNED_CHAR)
-                ltype = FT_CHAR;
+        return (bytes() <= INLINE_BYTES) ? (const void*)_payload.bytes : _payload.ptr;
+    }
 
-		    cout << "literal " << source << " array of " << size << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
-        } 
-        else if (type == PT_UD_LITERAL)
-        {
-            if (ltype == FT_CHAR || ltype == FT_CHAR16_T || ltype == FT_CHAR32_T || ltype == FT_WCHAR_T)
-            {
-		        cout << "user-defined-literal " << source << " " << udSuffix << " character " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
-            }
-            else if (ltype == FT_INT)
-            {
-		        cout << "user-defined-literal " << source << " " << udSuffix << " integer " << udPrefix << endl;
-            }
-            else if (ltype == FT_FLOAT)
-            {
-		        cout << "user-defined-literal " << source << " " << udSuffix << " floating " << udPrefix << endl;
-            }
-        }
-        else if (type == PT_UD_LITERAL_ARRAY)
-        {
-            if (ltype == FT_UNSIGNED_CHAR)
-                ltype = FT_CHAR;
+    // copy in the payload described by `ltype` and `size`, which must be
+    // set beforehand.  Only payloads bigger than INLINE_BYTES use the arena.
+    void setData(const void* addr, PostTokenArena& arena)
+    {
+        memcpy(allocData(arena), addr, bytes());
+    }
 
-		    cout << "user-defined-literal " << source << " " << udSuffix << " string array of " << size << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
-        }
-        else if (type == PT_EOF)
-        {
-		    cout << "eof" << endl;
-        } 
-        else if (type == PT_NEWLINE)
-        {
-            // do nothing
-        }
-        else if (type == PT_WHITESPACE)
-        {
-            // do nothing
-        }
-        else if (type > PT_INVALID)
-        {
-            if (type == PT_OP_HASH || type == PT_OP_HASHHASH)
-            {
-                cout << "invalid " << source << endl;
-            }
-            else {
-		        cout << "simple " << source << " " << PostTokenTypeToStringMap.at(type) << endl;
-            }
-        }
-        else
+    // storage for the payload described by `ltype` and `size`, to be
+    // filled in place by the caller
+    void* allocData(PostTokenArena& arena)
+    {
+        int nbytes = bytes();
+        if (nbytes <= INLINE_BYTES)
         {
-            cout << "emit error" << endl;
+            return _payload.bytes;
         }
+        _payload.ptr = arena.allocate(nbytes);
+        return _payload.ptr;
     }
 
-    void emit(ofstream& fout)
+    void emit(ostream& fout = cout)
     {
         int nbytes = bytes();
 
@@ -1343,7 +1528,7 @@ static string* setFname(const string& fname)
         else if (type == PT_LITERAL)
         {
             {
-		        fout << "literal " << source << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
+		        fout << "literal " << source << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data(), nbytes) << endl;
             }
         }
         else if (type == PT_LITERAL_ARRAY)
@@ -1351,13 +1536,13 @@ static string* setFname(const string& fname)
             if (ltype == FT_UNSIGNED_CHAR)
                 ltype = FT_CHAR;
 
-		    fout << "literal " << source << " array of " << size << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
+		    fout << "literal " << source << " array of " << size << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data(), nbytes) << endl;
         } 
         else if (type == PT_UD_LITERAL)
         {
             if (ltype == FT_CHAR || ltype == FT_CHAR16_T || ltype == FT_CHAR32_T || ltype == FT_WCHAR_T)
             {
-		        fout << "user-defined-literal " << source << " " << udSuffix << " character " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
+		        fout << "user-defined-literal " << source << " " << udSuffix << " character " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data(), nbytes) << endl;
             }
             else if (ltype == FT_INT)
             {
@@ -1373,7 +1558,7 @@ static string* setFname(const string& fname)
             if (ltype == FT_UNSIGNED_CHAR)
                 ltype = FT_CHAR;
 
-		    fout << "user-defined-literal " << source << " " << udSuffix << " string array of " << size << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data, nbytes) << endl;
+		    fout << "user-defined-literal " << source << " " << udSuffix << " string array of " << size << " " << FundamentalTypeToStringMap.at(ltype) << " " << HexDump(data(), nbytes) << endl;
         }
         else if (type == PT_EOF)
         {
@@ -1402,10 +1587,22 @@ static string* setFname(const string& fname)
             fout << "emit error" << endl;
         }
     }
+
+  private:
+    union
+    {
+        char        bytes[INLINE_BYTES];
+        void*       ptr;
+        long double align;
+    } _payload;
 };
 
+// tokens are copied around by value everywhere, keep that a plain memcpy
+static_assert(is_trivially_copyable<PostToken>::value, "PostToken must stay trivially copyable");
+
 
 map<string, string*> PostToken::fdb;
+mutex PostToken::fdbLock;
 
 
 class PostTokenizer
@@ -1421,11 +1618,25 @@ class PostTokenizer
     };
 
     PostTokenizer(vector<PPToken>& pplst)
-        : _pplst(pplst)
+        : _pplst(pplst), _arena(&_ownArena), _fname(0)
+    {
+    }
+
+    // tokens keep pointing into `arena` for their large literal payloads,
+    // so it has to outlive every copy of them (normally: one per TU)
+    PostTokenizer(vector<PPToken>& pplst, PostTokenArena& arena)
+        : _pplst(pplst), _arena(&arena), _fname(0)
+    {
+    }
+
+    // for parseOne() only
+    explicit PostTokenizer(PostTokenArena& arena)
+        : _arena(&arena), _fname(0)
     {
     }
 
     PostTokenizer()
+        : _arena(&_ownArena), _fname(0)
     {}
    
 
@@ -1436,12 +1647,18 @@ class PostTokenizer
     vector<PostToken>  _tokens;
 
 
+    PostTokenArena& arena()
+    {
+        return *_arena;
+    }
+
+
     PostToken createToken (EPostTokenType type, 
-                           string src="", 
-                           string fname="",
+                           const string& src="", 
+                           const string& fname="",
                            int    lineNo=-1,
-                           string udSuffix="", 
-                           string udPrefix="", 
+                           const string& udSuffix="", 
+                           const string& udPrefix="", 
                            EFundamentalType ltype=FT_NULLPTR_T, 
                            int size=0, 
                            const void* addr=0)
@@ -1453,58 +1670,33 @@ class PostTokenizer
         pt.udPrefix = udPrefix;
         pt.ltype = ltype;
         pt.size = size;
-        pt.setFname(fname);
+        // consecutive tokens mostly come from the same file
+        if (_fname == 0 || *_fname != fname)
+        {
+            _fname = PostToken::setFname(fname);
+        }
+        pt.fname = _fname;
         pt.fline = lineNo;
         
-        // for different type
         if (size > 0)
         {
-            int bsize = size;
-            if (ltype==FT_SIGNED_CHAR || ltype==FT_UNSIGNED_CHAR || ltype==FT_CHAR || ltype==FT_BOOL)
-            {
-                bsize *= 1;
-            }
-            else if (ltype==FT_SHORT_INT || ltype==FT_UNSIGNED_SHORT_INT || ltype==FT_CHAR16_T)
-            {
-                bsize *= 2;
-            }
-            else if (ltype==FT_INT || ltype==FT_UNSIGNED_INT || ltype==FT_CHAR32_T || ltype==FT_WCHAR_T || ltype==FT_FLOAT)
-            {
-                bsize *= 4;
-            }
-            else if (ltype==FT_LONG_INT || ltype==FT_LONG_LONG_INT || ltype==FT_UNSIGNED_LONG_INT || ltype==FT_UNSIGNED_LONG_LONG_INT || ltype==FT_DOUBLE || ltype==FT_NULLPTR_T)
-            {
-                bsize *= 8;
-            }
-            else if (ltype==FT_LONG_DOUBLE)
-            {
-                bsize *= 16;
-            }
-
-            char* ary = new char[bsize];
-            memcpy(ary, (char*)addr, bsize); 
-            pt.data = ary;
-        }
-        else
-        {
-            pt.data = 0;
+            pt.setData(addr, *_arena);
         }
         return pt;
     }
 
 
     void addToken(EPostTokenType type, 
-                  string src="", 
-                  string fname="",
+                  const string& src="", 
+                  const string& fname="",
                   int    fline=-1,
-                  string udSuffix="", 
-                  string udPrefix="", 
+                  const string& udSuffix="", 
+                  const string& udPrefix="", 
                   EFundamentalType ltype=FT_NULLPTR_T, 
                   int size=0, 
                   const void* addr=0)
     {
-        PostToken pt = createToken(type, src, fname, fline, udSuffix, udPrefix, ltype, size, addr);
-        _tokens.push_back(pt);
+        _tokens.push_back(createToken(type, src, fname, fline, udSuffix, udPrefix, ltype, size, addr));
     }
 
 
@@ -1671,6 +1863,46 @@ class PostTokenizer
     }
 
 
+    // Post-tokenize `_pplst` on `pool`.  Chunks of pp-tokens are converted
+    // independently into preallocated slots, one per pp-token, each chunk
+    // with its own arena; the slots are then compacted into `_tokens`
+    // dropping whitespace.  String literals are left for the concatenation
+    // stage.
+    void parse(WorkerPool& pool)
+    {
+        const size_t CHUNK = 4096;
+        size_t n = _pplst.size();
+        size_t nchunks = (n + CHUNK - 1) / CHUNK;
+        vector<PostToken> slots(n);
+        vector<PostTokenArena> arenas(nchunks);
+
+        pool.run(nchunks, [&](size_t c)
+        {
+            PostTokenizer worker(arenas[c]);
+            size_t end = min(n, (c + 1) * CHUNK);
+            for (size_t i = c * CHUNK; i < end; i++)
+            {
+                slots[i] = worker.parseOne(_pplst[i]);
+            }
+        });
+
+        size_t m = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (slots[i].type != PT_WHITESPACE)
+            {
+                slots[m++] = slots[i];
+            }
+        }
+        slots.resize(m);
+        for (size_t c = 0; c < nchunks; c++)
+        {
+            _arena->splice(arenas[c]);
+        }
+        _tokens.insert(_tokens.end(), slots.begin(), slots.end());
+    }
+
+
     //PostToken parse_one_string(vector<int>& codes)
     PostToken parse_one_string(PPToken& pp)
     {
@@ -1967,51 +2199,39 @@ class PostTokenizer
         else if (char_width == 2)
         {
             vector<short> utf16_codes = UTF16Encoder::encode( chars );
-            char16_t* data = new char16_t[utf16_codes.size()];
-            for (unsigned int i=0; i<utf16_codes.size(); ++i)
-            {
-                data[i] = utf16_codes[i];
-            }
+            vector<char16_t> data(utf16_codes.begin(), utf16_codes.end());
             if (suffix == "")
             {
-                return createToken(PT_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR16_T, utf16_codes.size(), data);
+                return createToken(PT_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR16_T, data.size(), &data[0]);
             }
             else
             {
-                return createToken(PT_UD_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR16_T, utf16_codes.size(), data);
+                return createToken(PT_UD_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR16_T, data.size(), &data[0]);
             }
         } 
         else if (char_width == 3)
         {
-            char32_t* data = new char32_t[chars.size()];
-            for (unsigned int i=0; i<chars.size(); ++i)
-            {
-                data[i] = chars[i];
-            }
+            vector<char32_t> data(chars.begin(), chars.end());
             if (suffix == "")
             {
-                return createToken(PT_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR32_T, chars.size(), data);
+                return createToken(PT_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR32_T, data.size(), &data[0]);
             }
             else
             {
-                return createToken(PT_UD_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR32_T, chars.size(), data);
+                return createToken(PT_UD_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_CHAR32_T, data.size(), &data[0]);
             }
 
         } 
         else if (char_width == 4)
         {
-            wchar_t* data = new wchar_t[chars.size()];
-            for (unsigned int i=0; i<chars.size(); ++i)
-            {
-                data[i] = chars[i];
-            }
+            vector<wchar_t> data(chars.begin(), chars.end());
             if (suffix == "")
             {
-                return createToken(PT_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_WCHAR_T, chars.size(), data);
+                return createToken(PT_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_WCHAR_T, data.size(), &data[0]);
             }
             else
             {
-                return createToken(PT_UD_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_WCHAR_T, chars.size(), data);
+                return createToken(PT_UD_LITERAL_ARRAY, source, pp_srcfile, pp_lineNo, suffix, prefix, FT_WCHAR_T, data.size(), &data[0]);
             }
         }
 
@@ -2282,13 +2502,45 @@ class PostTokenizer
     }
 
 
-    //PostToken parse_one_ppnumber(vector<int>& codes)
     PostToken parse_one_ppnumber(PPToken& pp)
     {
-        vector<int> codes = pp.data;
+        const vector<int>& codes = pp.data;
+
+#ifdef PA3    
+        string pp_srcfile = "";
+        int pp_lineNo = -1;
+#else
+        string pp_srcfile = pp.srcfile; 
+        int pp_lineNo = pp.lineNo;
+#endif
+
+        //--- integer literals, the common case, take a single pass
+        //
+        unsigned long long value;
+        EFundamentalType itype = FT_INT;
+        size_t iend;
+        EIntegerScan scan = scanIntegerLiteral(codes, value, itype, iend);
+        if (scan != IS_FLOATING)
+        {
+            string source(codes.begin(), codes.end());
+            if (scan == IS_INVALID)
+            {
+                return createToken(PT_INVALID, source);
+            }
+            string numS(codes.begin(), codes.begin() + iend);
+            string s(codes.begin() + iend, codes.end());
+            if (scan == IS_UD_INTEGER)
+            {
+                return createToken(PT_UD_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_INT, 1, &value);
+            }
+            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, itype, 1, &value);
+        }
+
+        //--- floating literals
+        //
         int la = -1;
         int state = 0;  // initial state 
-        vector<int>::iterator idx = codes.begin();
+        vector<int>::const_iterator idx = codes.begin();
         bool stop = false;
        
         while ( idx != codes.end() )
@@ -2316,11 +2568,7 @@ class PostTokenizer
                     }
                     break;
                 case 1:
-                    if (la == 'x')
-                    {
-                        state = 2;
-                    }
-                    else if ( isOctal(la) )
+                    if ( isOctal(la) )
                     {
                         state = 4;
                     } 
@@ -2341,32 +2589,12 @@ class PostTokenizer
                         stop = true;
                     }
                     break;
-                case 2:
-                    if ( isHex(la) ) 
+                case 4:
+                    if ( isOctal(la) )
                     {
-                        state = 3; 
+                        state = 4;
                     }
-                    else
-                    {
-                        stop = true;
-                    }
-                    break;
-                case 3:
-                    if ( isHex(la) )
-                    {
-                        state = 3;
-                    }
-                    else
-                    {
-                        stop = true;
-                    }
-                    break;
-                case 4:
-                    if ( isOctal(la) )
-                    {
-                        state = 4;
-                    }
-                    else if (la == '8' || la == '9') // non-octal
+                    else if (la == '8' || la == '9') // non-octal
                     {
                         state = 5;
                     }
@@ -2374,6 +2602,10 @@ class PostTokenizer
                     {
                         state = 6;
                     }
+                    else if (la == 'e' || la == 'E')
+                    {
+                        state = 8;
+                    }
                     else 
                     {
                         stop = true;
@@ -2388,7 +2620,7 @@ class PostTokenizer
                     {
                         state = 6;
                     }
-                    else if ( la == 'e' || 'E' )
+                    else if ( la == 'e' || la == 'E' )
                     {
                         state = 8;
                     }
@@ -2462,429 +2694,443 @@ class PostTokenizer
             idx++;
         }
 
-        string source = code2string(codes);
-        vector<int> numV(codes.begin(), idx);
-        string numS = code2string(numV);
-        bool isUnsigned = false;
-        bool isLong = false;
-        bool isLonglong = false;
-        bool isFloat = false;
-        // dispatch
-        bool isHexInteger = false;
-        bool isOctalInteger = false;
-        bool isDecimalInteger = false;
-        bool isFloatPoint = false;
-        if (state == 1 || state == 5 || state == 7)  // decimial integer
-        {
-            isDecimalInteger = true;
-        }
-        else if (state == 3)  // hex 
-        {
-            isHexInteger = true;
-        }
-        else if (state == 4) // octal
-        {
-            isOctalInteger = true;
-        }
-        else if (state == 6 || state == 9)
-        {
-            isFloatPoint = true;
-        }
-        else  // invalid
+        string source(codes.begin(), codes.end());
+        if (state != 6 && state != 9)
         {
             return createToken(PT_INVALID, source);
         }
-       
-#ifdef PA3    
-        string pp_srcfile = "";
-        int pp_lineNo = -1;
-#else
-        string pp_srcfile = pp.srcfile; 
-        int pp_lineNo = pp.lineNo;
-#endif
-
-
+        string numS(codes.begin(), idx);
 
         if (stop == true)
         {
             // suffix string
-            vector<int> rest(idx, codes.end());
-            string s = code2string(rest);
+            string s(idx, codes.end());
 
             //--- user defined suffix
             //
             if (s[0] == '_' && checkValidUserDefineSuffix(s))
             {
                 float f = PA2Decode_float( numS );
-                if (state == 6 || state == 9)
-                {
-                    return createToken(PT_UD_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_FLOAT, 1, &f);
-                }
-                else
-                {
-                    return createToken(PT_UD_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_INT, 1, &f);
-                }
+                return createToken(PT_UD_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_FLOAT, 1, &f);
             }
-            else if ( checkNumberLiteralSuffix(s, isUnsigned, isLong, isLonglong, isFloat) )
+            else if (s == "f" || s == "F")
             {
-                unsigned long long value;
-                int bs;
-                if (isDecimalInteger)  // decimial integer
-                {
-                    bs = decimalBits( numS , value );
-                }
-                else if (isHexInteger)  // hex 
-                {
-                    bs = hexBits ( numS , value);
-                }
-                else if (isOctalInteger) // octal
-                {
-                    bs = octalBits ( numS , value);
-                }
-                else if (isFloatPoint)
-                {
-                    // float
-                    float f = PA2Decode_float( numS );
-                    return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_FLOAT, 1, &f);
-                }
+                float f = PA2Decode_float( numS );
+                return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_FLOAT, 1, &f);
+            }
+            else if (s == "l" || s == "L")
+            {
+                // long double, only its 10 x87 bytes are set, keep the padding zero
+                long double value = PA2Decode_long_double( numS );
+                unsigned char bytes[sizeof(long double)] = {};
+                memcpy(bytes, &value, 10);
+                return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_DOUBLE, 1, bytes);
+            }
+            else
+            {
+                // u, ll, ... are integer suffixes
+                return createToken(PT_INVALID, source);
+            }
+        }
 
-                if (isDecimalInteger || isHexInteger || isOctalInteger)
-                {
-                    if ( bs > 64 )
-                    {
-                        // error 
-                        return createToken(PT_INVALID, source);
-                    } 
-                    else if ( bs == 64)
-                    {
-                        if (isUnsigned && isLong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned && isLonglong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                        }
-                        else if (isLong) // long , long long
-                        {
-                            if (isDecimalInteger)
-                            {
-                                return createToken(PT_INVALID, source);
-                            }
-                            else
-                            {
-                                return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                            }
-                        }
-                        else // (isLonglong)
-                        {
-                            if (isDecimalInteger)
-                            {
-                                return createToken(PT_INVALID, source);
-                            }
-                            else
-                            {
-                                return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_LONG_INT, 1, &value);
-                            }
-                        }
+        double dvalue = PA2Decode_double(numS);
+        return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, "", numS, FT_DOUBLE, 1, &dvalue);
+    }
 
-                    }
-                    else if ( bs > 32)
-                    {
-                        // long
-                        if (isUnsigned && isLong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned && isLonglong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                        }
-                        else if (isLong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_INT, 1, &value);
-                        }
-                        else // long long
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_LONG_INT, 1, &value);
-                        }
-                    }
-                    else if (bs == 32)
-                    {
-                        if (isUnsigned && isLong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned && isLonglong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_INT, 1, &value);
-                        }
-                        else if (isLong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_INT, 1, &value);
-                        }
-                        else // long long
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_LONG_INT, 1, &value);
-                        }
-                    }
-                    else
-                    {
-                        if (isUnsigned && isLong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned && isLonglong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_LONG_INT, 1, &value);
-                        }
-                        else if (isUnsigned)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_INT, 1, &value);
-                        }
-                        else if (isLong)
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_INT, 1, &value);
-                        }
-                        else // long long
-                        {
-                            return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_LONG_INT, 1, &value);
-                        }
-                    }
-                }
+
+
+    void parse_ppnumber(PPToken& pp)
+    {
+        _tokens.push_back(parse_one_ppnumber(pp));
+        return;
+    }
+
+    
+    enum EIntegerScan
+    {
+        IS_INTEGER,
+        IS_UD_INTEGER,
+        IS_FLOATING,
+        IS_INVALID
+    };
+
+    // Classify an integer-literal (2.14.2) in one pass over `codes`: the
+    // digits are accumulated with overflow detection, then the suffix is
+    // read and the type taken from Table 6 (int is 32 bits, long and long
+    // long are 64).  `end` receives where the suffix starts.  IS_FLOATING
+    // means the pp-number continues as a floating-literal.
+    EIntegerScan scanIntegerLiteral(const vector<int>& codes, unsigned long long& value, EFundamentalType& type, size_t& end)
+    {
+        size_t n = codes.size();
+        size_t i = 0;
+        unsigned base = 10;
+        if (n > 1 && codes[0] == '0' && (codes[1] == 'x' || codes[1] == 'X'))
+        {
+            base = 16;
+            i = 2;
+        }
+        else if (codes[0] == '0')
+        {
+            base = 8;
+        }
+
+        size_t digits = i;
+        bool overflow = false;
+        bool badOctal = false;
+        value = 0;
+        for (; i < n; i++)
+        {
+            int c = codes[i];
+            unsigned d;
+            if (c >= '0' && c <= '9')
+            {
+                d = c - '0';
             }
-            else //invalid
+            else if (base == 16 && c >= 'a' && c <= 'f')
             {
-                return createToken(PT_INVALID, source);
+                d = c - 'a' + 10;
             }
+            else if (base == 16 && c >= 'A' && c <= 'F')
+            {
+                d = c - 'A' + 10;
+            }
+            else
+            {
+                break;
+            }
+            // 8 and 9 may still be part of a floating literal like 09.5
+            badOctal |= (d >= base);
+            overflow |= (value > (ULLONG_MAX - d) / base);
+            value = value * base + d;
         }
-        else
+
+        if (base != 16 && i < n && (codes[i] == '.' || codes[i] == 'e' || codes[i] == 'E'))
+        {
+            return IS_FLOATING;
+        }
+        end = i;
+        if (i == digits || badOctal)
+        {
+            return IS_INVALID;
+        }
+
+        //--- user defined suffix, the value needs not fit
+        //
+        if (i < n && codes[i] == '_')
+        {
+            string s(codes.begin() + i, codes.end());
+            return checkValidUserDefineSuffix(s) ? IS_UD_INTEGER : IS_INVALID;
+        }
+
+        // unsigned-suffix and long-suffix or long-long-suffix, in any order
+        int u = 0;
+        int l = 0;
+        while (i < n)
+        {
+            int c = codes[i];
+            if ((c == 'u' || c == 'U') && u == 0)
+            {
+                u = 1;
+                i++;
+            }
+            else if ((c == 'l' || c == 'L') && l == 0)
+            {
+                l = (i + 1 < n && codes[i+1] == c) ? 2 : 1;
+                i += l;
+            }
+            else
+            {
+                return IS_INVALID;
+            }
+        }
+        if (overflow)
+        {
+            return IS_INVALID;
+        }
+
+        // candidate types, FT_NULLPTR_T terminated, indexed by [u][l][decimal]
+        static const EFundamentalType candidates[2][3][2][7] =
         {
-            string s="";
-            if (isDecimalInteger || isHexInteger || isOctalInteger)
             {
-                unsigned long long value;
-                int bs;
-                if (isDecimalInteger)  // decimial integer
                 {
-                    bs = decimalBits( numS , value );
-                }
-                else if (isHexInteger)  // hex 
+                    { FT_INT, FT_UNSIGNED_INT, FT_LONG_INT, FT_UNSIGNED_LONG_INT, FT_LONG_LONG_INT, FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T },
+                    { FT_INT, FT_LONG_INT, FT_LONG_LONG_INT, FT_NULLPTR_T }
+                },
                 {
-                    bs = hexBits ( numS , value);
-                }
-                else // octal
+                    { FT_LONG_INT, FT_UNSIGNED_LONG_INT, FT_LONG_LONG_INT, FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T },
+                    { FT_LONG_INT, FT_LONG_LONG_INT, FT_NULLPTR_T }
+                },
                 {
-                    bs = octalBits ( numS , value);
+                    { FT_LONG_LONG_INT, FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T },
+                    { FT_LONG_LONG_INT, FT_NULLPTR_T }
                 }
-    
-                if ( bs > 64 )
-                {
-                    // error 
-                    return createToken(PT_INVALID, source);
-                } 
-                else if ( bs == 64)
+            },
+            {
                 {
-                    if (isDecimalInteger)
-                    {
-                        return createToken(PT_INVALID, source);
-                    }
-                    else
-                    {
-                        return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_LONG_INT, 1, &value);
-                    }
-                }
-                else if ( bs > 32)
+                    { FT_UNSIGNED_INT, FT_UNSIGNED_LONG_INT, FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T },
+                    { FT_UNSIGNED_INT, FT_UNSIGNED_LONG_INT, FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T }
+                },
                 {
-                    // long
-                    return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_INT, 1, &value);
-                }
-                else if (bs == 32)
+                    { FT_UNSIGNED_LONG_INT, FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T },
+                    { FT_UNSIGNED_LONG_INT, FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T }
+                },
                 {
-                    if (isDecimalInteger)
-                    {
-                        return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_LONG_INT, 1, &value);
-                    }
-                    else 
-                    {
-                        return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_UNSIGNED_INT, 1, &value);
-                    }
-                }
-                else
-                {
-                    // int
-                    return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_INT, 1, &value);
+                    { FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T },
+                    { FT_UNSIGNED_LONG_LONG_INT, FT_NULLPTR_T }
                 }
             }
-            else if (isFloatPoint)  // float
+        };
+
+        for (const EFundamentalType* t = candidates[u][l][base == 10]; *t != FT_NULLPTR_T; t++)
+        {
+            bool fits;
+            switch (*t)
             {
-                double value = PA2Decode_double(numS);
-                return createToken(PT_LITERAL, source, pp_srcfile, pp_lineNo, s, numS, FT_DOUBLE, 1, &value);
+                case FT_INT:            fits = (value <= INT_MAX);   break;
+                case FT_UNSIGNED_INT:   fits = (value <= UINT_MAX);  break;
+                case FT_LONG_INT:
+                case FT_LONG_LONG_INT:  fits = (value <= LLONG_MAX); break;
+                default:                fits = true;                 break;
             }
-            else
+            if (fits)
             {
+                type = *t;
+                return IS_INTEGER;
             }
         }
-        return createToken(PT_INVALID, source);
+        return IS_INVALID;
     }
 
+   
+  private:
+    vector<PPToken>            _pplst;
+    DebugPostTokenOutputStream _out;
+    PostTokenArena             _ownArena;
+    PostTokenArena*            _arena;
+    string*                    _fname;
+};
 
 
-    void parse_ppnumber(PPToken& pp)
+// StringLiteralConcat: the string literal concatenation stage that follows
+// post-tokenization.  One linear pass over the tokens joins every run of
+// adjacent string literals and hands each resulting token to `sink`.  A run
+// of one literal is passed on as is; a longer run is sized with one walk
+// over its members' payloads and then encoded straight into the payload of
+// the joined token.
+class StringLiteralConcat
+{
+  public:
+    enum
     {
-        _tokens.push_back(parse_one_ppnumber(pp));
-        return;
-    }
+        REJECT_VA_ARGS = 1,     // throw on a __VA_ARGS__ identifier
+        REJECT_INVALID = 2      // throw on invalid tokens instead of passing them on
+    };
 
-    
-    int hexBits(string s, unsigned long long& val)
-    {
-        unsigned long long value = 0;
-        int size = 0; 
-        bool gotFirstNonZero = false;
-        for (unsigned i=2; i<s.size(); i++)
-        {
-            int tmp = HexCharToValue( s[i] ) ;
-            value = (value << 4) +  tmp;
-            if (tmp != 0 && gotFirstNonZero==false)
-            {
-                gotFirstNonZero = true;
-                if (tmp >= 8)
-                    size += 4;
-                else if (tmp >= 4)
-                    size += 3;
-                else if (tmp >= 2)
-                    size += 2;
-                else
-                    size += 1;
-            } 
-            else if (gotFirstNonZero==true)
-            { 
-                size += 4;
-            }
-        } 
-        val = value;
-        return size;
+    // joined payloads are allocated from `arena`
+    StringLiteralConcat(PostTokenArena& arena, int flags = 0)
+        : _arena(arena), _flags(flags)
+    {
     }
-   
 
-    int decimalBits(string s, unsigned long long& value)
+    // sink(PostToken&) is called once per resulting token, in order
+    template <class Sink>
+    void run(vector<PostToken>& tokens, Sink sink)
     {
-        unsigned long long val = 0;
-        int hb = 0;
-
-        for (unsigned i=0; i<s.size() ; i++)
+        size_t n = tokens.size();
+        size_t i = 0;
+        while (i < n)
         {
-            int tmp = s[i] - '0';
-            val = val * 10 + tmp;
-            int tmp_hb = highestBit( val );
-            if (tmp_hb < hb)
+            if (!isString(tokens[i]))
+            {
+                PostToken& pt = tokens[i++];
+                if ((_flags & REJECT_VA_ARGS) && pt.type == PT_SIMPLE && pt.source == "__VA_ARGS__")
+                {
+                    throw PostTokenizerException("\"__VA_ARGS__\" is not valid identifier");
+                }
+                if ((_flags & REJECT_INVALID) && pt.type == PT_INVALID)
+                {
+                    throw PostTokenizerException("invalid PostToken");
+                }
+                sink(pt);
+                continue;
+            }
+
+            size_t end = i + 1;
+            while (end < n && isString(tokens[end]))
             {
-                // over flow, give something bigger than 64
-                return 65;
+                end++;
             }
-            else 
+
+            if (end - i == 1)
+            {
+                PostToken& pt = tokens[i];
+                if (pt.udSuffix != "" && pt.udSuffix[0] != '_')
+                {
+                    pt.type = PT_INVALID;
+                }
+                finish(pt, sink);
+            }
+            else
             {
-                hb = tmp_hb;
+                PostToken joined = join(tokens, i, end);
+                finish(joined, sink);
             }
+            i = end;
         }
-        value = val;
-        return hb;
     }
 
-
-    int octalBits(string s, unsigned long long& value)
+  private:
+    static bool isString(const PostToken& pt)
     {
-        unsigned long long val = 0;
-        int size = 0; 
-        bool gotFirstNonZero = false;
-        for (unsigned i=0; i<s.size(); i++)
-        {
-            int tmp = HexCharToValue( s[i] ) ;
-            val = (val << 3) + tmp;
-            if (tmp != 0 && gotFirstNonZero==false)
-            {
-                gotFirstNonZero = true;
-                if (tmp >= 4)
-                    size += 3;
-                else if (tmp >= 2)
-                    size += 2;
-                else
-                    size += 1;
-            } 
-            else if (gotFirstNonZero==true)
-            { 
-                size += 3;
-            }
-        } 
-        value = val;
-        return size;
+        return pt.type == PT_LITERAL_ARRAY || pt.type == PT_UD_LITERAL_ARRAY;
     }
 
-
-    int highestBit(unsigned long long v)
+    template <class Sink>
+    void finish(PostToken& pt, Sink& sink)
     {
-        int idx=0;
-        while (v != 0)
+        if ((_flags & REJECT_INVALID) && pt.type == PT_INVALID)
         {
-            v = v>>1;
-            idx++;
+            throw PostTokenizerException("invalid string");
         }
-        return idx;
+        sink(pt);
     }
 
-
-    bool checkNumberLiteralSuffix(string s, bool& isUnsigned, bool& isLong, bool& isLonglong, bool& isFloat)
+    // merge the spelling, suffix and character type of tokens[begin, end)
+    PostToken join(const vector<PostToken>& tokens, size_t begin, size_t end)
     {
-        if (s == "u" || s == "U")
+        PostToken r = tokens[begin];
+        if (r.udSuffix != "" && r.udSuffix[0] != '_')
         {
-            isUnsigned = true;
+            r.type = PT_INVALID;
         }
-        else if (s=="l" || s == "L")
+
+        _source = r.source;
+        for (size_t k = begin + 1; k < end; k++)
         {
-            isLong = true;
+            const PostToken& pt = tokens[k];
+            _source += ' ';
+            _source += pt.source;
+
+            if (r.type == PT_INVALID)
+            {
+                continue;
+            }
+            if (r.udSuffix != "" && pt.udSuffix != "" && r.udSuffix != pt.udSuffix)
+            {
+                r.type = PT_INVALID;
+                continue;
+            }
+            if (r.udSuffix == "")
+            {
+                r.udSuffix = pt.udSuffix;
+            }
+            if (r.udSuffix != "")
+            {
+                if (r.udSuffix[0] != '_')
+                {
+                    r.type = PT_INVALID;
+                    continue;
+                }
+                r.type = PT_UD_LITERAL_ARRAY;
+            }
+            if (r.ltype != FT_CHAR && pt.ltype != FT_CHAR && r.ltype != pt.ltype)
+            {
+                // different char type
+                r.type = PT_INVALID;
+                continue;
+            }
+            if (r.ltype == FT_CHAR)
+            {
+                r.ltype = pt.ltype;
+            }
         }
-        else if (s=="f" || s == "F")
+        r.source = _source;
+
+        if (r.type != PT_INVALID)
         {
-            isFloat = true;
+            encode(tokens, begin, end, r);
         }
-        else if (s == "ll" || s == "LL")
+        return r;
+    }
+
+    // Every member payload ends in a NUL unit that is dropped.  Members
+    // already in r's encoding, and any member when r is narrow (all narrow
+    // literals are UTF-8), are copied unit for unit; plain narrow members of
+    // a wide r are decoded from UTF-8 and widened.
+    void encode(const vector<PostToken>& tokens, size_t begin, size_t end, PostToken& r)
+    {
+        int unit = (r.ltype == FT_CHAR16_T) ? 2 : (r.ltype == FT_CHAR32_T || r.ltype == FT_WCHAR_T) ? 4 : 1;
+
+        int size = 1;
+        for (size_t k = begin; k < end; k++)
         {
-            isLonglong = true;
+            const PostToken& pt = tokens[k];
+            if (unit == 1 || pt.ltype == r.ltype)
+            {
+                size += pt.size - 1;
+                continue;
+            }
+            const unsigned char* p = (const unsigned char*)pt.data();
+            const unsigned char* e = p + pt.size - 1;
+            while (p < e)
+            {
+                size += (nextCode(p, e) >= 0x10000 && unit == 2) ? 2 : 1;
+            }
         }
-        else if (s=="ul" || s == "uL" || s=="Ul" || s=="UL" || s=="lu" || s == "lU" || s=="Lu" || s=="LU")
+
+        r.size = size;
+        char* out = (char*)r.allocData(_arena);
+        for (size_t k = begin; k < end; k++)
         {
-            isUnsigned = true;
-            isLong = true;
+            const PostToken& pt = tokens[k];
+            if (unit == 1 || pt.ltype == r.ltype)
+            {
+                size_t nbytes = (size_t)(pt.size - 1) * unit;
+                memcpy(out, pt.data(), nbytes);
+                out += nbytes;
+                continue;
+            }
+            const unsigned char* p = (const unsigned char*)pt.data();
+            const unsigned char* e = p + pt.size - 1;
+            while (p < e)
+            {
+                int code = nextCode(p, e);
+                if (unit == 4)
+                {
+                    char32_t c = code;
+                    memcpy(out, &c, 4);
+                    out += 4;
+                    continue;
+                }
+                unsigned short w[2];
+                int nw = UTF16Encoder::encode(code, w[0], w[1]) ? 2 : 1;
+                memcpy(out, w, nw * 2);
+                out += nw * 2;
+            }
         }
-        else if (s=="ull" || s=="uLL" || s=="Ull" || s=="ULL" || s=="llu" || s=="llU" || s=="LLu" || s=="LLU")
+        memset(out, 0, unit);
+    }
+
+    // one code point of the UTF-8 in [p, e)
+    static int nextCode(const unsigned char*& p, const unsigned char* e)
+    {
+        int code = *p++;
+        if (code < 0x80)
         {
-            isUnsigned = true;
-            isLonglong = true;
+            return code;
         }
-        else
+        int rest = (code >= 0xF0) ? 3 : (code >= 0xE0) ? 2 : 1;
+        code &= 0x3F >> rest;
+        while (rest-- > 0 && p < e)
         {
-            return false;
+            code = (code << 6) | (*p++ & 0x3F);
         }
-        return true;
-    } 
+        return code;
+    }
 
-   
-  private:
-    vector<PPToken>            _pplst;
-    DebugPostTokenOutputStream _out;
+    PostTokenArena& _arena;
+    int             _flags;
+    string          _source;
 };
 
 
@@ -2923,145 +3169,8 @@ int main()
         PostTokenizer postTokenizer(ppTokenizer._elst);         
         postTokenizer.parse();
 
-        PostToken concatStr;
-        bool bPrevStr = false;
-        vector<int> strCodes;
-
-        for (unsigned i=0 ; i<postTokenizer._tokens.size() ; i++)
-        {
-            PostToken pt = postTokenizer._tokens[i];
-
-            if (pt.type == PT_LITERAL_ARRAY || pt.type == PT_UD_LITERAL_ARRAY)
-            {
-                if (bPrevStr==true)
-                {
-                    concatStr.source += " ";
-                    concatStr.source += pt.source;
-
-                    if (concatStr.type == PT_INVALID)
-                    {
-                        continue;
-                    }
-
-                    int code_unit;
-                    UTF8Decoder utf8Decoder(&pt.udPrefix);
-                    while ((code_unit = utf8Decoder.nextCode()) > 0)
-                    {
-                        strCodes.push_back(code_unit);
-                    }
-
-                    if (concatStr.udSuffix != "" && pt.udSuffix != "" && concatStr.udSuffix != pt.udSuffix)
-                    {
-                        // error
-                        concatStr.type = PT_INVALID;
-                        continue;
-                    }
-                    else
-                    {
-                        concatStr.udSuffix = (concatStr.udSuffix == "") ? pt.udSuffix : concatStr.udSuffix;
-                    }
-
-                    if (concatStr.udSuffix != "")
-                    {
-                        if (concatStr.udSuffix[0] != '_' || concatStr.type == PT_INVALID)
-                        {
-                            concatStr.type = PT_INVALID;
-                            continue;
-                        }
-                        else
-                        {
-                            concatStr.type = PT_UD_LITERAL_ARRAY;
-                        }
-                    }
-
-
-                    if (concatStr.ltype != FT_CHAR && pt.ltype != FT_CHAR && concatStr.ltype != pt.ltype)
-                    {
-                        // different char type
-                        concatStr.type = PT_INVALID;
-                        continue;
-                    } 
-                    else
-                    {
-                        concatStr.ltype = (concatStr.ltype == FT_CHAR) ? pt.ltype : concatStr.ltype;
-                    }
-
-                    bPrevStr = true;
-                } 
-                else
-                {
-                    concatStr = pt;
-
-                    int code_unit;
-                    UTF8Decoder utf8Decoder(&pt.udPrefix);
-                    while ((code_unit = utf8Decoder.nextCode()) > 0)
-                    {
-                        strCodes.push_back(code_unit);
-                    }
-
-                    if (concatStr.udSuffix != "" && concatStr.udSuffix[0] != '_')
-                    {
-                        concatStr.type = PT_INVALID;
-                    }
-                    bPrevStr = true;
-                }
-                continue;
-            }
-
-            if (bPrevStr == true)
-            {
-                char* mem;
-                int size;
-                strCodes.push_back(0);
-
-                if (concatStr.ltype == FT_CHAR || concatStr.ltype == FT_UNSIGNED_CHAR || concatStr.ltype == FT_SIGNED_CHAR)
-                {
-                    string es = UTF8Encoder::encode(strCodes);
-                    mem = new char[es.size()];
-                    memcpy(mem, es.c_str(), es.size());
-                    size = es.size();
-                }
-                else if (concatStr.ltype == FT_CHAR16_T)
-                {
-                    vector<short> utf16_codes = UTF16Encoder::encode( strCodes );
-                    char16_t* data = new char16_t[utf16_codes.size()];
-                    for (unsigned int i=0; i<utf16_codes.size(); ++i)
-                    {
-                        data[i] = utf16_codes[i];
-                    }
-                    mem = (char*)data;
-                    size = utf16_codes.size();
-                }
-                else if (concatStr.ltype == FT_CHAR32_T)
-                {
-                    char32_t* data = new char32_t[strCodes.size()];
-                    for (unsigned int i=0; i<strCodes.size(); ++i)
-                    {
-                        data[i] = strCodes[i];
-                    }
-                    mem = (char*)data;
-                    size = strCodes.size();
-                }
-                else if (concatStr.ltype == FT_WCHAR_T)
-                {
-                    wchar_t* data = new wchar_t[strCodes.size()];
-                    for (unsigned int i=0; i<strCodes.size(); ++i)
-                    {
-                        data[i] = strCodes[i];
-                    }
-                    mem = (char*)data;
-                    size = strCodes.size();
-                }
-
-                concatStr.data = mem;
-                concatStr.size = size;
-                concatStr.emit();
-                bPrevStr = false;
-                strCodes.clear();
-            }
-            pt.emit();
-        }
-
+        StringLiteralConcat concat(postTokenizer.arena());
+        concat.run(postTokenizer._tokens, [](PostToken& pt) { pt.emit(); });
     }
     catch (exception& e)
     {
@@ -23,7 +23,12 @@
 using namespace std;
 
 
-void preproc(const string& srcfile, vector<PostToken>& ptVec)
+// the large literal payloads of the tokens in `ptVec` are owned by `arena`;
+// post-tokenization runs on `nthreads` threads, and the tokens are also
+// printed to `dump`.  Included headers are looked up in and added to
+// `headers`, if given.
+void preproc(const string& srcfile, vector<PostToken>& ptVec, PostTokenArena& arena, unsigned nthreads = 1, ostream& dump = cout,
+             HeaderCache* headers = 0)
 {
     ifstream in(srcfile);
     ostringstream oss;
@@ -55,177 +60,23 @@ void preproc(const string& srcfile, vector<PostToken>& ptVec)
     
     DirectiveHandler directiveHandler(srcfile, ppTokenizer._elst);
     directiveHandler._fileidMap.insert( pair<PA5FileId,string>( fileid, srcfile) );
+    directiveHandler._headerCache = headers;
     directiveHandler.process();
          
     // PA2 start
-    PostTokenizer postTokenizer(directiveHandler._result);         
-    postTokenizer.parse();
-    
-    // PA2 string concat
-    PostToken concatStr;
-    bool bPrevStr = false;
-    vector<int> strCodes;
-    
-    for (unsigned i=0 ; i<postTokenizer._tokens.size() ; i++)
+    PostTokenizer postTokenizer(directiveHandler._result, arena);
     {
-        PostToken pt = postTokenizer._tokens[i];
-    
-        if (pt.type == PT_SIMPLE && pt.source == "__VA_ARGS__")
-        {
-            throw DirectiveHandlerException("\"__VA_ARGS__\" is not valid identifier");
-        }
-    
-        if (pt.type == PT_LITERAL_ARRAY || pt.type == PT_UD_LITERAL_ARRAY)
-        {
-            if (bPrevStr==true)
-            {
-                concatStr.source += " ";
-                concatStr.source += pt.source;
-    
-                if (concatStr.type == PT_INVALID)
-                {
-                    continue;
-                }
-    
-                int code_unit;
-                UTF8Decoder utf8Decoder(&pt.udPrefix);
-                while ((code_unit = utf8Decoder.nextCode()) > 0)
-                {
-                    strCodes.push_back(code_unit);
-                }
-    
-                if (concatStr.udSuffix != "" && pt.udSuffix != "" && concatStr.udSuffix != pt.udSuffix)
-                {
-                    // error
-                    concatStr.type = PT_INVALID;
-                    continue;
-                }
-                else
-                {
-                    concatStr.udSuffix = (concatStr.udSuffix == "") ? pt.udSuffix : concatStr.udSuffix;
-                }
-    
-                if (concatStr.udSuffix != "")
-                {
-                    if (concatStr.udSuffix[0] != '_' || concatStr.type == PT_INVALID)
-                    {
-                        concatStr.type = PT_INVALID;
-                        continue;
-                    }
-                    else
-                    {
-                        concatStr.type = PT_UD_LITERAL_ARRAY;
-                    }
-                }
-    
-    
-                if (concatStr.ltype != FT_CHAR && pt.ltype != FT_CHAR && concatStr.ltype != pt.ltype)
-                {
-                    // different char type
-                    concatStr.type = PT_INVALID;
-                    continue;
-                } 
-                else
-                {
-                    concatStr.ltype = (concatStr.ltype == FT_CHAR) ? pt.ltype : concatStr.ltype;
-                }
-    
-                bPrevStr = true;
-            } 
-            else
-            {
-                concatStr = pt;
-    
-                int code_unit;
-                UTF8Decoder utf8Decoder(&pt.udPrefix);
-                while ((code_unit = utf8Decoder.nextCode()) > 0)
-                {
-                    strCodes.push_back(code_unit);
-                }
-    
-                if (concatStr.udSuffix != "" && concatStr.udSuffix[0] != '_')
-                {
-                    concatStr.type = PT_INVALID;
-                }
-                bPrevStr = true;
-            }
-            continue;
-        }
-    
-        // before we handle the current token, we need to finish 
-        // preivously collected string concat result.
-        //
-        if (bPrevStr == true)
-        {
-            char* mem;
-            int size;
-            strCodes.push_back(0);
-    
-            if (concatStr.ltype == FT_CHAR || concatStr.ltype == FT_UNSIGNED_CHAR || concatStr.ltype == FT_SIGNED_CHAR)
-            {
-                string es = UTF8Encoder::encode(strCodes);
-                mem = new char[es.size()];
-                memcpy(mem, es.c_str(), es.size());
-                size = es.size();
-            }
-            else if (concatStr.ltype == FT_CHAR16_T)
-            {
-                vector<short> utf16_codes = UTF16Encoder::encode( strCodes );
-                char16_t* data = new char16_t[utf16_codes.size()];
-                for (unsigned int i=0; i<utf16_codes.size(); ++i)
-                {
-                    data[i] = utf16_codes[i];
-                }
-                mem = (char*)data;
-                size = utf16_codes.size();
-            }
-            else if (concatStr.ltype == FT_CHAR32_T)
-            {
-                char32_t* data = new char32_t[strCodes.size()];
-                for (unsigned int i=0; i<strCodes.size(); ++i)
-                {
-                    data[i] = strCodes[i];
-                }
-                mem = (char*)data;
-                size = strCodes.size();
-            }
-            else if (concatStr.ltype == FT_WCHAR_T)
-            {
-                wchar_t* data = new wchar_t[strCodes.size()];
-                for (unsigned int i=0; i<strCodes.size(); ++i)
-                {
-                    data[i] = strCodes[i];
-                }
-                mem = (char*)data;
-                size = strCodes.size();
-            }
-    
-            concatStr.data = mem;
-            concatStr.size = size;
-            if (concatStr.type == PT_INVALID)
-            {
-                throw DirectiveHandlerException("invalid string");
-            }
-            // concatStr.emit(out);
-            concatStr.emit();
-            ptVec.push_back(concatStr);
-
-            bPrevStr = false;
-            strCodes.clear();
-        }
-
-        // after finishing preivously collected concat string token, 
-        // we can start to handle the current token
-        //
-        if (pt.type == PT_INVALID)
-        {
-            throw DirectiveHandlerException("invalid PostToken");
-        }
+        WorkerPool pool(nthreads);
+        postTokenizer.parse(pool);
+    }
 
-        // pt.emit(out);
-        pt.emit();
+    // PA2 string concat
+    StringLiteralConcat concat(arena, StringLiteralConcat::REJECT_VA_ARGS | StringLiteralConcat::REJECT_INVALID);
+    concat.run(postTokenizer._tokens, [&](PostToken& pt)
+    {
+        pt.emit(dump);
         ptVec.push_back(pt);
-    }
+    });
 }
 
 
@@ -292,160 +143,12 @@ int main(int argc, char** argv)
             postTokenizer.parse();
     
             // PA2 string concat
-            PostToken concatStr;
-            bool bPrevStr = false;
-            vector<int> strCodes;
-    
-            for (unsigned i=0 ; i<postTokenizer._tokens.size() ; i++)
+            StringLiteralConcat concat(postTokenizer.arena(), StringLiteralConcat::REJECT_VA_ARGS | StringLiteralConcat::REJECT_INVALID);
+            concat.run(postTokenizer._tokens, [&](PostToken& pt)
             {
-                PostToken pt = postTokenizer._tokens[i];
-    
-                if (pt.type == PT_SIMPLE && pt.source == "__VA_ARGS__")
-                {
-                    throw DirectiveHandlerException("\"__VA_ARGS__\" is not valid identifier");
-                }
-    
-                if (pt.type == PT_LITERAL_ARRAY || pt.type == PT_UD_LITERAL_ARRAY)
-                {
-                    if (bPrevStr==true)
-                    {
-                        concatStr.source += " ";
-                        concatStr.source += pt.source;
-    
-                        if (concatStr.type == PT_INVALID)
-                        {
-                            continue;
-                        }
-    
-                        int code_unit;
-                        UTF8Decoder utf8Decoder(&pt.udPrefix);
-                        while ((code_unit = utf8Decoder.nextCode()) > 0)
-                        {
-                            strCodes.push_back(code_unit);
-                        }
-    
-                        if (concatStr.udSuffix != "" && pt.udSuffix != "" && concatStr.udSuffix != pt.udSuffix)
-                        {
-                            // error
-                            concatStr.type = PT_INVALID;
-                            continue;
-                        }
-                        else
-                        {
-                            concatStr.udSuffix = (concatStr.udSuffix == "") ? pt.udSuffix : concatStr.udSuffix;
-                        }
-    
-                        if (concatStr.udSuffix != "")
-                        {
-                            if (concatStr.udSuffix[0] != '_' || concatStr.type == PT_INVALID)
-                            {
-                                concatStr.type = PT_INVALID;
-                                continue;
-                            }
-                            else
-                            {
-                                concatStr.type = PT_UD_LITERAL_ARRAY;
-                            }
-                        }
-    
-    
-                        if (concatStr.ltype != FT_CHAR && pt.ltype != FT_CHAR && concatStr.ltype != pt.ltype)
-                        {
-                            // different char type
-                            concatStr.type = PT_INVALID;
-                            continue;
-                        } 
-                        else
-                        {
-                            concatStr.ltype = (concatStr.ltype == FT_CHAR) ? pt.ltype : concatStr.ltype;
-                        }
-    
-                        bPrevStr = true;
-                    } 
-                    else
-                    {
-                        concatStr = pt;
-    
-                        int code_unit;
-                        UTF8Decoder utf8Decoder(&pt.udPrefix);
-                        while ((code_unit = utf8Decoder.nextCode()) > 0)
-                        {
-                            strCodes.push_back(code_unit);
-                        }
-    
-                        if (concatStr.udSuffix != "" && concatStr.udSuffix[0] != '_')
-                        {
-                            concatStr.type = PT_INVALID;
-                        }
-                        bPrevStr = true;
-                    }
-                    continue;
-                }
-    
-                if (bPrevStr == true)
-                {
-                    char* mem;
-                    int size;
-                    strCodes.push_back(0);
-    
-                    if (concatStr.ltype == FT_CHAR || concatStr.ltype == FT_UNSIGNED_CHAR || concatStr.ltype == FT_SIGNED_CHAR)
-                    {
-                        string es = UTF8Encoder::encode(strCodes);
-                        mem = new char[es.size()];
-                        memcpy(mem, es.c_str(), es.size());
-                        size = es.size();
-                    }
-                    else if (concatStr.ltype == FT_CHAR16_T)
-                    {
-                        vector<short> utf16_codes = UTF16Encoder::encode( strCodes );
-                        char16_t* data = new char16_t[utf16_codes.size()];
-                        for (unsigned int i=0; i<utf16_codes.size(); ++i)
-                        {
-                            data[i] = utf16_codes[i];
-                        }
-                        mem = (char*)data;
-                        size = utf16_codes.size();
-                    }
-                    else if (concatStr.ltype == FT_CHAR32_T)
-                    {
-                        char32_t* data = new char32_t[strCodes.size()];
-                        for (unsigned int i=0; i<strCodes.size(); ++i)
-                        {
-                            data[i] = strCodes[i];
-                        }
-                        mem = (char*)data;
-                        size = strCodes.size();
-                    }
-                    else if (concatStr.ltype == FT_WCHAR_T)
-                    {
-                        wchar_t* data = new wchar_t[strCodes.size()];
-                        for (unsigned int i=0; i<strCodes.size(); ++i)
-                        {
-                            data[i] = strCodes[i];
-                        }
-                        mem = (char*)data;
-                        size = strCodes.size();
-                    }
-    
-                    concatStr.data = mem;
-                    concatStr.size = size;
-                    if (concatStr.type == PT_INVALID)
-                    {
-                        throw DirectiveHandlerException("invalid string");
-                    }
-                    concatStr.emit(out);
-                    concatStr.emit();
-                    bPrevStr = false;
-                    strCodes.clear();
-                }
-
-                if (pt.type == PT_INVALID)
-                {
-                    throw DirectiveHandlerException("invalid PostToken");
-                }
                 pt.emit(out);
                 pt.emit();
-            }  // end string concat
+            });
 		}
 	}
 	catch (exception& e)
@@ -8,6 +8,8 @@
 #include <map>
 #include <stack>
 #include <vector>
+#include <unordered_map>
+#include <bitset>
 #include <string>
 #include <sstream>
 #include <stdexcept>
@@ -16,6 +18,9 @@
 #include <iostream>
 #include <exception>
 #include "preproc.cpp"
+#include "recogtrace.cpp"
+#include "symfile.cpp"
+#include "symdb.cpp"
 
 using namespace std;
 
@@ -72,169 +77,304 @@ enum AstType {
 };
 
 
-class CppAst {
-  public:
-    CppAst() {
-    }
-    virtual ~CppAst() {
-    }
-
-    virtual string name() {
-        return "";
-    }
-
-    virtual AstType type() = 0;  
-    virtual void dump() {}
-    virtual int size() = 0;
-    virtual bool error() = 0;
+// An AST node is referred to by a CppAstRef.  Tokens need no node, their
+// reference is the token index with TOKEN_AST set; everything else is an
+// index into the nodes of a CppAstArena, where the first two are the
+// shared error and empty results.
+typedef uint32_t CppAstRef;
+
+const CppAstRef ERROR_AST = 0;
+const CppAstRef EMPTY_AST = 1;
+const CppAstRef TOKEN_AST = 0x80000000u;
+
+// the rule of a node that is a list or a group
+const unsigned AST_NO_RULE = 0xffff;
+
+// A node made by a rule alternative has a child per term of the
+// alternative, in grammar order, so that the struct gram_gen generates for
+// the alternative (pa6_ast.cpp) lays its children out.  Lists and groups
+// have a child per element.
+struct CppAstNode {
+    uint8_t  type;      // AstType
+    uint8_t  alt;       // alternative of `rule`
+    uint16_t rule;      // RuleId, or AST_NO_RULE
+    int      size;      // tokens matched, -1 for an error
+    unsigned first;     // first child in the arena
+    unsigned count;     // number of children
 };
 
-typedef shared_ptr<CppAst> CppAstPtr;
 
-class ErrorAst : public CppAst {
+// CppAstArena: the AST of one translation unit.  Nodes and their children
+// live in flat vectors and are freed together with the arena; the
+// children of a node are a contiguous range.
+class CppAstArena {
   public:
-    ErrorAst() {}
-    ~ErrorAst() {
+    CppAstArena()
+        : _open(0)
+    {
+        CppAstNode error = { AST_ERROR, 0, AST_NO_RULE, -1, 0, 0 };
+        CppAstNode empty = { AST_EMPTY, 0, AST_NO_RULE, 0, 0, 0 };
+        _nodes.push_back(error);
+        _nodes.push_back(empty);
     }
-    void dump() {} 
 
-    AstType type() {
-        return AST_ERROR;
+    static CppAstRef token(unsigned index)
+    {
+        return TOKEN_AST | index;
     }
 
-    int size() { 
-        return -1;
+    AstType type(CppAstRef ast) const
+    {
+        return (ast & TOKEN_AST) ? AST_TOKEN : (AstType) _nodes[ast].type;
     }
 
-    bool error() {
-        return true;
+    int size(CppAstRef ast) const
+    {
+        return (ast & TOKEN_AST) ? 1 : _nodes[ast].size;
     }
 
-};
-
-
-class EmptyAst : public CppAst {
-  public:
-    EmptyAst() {}
-    ~EmptyAst() {
+    bool error(CppAstRef ast) const
+    {
+        if (ast & TOKEN_AST) {
+            return false;
+        }
+        const CppAstNode& n = _nodes[ast];
+        bool flag = (n.type == AST_ERROR);
+        for (unsigned i=0; i<n.count; i++) {
+            flag |= error(_children[n.first + i]);
+        }
+        return flag;
     }
-    void dump() {} 
 
-    AstType type() {
-        return AST_EMPTY;
+    // of the token in the token stream of the Recognizer
+    unsigned tokenIndex(CppAstRef ast) const
+    {
+        return ast & ~TOKEN_AST;
     }
 
-    int size() {
-        return 0;
+    unsigned childCount(CppAstRef ast) const
+    {
+        return (ast & TOKEN_AST) ? 0 : _nodes[ast].count;
     }
 
-    bool error() {
-        return false;
+    CppAstRef child(CppAstRef ast, unsigned i) const
+    {
+        return _children[_nodes[ast].first + i];
     }
-};
 
+    // the rule and alternative that made a compound node
+    unsigned rule(CppAstRef ast) const
+    {
+        return (ast & TOKEN_AST) ? AST_NO_RULE : _nodes[ast].rule;
+    }
 
-class TokenAst : public CppAst {
-  public:
-    TokenAst() {}
-    ~TokenAst() {
+    unsigned alt(CppAstRef ast) const
+    {
+        return _nodes[ast].alt;
     }
-    void dump() {} 
-    AstType type()
+
+    // the children of a node of the alternative T as the fields of T, e.g.
+    // node<Recognizer::Ast_simple_declaration_0>(ast).init_declarator_list
+    template <class T>
+    const T& node(CppAstRef ast) const
     {
-        return AST_TOKEN;
+        assert(rule(ast) == T::RULE && alt(ast) == T::ALT);
+        return *reinterpret_cast<const T*>(_children.data() + _nodes[ast].first);
     }
 
-    int size() {
-        return 1;
+    // the `i`th repetition of the group T in the group node `ast`, of
+    // childCount(ast) / T::SLOTS
+    template <class T>
+    const T& item(CppAstRef ast, unsigned i) const
+    {
+        assert(rule(ast) == AST_NO_RULE && (i + 1) * T::SLOTS <= childCount(ast));
+        return *reinterpret_cast<const T*>(_children.data() + _nodes[ast].first + i * T::SLOTS);
     }
 
-    bool error() {
-        return false;
+    size_t nodeCount() const
+    {
+        return _nodes.size();
     }
 
-    PostToken pt;
+    // `ast` of the arena `from`, copied with its token indices moved by
+    // `shift`; the copy is built like any other node
+    CppAstRef copy(const CppAstArena& from, CppAstRef ast, int shift);
+
+  private:
+    friend class CppAstBuilder;
+
+    vector<CppAstNode>  _nodes;
+    vector<CppAstRef>   _children;
+
+    // children of the nodes being built, innermost last
+    vector<CppAstRef>   _building;
+    unsigned            _open;
 };
 
 
-class CompAst : public CppAst {
+// CppAstBuilder: collects the children of a compound node on the stack of
+// the arena, finish() makes the node.  Builders nest: only the innermost
+// unfinished one may add, and one that goes out of scope unfinished
+// leaves nothing behind.
+class CppAstBuilder {
   public:
-    CompAst() {}
-    ~CompAst() {
+    explicit CppAstBuilder(CppAstArena& arena)
+        : _arena(arena), _mark(arena._building.size()), _level(++arena._open), _done(false)
+    {
+    }
+
+    ~CppAstBuilder()
+    {
+        if (!_done) {
+            _arena._building.resize(_mark);
+            _arena._open--;
+        }
     }
-    void dump() {} 
-    AstType type()
+
+    // the next child
+    void add(CppAstRef ast)
     {
-        return AST_COMPOUND;
+        assert(!_done && _level == _arena._open);
+        _arena._building.push_back(ast);
     }
 
-    int size() {
-        map<string, CppAstPtr>::iterator mit = astMap.begin();
-        int count = 0;
-        for ( ; mit != astMap.end(); ++mit )
-        {
-            count += mit->second->size(); 
+    // tokens matched by the children so far
+    int size() const
+    {
+        int n = 0;
+        for (size_t i=_mark; i<_arena._building.size(); i++) {
+            n += _arena.size(_arena._building[i]);
         }
-        return count;
+        return n;
     }
 
-    bool error() {
-        map<string, CppAstPtr>::iterator mit = astMap.begin();
-        bool flag = false;
-        for ( ; mit != astMap.end(); ++mit )
-        {
-            flag |= mit->second->error(); 
+    // the node of alternative `alt` of `rule`, by default a list or group
+    CppAstRef finish(unsigned rule = AST_NO_RULE, unsigned alt = 0)
+    {
+        assert(!_done && _level == _arena._open);
+        vector<CppAstRef>& b = _arena._building;
+        CppAstNode n = { AST_COMPOUND, (uint8_t) alt, (uint16_t) rule, size(), (unsigned) _arena._children.size(), (unsigned) (b.size() - _mark) };
+        if (_arena._nodes.size() >= TOKEN_AST) {
+            throw logic_error("CppAstArena: too many nodes");
         }
-        return flag;
+        _arena._children.insert(_arena._children.end(), b.begin() + _mark, b.end());
+        b.resize(_mark);
+        _arena._nodes.push_back(n);
+        _arena._open--;
+        _done = true;
+        return _arena._nodes.size() - 1;
     }
 
-    map<string, CppAstPtr> astMap; 
+  private:
+    CppAstBuilder(const CppAstBuilder&);
+    CppAstBuilder& operator= (const CppAstBuilder&);
+
+    CppAstArena& _arena;
+    size_t       _mark;
+    unsigned     _level;
+    bool         _done;
 };
 
 
+inline CppAstRef CppAstArena::copy(const CppAstArena& from, CppAstRef ast, int shift)
+{
+    if (ast & TOKEN_AST) {
+        return token(from.tokenIndex(ast) + shift);
+    }
+    if (ast == ERROR_AST || ast == EMPTY_AST) {
+        return ast;
+    }
+    CppAstBuilder b(*this);
+    for (unsigned i=0; i<from.childCount(ast); i++) {
+        b.add(copy(from, from.child(ast, i), shift));
+    }
+    return b.finish(from.rule(ast), from.alt(ast));
+}
+
+
+// a rule body in the trace: entering at construction, leaving at the end
 class Autocat {
   public: 
-    static int depth;
-
-    Autocat(string s) 
-        : name (s)
+    Autocat(RecogTrace* trace, const char* name) 
+        : _trace(trace), _name(name)
     {
-        depth++;
-        cout << indent() << "entering... " << name << endl;
+#if RECOG_TRACE
+        if (_trace) {
+            _trace->enter(_name);
+        }
+#endif
     }
     ~Autocat() 
     {
-        cout << indent() << "leaving... " << name << endl;
-        depth--;
-    }
-
-    string indent() 
-    {
-        stringstream ss;
-        for (int i=0; i<depth*2; i++) {
-            ss << " ";
+#if RECOG_TRACE
+        if (_trace) {
+            _trace->leave(_name);
         }
-        return ss.str();
+#endif
     }
 
-    string name;
+  private:
+    RecogTrace* _trace;
+    const char* _name;
 };
 
 
-int Autocat::depth = 0;
+// entries kept by the packrat memo of Recognizer, 0 turns memoization off
+#ifndef RECOG_MEMO_CAPACITY
+#define RECOG_MEMO_CAPACITY (1 << 16)
+#endif
+
+// a nonterminal tried at a token position, inside a template argument
+// list or not (see Recognizer::angleGroup())
+struct RecogMemoKey {
+    int      rule;
+    unsigned pos;
+    unsigned angle;
+
+    bool operator== (const RecogMemoKey& o) const {
+        return rule == o.rule && pos == o.pos && angle == o.angle;
+    }
+};
+
+struct RecogMemoKeyHash {
+    size_t operator() (const RecogMemoKey& k) const {
+        return ((size_t) k.angle * 31 + k.pos) * 1021 + k.rule;
+    }
+};
 
 
 class Recognizer {
   public: 
     typedef vector<PostToken>::iterator PtIt;
-
-    Recognizer( vector<PostToken>& ptVec ) 
-        : _ptVec(ptVec)
+    typedef bitset<PT_COUNT> TokenSet;
+
+    // the Recognizer borrows `ptVec`, which must outlive it; only the
+    // tclass of the tokens is written.  With a `scan` of the tokens the
+    // identifiers are classified by what it found them to name, otherwise
+    // by the PA6_Is* tests of their spelling.
+    Recognizer( vector<PostToken>& ptVec, size_t memoCapacity = RECOG_MEMO_CAPACITY, const SymbolScan* scan = 0 ) 
+        : _ptVec(ptVec), _trace(0), _memoCapacity(memoCapacity), _memoHits(0), _memoMisses(0), _memoEvictions(0),
+          _depth(0), _reach(0), _prevSize(0), _head(0), _tail(0), _reused(0)
     {
         _ptIt = _ptVec.begin();
         _ptEnd = _ptVec.end();
+        classifyTokens( scan );
+        groupTokens();
     }     
 
+  private:
+    // one for a part of the tokens of parse(pool), which are classified
+    // and grouped already
+    Recognizer( vector<PostToken>& ptVec, const vector<TokenSet>& classes, const vector<unsigned>& groups, size_t memoCapacity )
+        : _ptVec(ptVec), _trace(0), _memoCapacity(memoCapacity), _memoHits(0), _memoMisses(0), _memoEvictions(0),
+          _classes(classes), _groups(groups), _depth(0), _reach(0), _prevSize(0), _head(0), _tail(0), _reused(0)
+    {
+        _ptIt = _ptVec.begin();
+        _ptEnd = _ptVec.end();
+    }
+
+  public:
+
     ~Recognizer() {
     }
 
@@ -245,196 +385,604 @@ class Recognizer {
         return false;
     }
 
-    std::string to_string(const unsigned int i)
-    {
-        return std::to_string( (long long unsigned) i);
-    }
-
+#ifdef RECOG_TABLE
+#include "tableparse.cpp"
+#include "pa6_table.cpp"
+#else
 #include "pa6_code.cpp"
+#endif
+#include "pa6_ast.cpp"
 
 
-    bool parse() {
-        parse__translation_unit();
+    // record into `trace` what parse() does
+    void setTrace( RecogTrace* trace, const string& srcfile )
+    {
+        _trace = trace;
+        if (_trace) {
+            _trace->begin( srcfile, _ptVec, &_ptIt );
+        }
+    }
 
-        if (_ptIt == _ptEnd) {
-            return true;
-        } 
-        else {
-            return false;
+    void traceBackTo()
+    {
+#if RECOG_TRACE
+        if (_trace) {
+            _trace->backTo();
         }
+#endif
     }
 
+    // the token a token AST stands for
+    const PostToken& token( CppAstRef ast ) const
+    {
+        return _ptVec[ _ast.tokenIndex( ast ) ];
+    }
 
-    bool matchType( EPostTokenType tp , EPostTokenType tp2) 
+    const CppAstArena& ast() const
     {
-        bool bOK = false ;
+        return _ast;
+    }
 
-        if (tp == tp2) 
-        {
-            bOK = true;
+    // The translation unit, parsed a top-level declaration at a time.
+    // Where one fails the farthest token its parse looked at goes to
+    // _errors, and the tokens from its first one on are skipped past a `;`
+    // or `}` outside of brackets that a token of FOLLOW(declaration)
+    // follows (panic mode).  So each broken declaration costs one error and
+    // a scan of its tokens, and the ones after it still parse.  False if
+    // any failed; errors() then tells where.
+    bool parse() {
+        Autocat ac( _trace, "translation-unit" );
+        const TokenSet& follow = followSets()[ RULE_declaration ];
+        unsigned n = _ptVec.size();
+
+        _errors.clear();
+        _ptIt = _ptVec.begin();
+        _angles.clear();
+        _depth = 1;
+        while (_ptIt != _ptEnd && !matchType( PT_ST_EOF )) {
+            unsigned begin = _ptIt - _ptVec.begin();
+            _reach = 0;
+#ifdef RECOG_TABLE
+            CppAstRef ast = tableRule( RULE_declaration );
+#else
+            CppAstRef ast = parse__declaration();
+#endif
+            if (_ast.size( ast ) != 0) {
+                continue;
+            }
+            _errors.push_back( min( max( _reach, begin + 1 ), n ) - 1 );
+
+            unsigned i = begin;
+            while (i + 1 < n) {
+                EPostTokenType tp = _ptVec[i].type;
+                if (_groups[i] == 0 && (tp == PT_OP_SEMICOLON || tp == PT_OP_RBRACE) &&
+                    (_classes[ _ptVec[i+1].tclass ] & follow).any()) {
+                    break;
+                }
+                i++;
+            }
+            _ptIt = _ptVec.begin() + min( i + 1, n );
         }
-        else if (tp == PT_TT_IDENTIFIER && tp2 == PT_SIMPLE ) 
-        {
-            bOK = true;
+        _depth = 0;
+
+        if (_ptIt == _ptEnd && _errors.empty()) {
+            _errors.push_back( n - 1 );     // no end of file token
         }
-        else if (tp == PT_TT_IDENTIFIER_C && tp2 == PT_SIMPLE ) 
-        {
-            if ( PA6_IsClassName( _ptIt->source )) {
-                bOK = true;
-            } 
+        return _errors.empty();
+    }
+
+    // parse again after an edit: `prev` recognized an earlier version of
+    // the tokens, and its top-level declarations (see topDeclaration())
+    // that lie in the unchanged beginning or end of the stream, and looked
+    // at nothing of the changed part, are taken over instead of parsed
+    bool parse( const Recognizer& prev )
+    {
+        const vector<PostToken>& old = prev._ptVec;
+        size_t n = min( old.size(), _ptVec.size() );
+        _head = 0;
+        _tail = 0;
+        while (_head < n && sameToken( prev, _head, _head )) {
+            _head++;
         }
-        else if (tp == PT_TT_IDENTIFIER_E && tp2 == PT_SIMPLE ) 
-        {
-            if (PA6_IsTemplateName ( _ptIt->source )) {
-                bOK = true;
-            }
+        while (_tail < n - _head && sameToken( prev, old.size() - 1 - _tail, _ptVec.size() - 1 - _tail )) {
+            _tail++;
         }
-        else if (tp == PT_TT_IDENTIFIER_N && tp2 == PT_SIMPLE ) 
-        {
-            if (PA6_IsNamespaceName ( _ptIt->source ) ) {
-                bOK = true;
+
+        _prevSize = old.size();
+        _reuse.clear();
+        for (unordered_map<unsigned, TopDecl>::const_iterator it = prev._topDecls.begin(); it != prev._topDecls.end(); ++it) {
+            if (it->second.reach <= _head || it->first >= old.size() - _tail) {
+                Reuse r = { &it->second, &prev._ast };
+                _reuse[ movedToken( it->first ) ] = r;
             }
         }
-        else if (tp == PT_TT_IDENTIFIER_T && tp2 == PT_SIMPLE ) 
-        {
-            if (PA6_IsTemplateName (_ptIt->source) ) {
-                bOK = true;
-            }
+
+        bool ok = parse();
+        _reuse.clear();
+        return ok;
+    }
+
+    // Parse with the top-level declarations found in parallel first.  A
+    // pre-pass cuts the tokens into runs of declarations (see
+    // declarationCuts()), which Recognizers of their own parse on `pool`;
+    // the sequential parse then takes over what they found like parse(prev)
+    // does.  Where a cut was wrong it parses on its own from there.  Token classes
+    // are fixed before the parse, so the runs depend on nothing before them.
+    bool parse( WorkerPool& pool )
+    {
+        if (pool.size() == 1) {
+            return parse();
         }
-        else if (tp == PT_TT_IDENTIFIER_Y && tp2 == PT_SIMPLE ) 
+
+        vector<unsigned> cuts = declarationCuts( pool.size() * 4 );
+        vector< unique_ptr<Recognizer> > parts( cuts.size() - 1 );
+        pool.run( parts.size(), [&]( size_t i )
         {
-            if (PA6_IsTypedefName( _ptIt->source )) {
-                bOK = true;
+            parts[i].reset( new Recognizer( _ptVec, _classes, _groups, _memoCapacity ) );
+            parts[i]->parseDeclarations( cuts[i], cuts[i+1] );
+        });
+
+        _prevSize = _head = _ptVec.size();
+        _tail = 0;
+        _reuse.clear();
+        for (unsigned i=0; i<parts.size(); i++) {
+            const Recognizer& part = *parts[i];
+            for (unordered_map<unsigned, TopDecl>::const_iterator it = part._topDecls.begin(); it != part._topDecls.end(); ++it) {
+                Reuse r = { &it->second, &part._ast };
+                _reuse[ it->first ] = r;
             }
         }
-        else if ( tp == PT_TT_LITERAL ) 
-        {
-            if (tp2 == PT_LITERAL || tp2 == PT_LITERAL_ARRAY || tp2 == PT_UD_LITERAL || tp2 == PT_UD_LITERAL_ARRAY)
-            {
-                bOK = true;
+
+        bool ok = parse();
+        _reuse.clear();
+        return ok;
+    }
+
+    // Where top-level declarations seem to begin: after a `;` or a `}`
+    // outside of brackets, unless a `;` follows.  About `nparts` runs of
+    // them from the first token to the end of file token.
+    vector<unsigned> declarationCuts( unsigned nparts ) const
+    {
+        unsigned n = _ptVec.size();
+        if (n > 0 && _ptVec[n-1].type == PT_EOF) {
+            n--;
+        }
+        unsigned step = n / nparts + 1;
+        vector<unsigned> cuts( 1, 0 );
+
+        for (unsigned i=0; i+1<n; i++) {
+            EPostTokenType tp = _ptVec[i].type;
+            if (_groups[i] != 0 || i + 1 - cuts.back() < step) {
+                continue;
+            }
+            if (tp == PT_OP_SEMICOLON || (tp == PT_OP_RBRACE && _ptVec[i+1].type != PT_OP_SEMICOLON)) {
+                cuts.push_back( i + 1 );
             }
         }
-        else if ( tp == PT_ST_EMPTYSTR) 
-        {
-            if (_ptIt->type == PT_LITERAL_ARRAY && _ptIt->ltype == FT_CHAR && _ptIt->size == 1)
-            {
-                bOK = true;
+        cuts.push_back( n );
+        return cuts;
+    }
+
+    // the top-level declarations from token `begin` on, until one ends at
+    // or after token `end` or one fails; for parse(pool)
+    void parseDeclarations( unsigned begin, unsigned end )
+    {
+        _ptIt = _ptVec.begin() + begin;
+        _depth = 1;
+        while (_ptIt < _ptVec.begin() + end) {
+#ifdef RECOG_TABLE
+            CppAstRef ast = tableRule( RULE_declaration );
+#else
+            CppAstRef ast = parse__declaration();
+#endif
+            if (_ast.size( ast ) == 0) {
+                break;
             }
         }
-        else if ( tp == PT_ST_ZERO ) 
-        {
-            if (_ptIt->type == PT_LITERAL && _ptIt->source == "0") {
-                bOK = true; 
-            } 
+        _depth = 0;
+        _memo[0].clear();
+        _memo[1].clear();
+    }
+
+    // what the parse of a declaration depends on: token `i` of `prev` and
+    // token `j` are alike, and in the same class
+    bool sameToken( const Recognizer& prev, size_t i, size_t j ) const
+    {
+        const PostToken& a = prev._ptVec[i];
+        const PostToken& b = _ptVec[j];
+        return a.type == b.type && a.ltype == b.ltype && a.size == b.size && a.source == b.source &&
+               prev._classes[a.tclass] == _classes[b.tclass];
+    }
+
+    // declarations taken over from the previous parse
+    unsigned long reused() const {
+        return _reused;
+    }
+
+
+    // what the PA6_Is* tests take an identifier for, as ESymbolKind bits;
+    // a template name is taken for an enum name too
+    static unsigned spellingKinds( const string& identifier )
+    {
+        unsigned kinds = 0;
+        if ( PA6_IsClassName( identifier )) {
+            kinds |= SK_CLASS;
         }
-        else if ( tp == PT_ST_OVERRIDE && _ptIt->type == PT_SIMPLE && _ptIt->source == "override" )
-        {
-            bOK = true;
+        if ( PA6_IsTemplateName( identifier )) {
+            kinds |= SK_TEMPLATE | SK_ENUM;
         }
-        else if ( tp == PT_ST_FINAL && _ptIt->type == PT_SIMPLE && _ptIt->source == "final" )
-        {
-            bOK = true;
+        if ( PA6_IsNamespaceName( identifier )) {
+            kinds |= SK_NAMESPACE;
         }
-        else if ( tp == PT_ST_NONPAREN) 
+        if ( PA6_IsTypedefName( identifier )) {
+            kinds |= SK_TYPEDEF;
+        }
+        return kinds;
+    }
+
+    // the terminals of the grammar that a token matches: its own type and
+    // the categories (identifier kinds, literal, closing angle bracket, ...)
+    // that take it; `kinds` are what an identifier names
+    TokenSet classify( const PostToken& pt, unsigned kinds )
+    {
+        TokenSet cls;
+        EPostTokenType tp = pt.type;
+
+        cls.set( tp );
+        if (tp == PT_SIMPLE)
         {
-            if ( tp2 == PT_OP_LPAREN || tp2 == PT_OP_RPAREN || 
-                 tp2 == PT_OP_LSQUARE || tp2 == PT_OP_RSQUARE || 
-                 tp2 == PT_OP_LBRACE || tp2 == PT_OP_RBRACE ||
-                 tp2 == PT_ST_EOF) {
-                bOK = false;
+            cls.set( PT_TT_IDENTIFIER );
+            if (kinds & SK_CLASS) {
+                cls.set( PT_TT_IDENTIFIER_C );
+            }
+            if (kinds & SK_ENUM) {
+                cls.set( PT_TT_IDENTIFIER_E );
+            }
+            if (kinds & SK_TEMPLATE) {
+                cls.set( PT_TT_IDENTIFIER_T );
+            }
+            if (kinds & SK_NAMESPACE) {
+                cls.set( PT_TT_IDENTIFIER_N );
             }
-            else {
-                bOK = true;
+            if (kinds & SK_TYPEDEF) {
+                cls.set( PT_TT_IDENTIFIER_Y );
+            }
+            if (pt.source == "override") {
+                cls.set( PT_ST_OVERRIDE );
+            }
+            if (pt.source == "final") {
+                cls.set( PT_ST_FINAL );
             }
         }
-        else if ( tp == PT_ST_LT) 
-        {
-            if (tp2 == PT_OP_LT || tp2 == PT_ST_LT) {
-                bOK = true;
+        if (is_TT_LITERAL( tp )) {
+            cls.set( PT_TT_LITERAL );
+        }
+        if (tp == PT_LITERAL_ARRAY && pt.ltype == FT_CHAR && pt.size == 1) {
+            cls.set( PT_ST_EMPTYSTR );
+        }
+        if (tp == PT_LITERAL && pt.source == "0") {
+            cls.set( PT_ST_ZERO );
+        }
+        if (tp != PT_OP_LPAREN && tp != PT_OP_RPAREN &&
+            tp != PT_OP_LSQUARE && tp != PT_OP_RSQUARE &&
+            tp != PT_OP_LBRACE && tp != PT_OP_RBRACE && tp != PT_ST_EOF) {
+            cls.set( PT_ST_NONPAREN );
+        }
+        if (tp == PT_OP_LT) {
+            cls.set( PT_ST_LT );
+        }
+        if (tp == PT_OP_GT || tp == PT_ST_RSHIFT_1 || tp == PT_ST_RSHIFT_2) {
+            cls.set( PT_ST_GT );
+        }
+        if (tp == PT_EOF) {
+            cls.set( PT_ST_EOF );
+        }
+        return cls;
+    }
+
+    // classify every token once; tokens of the same class share an entry
+    // of _classes, and PostToken::tclass holds its index
+    void classifyTokens( const SymbolScan* scan )
+    {
+        unordered_map<TokenSet, unsigned short> ids;
+
+        _classes.assign( 1, TokenSet() );       // 0, past the end
+        for (PtIt it=_ptVec.begin(); it!=_ptVec.end(); ++it) {
+            unsigned kinds = 0;
+            if (it->type == PT_SIMPLE) {
+                kinds = scan ? scan->kind( it - _ptVec.begin() ) : spellingKinds( it->source );
+            }
+            TokenSet cls = classify( *it, kinds );
+            unordered_map<TokenSet, unsigned short>::iterator mit = ids.find( cls );
+            if (mit == ids.end()) {
+                if (_classes.size() > USHRT_MAX) {
+                    throw RecognizerException( "too many token classes" );
+                }
+                mit = ids.insert( make_pair( cls, (unsigned short) _classes.size() ) ).first;
+                _classes.push_back( cls );
             }
+            it->tclass = mit->second;
         }
-        else if ( tp == PT_ST_GT) 
-        {
-            if (tp2 == PT_OP_GT || tp2 == PT_ST_RSHIFT_1 || tp2 == PT_ST_RSHIFT_2 || tp2 == PT_ST_GT) {
-                bOK = true;
+    }
+
+    // The brackets of the tokens, in one pass: _groups holds for every token
+    // 1 + the index of the innermost (, [ or { around it, 0 outside of all.
+    // A closing bracket belongs to the group around its opening one, and
+    // closes the brackets left open inside it; one that closes nothing is
+    // ignored.
+    void groupTokens()
+    {
+        vector<unsigned> open;
+
+        _groups.resize( _ptVec.size() );
+        for (unsigned i=0; i<_ptVec.size(); i++) {
+            EPostTokenType tp = _ptVec[i].type;
+            EPostTokenType opener = (tp == PT_OP_RPAREN) ? PT_OP_LPAREN : (tp == PT_OP_RSQUARE) ? PT_OP_LSQUARE :
+                                    (tp == PT_OP_RBRACE) ? PT_OP_LBRACE : PT_INVALID;
+            if (opener != PT_INVALID) {
+                unsigned k = open.size();
+                while (k > 0 && _ptVec[open[k-1]].type != opener) {
+                    k--;
+                }
+                if (k > 0) {
+                    open.resize( k - 1 );
+                }
+            }
+            _groups[i] = open.empty() ? 0 : open.back() + 1;
+            if (tp == PT_OP_LPAREN || tp == PT_OP_LSQUARE || tp == PT_OP_LBRACE) {
+                open.push_back( i );
             }
         }
-        else if (tp == PT_ST_EOF && tp2 == PT_EOF )
-        {
-            bOK = true;
+    }
+
+    // FIRST sets and the like, from PT_WHITESPACE terminated lists
+    static TokenSet tokenSet( const EPostTokenType* types )
+    {
+        TokenSet ts;
+        for ( ; *types != PT_WHITESPACE; types++) {
+            ts.set( *types );
         }
+        return ts;
+    }
 
-        return bOK;
+    // `n` lists, one after the other
+    static vector<TokenSet> tokenSets( const EPostTokenType* lists, int n )
+    {
+        vector<TokenSet> sets;
+        for (int i=0; i<n; i++) {
+            sets.push_back( tokenSet( lists ) );
+            while (*lists++ != PT_WHITESPACE) {
+            }
+        }
+        return sets;
     }
 
-    
-    shared_ptr<CppAst> match( EPostTokenType tp )
+    // FOLLOW of every rule, by RuleId
+    static const vector<TokenSet>& followSets()
     {
+        static const vector<TokenSet> sets = tokenSets( followLists(), RULE_COUNT );
+        return sets;
+    }
 
-        while (_bracketStack.size() > 0) {
-            PtIt ptit = _bracketStack.top();
-            unsigned dist = ptit - _ptVec.begin();
-            unsigned dist2 = _ptIt - _ptVec.begin();
-            if (dist > dist2 ) {
-                _bracketStack.pop();
-            }
-            else {
-                break;
+    // The alternatives of a rule worth trying at the current token, a bit
+    // each: those whose FIRST set has a terminal of the token's class, and
+    // those that may match without a token.  Worked out for every class
+    // the first time the rule is parsed.
+    uint64_t dispatch( int rule, const vector<TokenSet>& altFirst, const bool* altEmpty )
+    {
+        if (_dispatch.empty()) {
+            _dispatch.resize( RULE_COUNT );
+        }
+        vector<uint64_t>& row = _dispatch[rule];
+        if (row.empty()) {
+            row.assign( _classes.size(), 0 );
+            for (unsigned c=0; c<_classes.size(); c++) {
+                for (unsigned j=0; j<altFirst.size(); j++) {
+                    if (altEmpty[j] || (_classes[c] & altFirst[j]).any()) {
+                        row[c] |= uint64_t(1) << j;
+                    }
+                }
             }
         }
+        tokenClass();
+        return row[ _ptIt == _ptEnd ? 0 : _ptIt->tclass ];
+    }
 
-        if (_ptIt == _ptEnd) {
-            return shared_ptr<CppAst>( new ErrorAst() );
+    const TokenSet& tokenClass()
+    {
+        unsigned pos = _ptIt - _ptVec.begin();
+        if (pos >= _reach) {
+            _reach = pos + 1;
         }
+        return _classes[ _ptIt == _ptEnd ? 0 : _ptIt->tclass ];
+    }
 
-        bool bOK = false ;
+    bool matchType( EPostTokenType tp )
+    {
+        return tokenClass().test( tp );
+    }
+
+    // is the current token in `ts`
+    bool matchSet( const TokenSet& ts )
+    {
+        return (tokenClass() & ts).any();
+    }
+
+    
+    CppAstRef match( EPostTokenType tp )
+    {
 
-        EPostTokenType tp2 = _ptIt->type;
+        dropAngles();
 
-        bOK = matchType( tp , tp2);
+        if (_ptIt == _ptEnd) {
+            return ERROR_AST;
+        }
 
-        if (bOK)
+        if (matchType( tp ))
         {
-            // special handling for closing-angle-bracket 
-            if (tp == PT_OP_LPAREN || tp == PT_OP_LSQUARE || tp == PT_OP_LBRACE || tp == PT_ST_LT) {
-                _bracketStack.push( _ptIt );
-            }
-            else if ( tp == PT_OP_RPAREN ) {
-                if (_bracketStack.top()->type == PT_OP_LPAREN) {
-                    _bracketStack.pop();
-                }
-            }
-            else if ( tp == PT_OP_RSQUARE ) {
-                if (_bracketStack.top()->type == PT_OP_LSQUARE) {
-                    _bracketStack.pop();
-                }
-            }
-            else if ( tp == PT_OP_RBRACE ) {
-                if (_bracketStack.top()->type == PT_OP_LBRACE) {
-                    _bracketStack.pop();
-                }
+            // special handling for closing-angle-bracket: a template
+            // argument list is open from its `<` to its `>`, and a `>` in
+            // the same brackets closes it instead of being an operator
+            if (tp == PT_ST_LT) {
+                _angles.push_back( _ptIt - _ptVec.begin() );
             }
             else if ( tp == PT_ST_GT ) {
-                if (_bracketStack.top()->type == PT_ST_LT) {
-                    _bracketStack.pop();
+                if (!_angles.empty()) {
+                    _angles.pop_back();
                 }
             }
             else if ( tp == PT_OP_GT || tp == PT_ST_RSHIFT_1 || tp == PT_ST_RSHIFT_2 ) {
-                if ( _bracketStack.top()->type == PT_OP_LT) {
-                    return shared_ptr<CppAst>( new EmptyAst );
+                if ( angleGroup() == _groups[ _ptIt - _ptVec.begin() ] ) {
+                    return EMPTY_AST;
                 }
             }
 
-            cout << "MATCHED: " << PostTokenTypeToStringMap.at( tp ) << " to " <<  _ptIt->source << endl;
-            TokenAst* ast = new TokenAst();
-            ast->pt = *_ptIt;
+#if RECOG_TRACE
+            if (_trace) {
+                _trace->match( tp );
+            }
+#endif
+            CppAstRef ast = CppAstArena::token( _ptIt - _ptVec.begin() );
             _ptIt++;
-            return shared_ptr<CppAst>( ast );
+            return ast;
         }
         else {
-            return shared_ptr<CppAst>( new EmptyAst );
+            return EMPTY_AST;
+        }
+
+    }
+
+    // the group (see groupTokens()) of the innermost open template
+    // argument list, NO_ANGLE if there is none
+    unsigned angleGroup() const
+    {
+        return _angles.empty() ? (unsigned) NO_ANGLE : _groups[ _angles.back() ];
+    }
+
+    // angles opened at or after the current position were left behind by
+    // backtracking
+    void dropAngles()
+    {
+        unsigned pos = _ptIt - _ptVec.begin();
+        while (!_angles.empty() && _angles.back() >= pos) {
+            _angles.pop_back();
         }
+    }
 
+    // Packrat memoization of the generated parse functions.  What a
+    // nonterminal matches depends only on the token position and on the
+    // group of the innermost open template argument list (see match()), so
+    // the result and the end position are remembered under those; a rule
+    // leaves the template argument lists as it found them.  The memo holds
+    // two generations of at most half the capacity each: when the young one
+    // fills up the old one is dropped, and hits in the old one move back to
+    // the young one.
+    template <class Body>
+    CppAstRef memoize( int rule, Body body )
+    {
+        dropAngles();
+        size_t angles = _angles.size();
+        _depth++;
+        CppAstRef ast;
+        if (rule == RULE_declaration && _depth == 2) {
+            ast = topDeclaration( [this, rule, body]() { return memoizeRule( rule, body ); } );
+        }
+        else {
+            ast = memoizeRule( rule, body );
+        }
+        _depth--;
+        if (_angles.size() > angles) {
+            _angles.resize( angles );
+        }
+        return ast;
+    }
+
+    template <class Body>
+    CppAstRef memoizeRule( int rule, Body body )
+    {
+        if (_memoCapacity == 0) {
+            return body();
+        }
+
+        RecogMemoKey key = { rule, (unsigned) (_ptIt - _ptVec.begin()), angleGroup() };
+
+        MemoEntry* entry = memoFind( key );
+        if (entry != 0) {
+            _memoHits++;
+            _ptIt = entry->end;
+            _reach = max( _reach, entry->reach );
+            return entry->ast;
+        }
+        _memoMisses++;
+
+        unsigned reach = _reach;
+        _reach = 0;
+        CppAstRef ast = body();
+
+        if (_memo[0].size() >= _memoCapacity / 2 + 1) {
+            _memoEvictions += _memo[1].size();
+            _memo[1].swap( _memo[0] );
+            _memo[0].clear();
+        }
+        MemoEntry& e = _memo[0][key];
+        e.ast = ast;
+        e.end = _ptIt;
+        e.reach = _reach;
+        _reach = max( reach, _reach );
+        return ast;
+    }
+
+    // A declaration of the translation unit itself.  Its result and end
+    // are kept for the next parse(prev), with how far its parse looked
+    // ahead.  One that parse(prev) or parse(pool) found elsewhere is copied
+    // over from that AST: no template argument list is open around a
+    // top-level declaration, so only its tokens go into it.
+    template <class Body>
+    CppAstRef topDeclaration( Body body )
+    {
+        unsigned begin = _ptIt - _ptVec.begin();
+        unsigned reach = _reach;
+        CppAstRef ast;
+
+        unordered_map<unsigned, Reuse>::const_iterator rit = _reuse.find( begin );
+        if (rit != _reuse.end()) {
+            const TopDecl& d = *rit->second.decl;
+            int shift = begin < _head ? 0 : (int) _ptVec.size() - (int) _prevSize;
+            ast = _ast.copy( *rit->second.ast, d.ast, shift );
+            _ptIt = _ptVec.begin() + (d.end + shift);
+            _reach = d.reach + shift;
+            _reused++;
+        }
+        else {
+            _reach = 0;
+            ast = body();
+        }
+
+        if (_ast.size( ast ) > 0) {
+            TopDecl& d = _topDecls[begin];
+            d.ast = ast;
+            d.end = _ptIt - _ptVec.begin();
+            d.reach = _reach;
+        }
+        _reach = max( reach, _reach );
+        return ast;
+    }
+
+    CppAstRef memoize( int rule, CppAstRef (Recognizer::*body)() )
+    {
+        return memoize( rule, [this, body]() { return (this->*body)(); } );
+    }
+
+    unsigned long memoHits() const {
+        return _memoHits;
+    }
+
+    unsigned long memoMisses() const {
+        return _memoMisses;
+    }
+
+    unsigned long memoEvictions() const {
+        return _memoEvictions;
     }
 
     // to keep the current position for backtracking
@@ -450,65 +998,298 @@ class Recognizer {
         _bakIts.pop();
     }
 
-    string lastErrFile() {
-        return _errFile.back();
-    }
-
-    int lastErrLine() {
-        return _errLine.back();
+    // the tokens at which parse() found the top-level declarations it
+    // could not parse, in order
+    const vector<unsigned>& errors() const {
+        return _errors;
     }
 
     
   private:
-    vector<PostToken> _ptVec;
+    struct MemoEntry {
+        CppAstRef    ast;
+        PtIt         end;
+        unsigned     reach;
+    };
+    typedef unordered_map<RecogMemoKey, MemoEntry, RecogMemoKeyHash> MemoTable;
+
+    // a top-level declaration ends before token `end`, and its parse
+    // looked at the tokens before `reach`
+    struct TopDecl {
+        CppAstRef        ast;
+        unsigned         end;
+        unsigned         reach;
+    };
+
+    // a declaration found elsewhere, in `ast`
+    struct Reuse {
+        const TopDecl*     decl;
+        const CppAstArena* ast;
+    };
+
+    MemoEntry* memoFind( const RecogMemoKey& key )
+    {
+        MemoTable::iterator mit = _memo[0].find( key );
+        if (mit != _memo[0].end()) {
+            return &mit->second;
+        }
+        mit = _memo[1].find( key );
+        if (mit == _memo[1].end()) {
+            return 0;
+        }
+        MemoEntry& young = _memo[0][key];
+        young = mit->second;
+        _memo[1].erase( mit );
+        return &young;
+    }
+
+    // where token `i` of the previous parse, one of the unchanged ones,
+    // is now
+    unsigned movedToken( unsigned i ) const
+    {
+        return i < _head ? i : i + _ptVec.size() - _prevSize;
+    }
+
+    vector<PostToken>& _ptVec;
     PtIt              _ptIt;
     PtIt              _ptEnd;
     stack<PtIt>       _bakIts;
 
-    stack<PtIt>       _bracketStack;
+    // where the `<` of the open template argument lists are, innermost last
+    vector<unsigned>  _angles;
+    enum { NO_ANGLE = UINT_MAX };
+
+    RecogTrace*       _trace;
+
+    size_t            _memoCapacity;
+    MemoTable         _memo[2];
+    unsigned long     _memoHits;
+    unsigned long     _memoMisses;
+    unsigned long     _memoEvictions;
+
+    vector<TokenSet>  _classes;
+    vector<unsigned>  _groups;
+
+    // by rule and token class, see dispatch()
+    vector< vector<uint64_t> > _dispatch;
+
+    // memoized rules being parsed, 1 in the translation unit
+    unsigned          _depth;
+
+    // tokens before this were looked at, in the current rule (see memoize())
+    unsigned          _reach;
+
+    unordered_map<unsigned, TopDecl>  _topDecls;     // by first token
 
-    vector<string>    _errFile;
-    vector<int>       _errLine;
+    // during parse(prev) and parse(pool): the unchanged tokens at the
+    // beginning and end of the `_prevSize` tokens the declarations were
+    // found in, and those in them, by their first token here
+    size_t                            _prevSize;
+    size_t                            _head;
+    size_t                            _tail;
+    unordered_map<unsigned, Reuse>    _reuse;
+    unsigned long                     _reused;
 
-    CppAst*           _lastAst;
-    CppAst*           _curAst;
+    vector<unsigned>  _errors;
+
+    CppAstArena       _ast;
 
 };
 
 
 
-void DoRecog(const string& srcfile)
+// a recognized translation unit, kept to parse an edited version of it
+// incrementally
+struct RecogUnit
+{
+    PostTokenArena          arena;
+    vector<PostToken>       ptVec;
+    unique_ptr<SymbolScan>  scan;           // if classified by one
+    unique_ptr<Recognizer>  recognizer;
+};
+
+
+// recognize `srcfile`; with a `unit` of an earlier version of the file
+// the parse is incremental (see Recognizer::parse(prev)), and `unit` is
+// replaced by this one.  Otherwise post-tokenization and, without a
+// trace, the parse run on `nthreads` threads.  The preprocessed tokens
+// are printed to `dump`.  If `scoped` the identifiers are classified by
+// a SymbolScan of the declarations before them.  `headers` caches the
+// preprocessed headers, see preproc.
+void DoRecog(const string& srcfile, RecogTrace* trace, unique_ptr<RecogUnit>& unit, unsigned nthreads = 1, ostream& dump = cout,
+             bool scoped = false, HeaderCache* headers = 0)
 {
-    vector<PostToken> ptVec;
-    preproc(srcfile, ptVec);
+    unique_ptr<RecogUnit> cur(new RecogUnit);
+    vector<PostToken>& ptVec = cur->ptVec;
+    preproc(srcfile, ptVec, cur->arena, nthreads, dump, headers);
 
-    //----- replace the shift1 and shift2 tokens
+    //----- replace the shift1 and shift2 tokens, in place from the back
     //
-    vector<PostToken> tokens;
-    for (unsigned i=0 ; i<ptVec.size() ; i++) {
-        if (ptVec[i].type == PT_OP_RSHIFT) {
+    size_t nshift = count_if(ptVec.begin(), ptVec.end(), [](const PostToken& pt) { return pt.type == PT_OP_RSHIFT; });
+    size_t from = ptVec.size();
+    ptVec.resize(from + nshift);
+    for (size_t to = ptVec.size(); from != to; ) {
+        from--;
+        if (ptVec[from].type == PT_OP_RSHIFT) {
             PostToken t1, t2;
             t1.type = PT_ST_RSHIFT_1;
             t2.type = PT_ST_RSHIFT_2;
-            tokens.push_back(t1); 
-            tokens.push_back(t2); 
+            ptVec[--to] = t2;
+            ptVec[--to] = t1;
         } 
         else {
-            tokens.push_back(ptVec[i]);
+            ptVec[--to] = ptVec[from];
         }
     }
 
-    Recognizer recognizer( tokens );
+    if (scoped) {
+        cur->scan.reset(new SymbolScan( ptVec ));
+    }
+    cur->recognizer.reset(new Recognizer( ptVec, RECOG_MEMO_CAPACITY, cur->scan.get() ));
+    Recognizer& recognizer = *cur->recognizer;
+    recognizer.setTrace( trace, srcfile );
+    bool ok;
+    if (unit) {
+        ok = recognizer.parse( *unit->recognizer );
+    }
+    else if (nthreads > 1 && !trace) {
+        WorkerPool pool( nthreads );
+        ok = recognizer.parse( pool );
+    }
+    else {
+        ok = recognizer.parse();
+    }
+    unit.swap(cur);
+
+#ifdef RECOG_MEMO_STATS
+    cerr << srcfile << ": memo hits " << recognizer.memoHits() << ", misses " << recognizer.memoMisses()
+         << ", evictions " << recognizer.memoEvictions() << ", reused declarations " << recognizer.reused() << endl;
+#endif
 
-    if (recognizer.parse() == false) {
+    if (ok == false) {
         stringstream ss;
-        // ss << "Parsing error at " << recognizer.lastErrFile() << ", line" << recognizer.lastErrLine(); 
-        ss << "Parsing error!"; 
+        const vector<unsigned>& errors = recognizer.errors();
+        for (unsigned i=0; i<errors.size(); i++) {
+            // the halves of a `>>` have no place of their own
+            unsigned at = errors[i];
+            while (at > 0 && ptVec[at].fname == 0) {
+                at--;
+            }
+            const PostToken& pt = ptVec[at];
+            ss << (i ? "\n" : "") << "Parsing error at " << (pt.fname ? *pt.fname : srcfile) << ", line " << pt.fline;
+        }
         throw RecognizerException(ss.str().c_str());
     }
 
 };
 
+void DoRecog(const string& srcfile, RecogTrace* trace = 0)
+{
+    unique_ptr<RecogUnit> unit;
+    DoRecog(srcfile, trace, unit);
+}
+
+
+// how RecogBatch recognizes the files
+struct RecogOptions
+{
+    RecogOptions()
+        : traced(false), reparse(false), nthreads(1), jobs(1), scoped(false), symbols(false), database(0), headers(0)
+    {
+    }
+
+    bool     traced;        // record a RecogTrace of each
+    bool     reparse;       // successive versions of one file, see DoRecog
+    unsigned nthreads;      // threads for one file
+    unsigned jobs;          // files at once, 1 with reparse
+    bool     scoped;        // classify identifiers by a SymbolScan
+    bool     symbols;       // ... and keep an image of its SymbolTable
+    SymbolDatabase* database;   // ... and merge its SymbolTable into this one
+    HeaderCache* headers;       // share the preprocessed headers between files
+};
+
+// what became of one file of a batch
+struct RecogResult
+{
+    RecogResult()
+        : ok(false), lookupHits(0), lookupMisses(0), lookupInvalidations(0)
+    {
+    }
+
+    bool                    ok;
+    string                  error;      // what went wrong if not ok
+    string                  tokens;     // as printed by preproc
+    unique_ptr<RecogTrace>  trace;
+    string                  symbols;    // see WriteSymbolImage
+
+    // of the name lookup cache of the SymbolScan, if scoped
+    unsigned long           lookupHits;
+    unsigned long           lookupMisses;
+    unsigned long           lookupInvalidations;
+};
+
+// Recognize `srcfiles`, up to options.jobs of them at once.  `report` gets
+// the result of each file in the order of `srcfiles`, as soon as those
+// before it are done, and one at a time.
+void RecogBatch(const vector<string>& srcfiles, const RecogOptions& options,
+                const function<void (const string& srcfile, RecogResult& result)>& report)
+{
+    if (options.reparse && options.jobs > 1)
+        throw logic_error("-reparse parses one file after the other");
+
+    vector< unique_ptr<RecogResult> > results(srcfiles.size());
+    size_t next = 0;
+    mutex resultsLock;
+    unique_ptr<RecogUnit> prev;
+
+    WorkerPool pool(options.jobs);
+    pool.run(srcfiles.size(), [&](size_t i)
+    {
+        unique_ptr<RecogResult> result(new RecogResult);
+        unique_ptr<RecogUnit> unit;
+        ostringstream dump;
+
+        if (options.traced)
+            result->trace.reset(new RecogTrace());
+        try
+        {
+            DoRecog(srcfiles[i], result->trace.get(), options.reparse ? prev : unit, options.nthreads, dump, options.scoped,
+                    options.headers);
+            result->ok = true;
+        }
+        catch (exception& e)
+        {
+            result->ok = false;
+            result->error = e.what();
+        }
+        const RecogUnit* done = options.reparse ? prev.get() : unit.get();
+        if (done && done->scan)
+        {
+            const SymbolTable& table = done->scan->table();
+            result->lookupHits = table.cacheHits();
+            result->lookupMisses = table.cacheMisses();
+            result->lookupInvalidations = table.cacheInvalidations();
+            if (options.symbols)
+            {
+                ostringstream image;
+                WriteSymbolImage(image, srcfiles[i], table);
+                result->symbols = image.str();
+            }
+            if (options.database)
+                options.database->merge(table);
+        }
+        result->tokens = dump.str();
+
+        lock_guard<mutex> lock(resultsLock);
+        results[i].swap(result);
+        for ( ; next < results.size() && results[next]; next++)
+        {
+            report(srcfiles[next], *results[next]);
+            results[next].reset();
+        }
+    });
+}
+
 
 #ifdef PA6
 int main(int argc, char** argv)
@@ -520,31 +1301,72 @@ int main(int argc, char** argv)
 		for (int i = 1; i < argc; i++)
 			args.emplace_back(argv[i]);
 
+		// recog [-trace <tracefile>] [-reparse] [-threads <n>] [-j <n>] -o <outfile> <srcfile>...
+		//
+		// with -reparse the srcfiles are successive versions of one file,
+		// each parsed incrementally from the one before; -threads parses
+		// each one on n threads, and -j recognizes n files at once
+		string tracefile;
+		RecogOptions options;
+		while (args.size() >= 1 && args[0] != "-o")
+		{
+			if (args[0] == "-trace" && args.size() >= 2)
+			{
+				tracefile = args[1];
+				args.erase(args.begin(), args.begin() + 2);
+			}
+			else if (args[0] == "-reparse")
+			{
+				options.reparse = true;
+				args.erase(args.begin());
+			}
+			else if (args[0] == "-threads" && args.size() >= 2)
+			{
+				options.nthreads = max(1ul, stoul(args[1]));
+				args.erase(args.begin(), args.begin() + 2);
+			}
+			else if (args[0] == "-j" && args.size() >= 2)
+			{
+				options.jobs = max(1ul, stoul(args[1]));
+				args.erase(args.begin(), args.begin() + 2);
+			}
+			else
+				throw logic_error("invalid usage");
+		}
+
 		if (args.size() < 3 || args[0] != "-o")
 			throw logic_error("invalid usage");
 
+		if (!RECOG_TRACE && !tracefile.empty())
+			throw logic_error("built without RECOG_TRACE");
+
+		ofstream traceOut;
+		if (!tracefile.empty())
+			traceOut.open(tracefile, ios::binary);
+		options.traced = !tracefile.empty();
+
 		string outfile = args[1];
-		size_t nsrcfiles = args.size() - 2;
+		vector<string> srcfiles(args.begin() + 2, args.end());
 
 		ofstream out(outfile);
 
-		out << "recog " << nsrcfiles << endl;
+		out << "recog " << srcfiles.size() << endl;
 
-		for (size_t i = 0; i < nsrcfiles; i++)
+		RecogBatch(srcfiles, options, [&](const string& srcfile, RecogResult& result)
 		{
-			string srcfile = args[i+2];
-
-			try
+			cout << result.tokens;
+			if (result.ok)
 			{
-				DoRecog(srcfile);
 				out << srcfile << " OK" << endl;
 			}
-			catch (exception& e)
+			else
 			{
-				cerr << e.what() << endl;
+				cerr << result.error << endl;
 				out << srcfile << " BAD" << endl;
 			}
-		}
+			if (result.trace)
+				result.trace->write(traceOut);
+		});
 	}
 	catch (exception& e)
 	{
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <unordered_map>
+#include <cstdint>
+#include <stdexcept>
+#include "posttoken.cpp"
+
+using namespace std;
+
+
+// Tracing of the Recognizer.  With RECOG_TRACE 0 no trace code is compiled
+// in at all; otherwise a Recognizer given a RecogTrace records what it
+// does, and one without pays a null test per event.
+#ifndef RECOG_TRACE
+#define RECOG_TRACE 1
+#endif
+
+// events kept by a RecogTrace, older ones are overwritten
+#ifndef RECOG_TRACE_RECORDS
+#define RECOG_TRACE_RECORDS (1 << 20)
+#endif
+
+
+// RecogTrace: the events of one recognition as fixed size binary records
+// in a ring buffer.  write() appends them, together with the token and
+// rule names they refer to, to a trace file as one section; read() loads
+// a section back for the pretty printer (tracedump.cpp).
+class RecogTrace
+{
+  public:
+    enum Kind {
+        ENTER,      // a rule body starts, arg is the rule name
+        LEAVE,      // ... and ends
+        MATCH,      // a token matched, arg is the terminal
+        BACKTO      // backtracked
+    };
+
+    // pos is the token index at the time of the event
+    struct Record {
+        uint8_t  kind;
+        uint8_t  unused;
+        uint16_t arg;
+        uint32_t pos;
+    };
+
+    struct Token {
+        uint16_t type;
+        string   source;
+    };
+
+    explicit RecogTrace(size_t capacity = RECOG_TRACE_RECORDS)
+        : _capacity(capacity), _count(0), _tokens(0), _cursor(0)
+    {
+        if (capacity == 0) {
+            throw logic_error("RecogTrace: no room for records");
+        }
+    }
+
+    // start tracing the parse of `tokens`, `cursor` is the parser's position
+    void begin(const string& srcfile, vector<PostToken>& tokens, const vector<PostToken>::iterator* cursor)
+    {
+        _srcfile = srcfile;
+        _tokens = &tokens;
+        _cursor = cursor;
+        _ring.assign(_capacity, Record());
+        _count = 0;
+        _names.clear();
+        _nameIds.clear();
+        _tokenTable.clear();
+        for (unsigned i=0; i<tokens.size(); i++) {
+            Token t;
+            t.type = tokens[i].type;
+            t.source = tokens[i].source.str();
+            _tokenTable.push_back(t);
+        }
+    }
+
+    void enter(const char* name)
+    {
+        add(ENTER, nameId(name));
+    }
+
+    void leave(const char* name)
+    {
+        add(LEAVE, nameId(name));
+    }
+
+    void match(EPostTokenType tp)
+    {
+        add(MATCH, tp);
+    }
+
+    void backTo()
+    {
+        add(BACKTO, 0);
+    }
+
+    // events recorded, including the overwritten ones
+    uint64_t count() const
+    {
+        return _count;
+    }
+
+    void write(ostream& out) const
+    {
+        uint64_t kept = min<uint64_t>(_count, _capacity);
+
+        out.write("RTRC", 4);
+        put(out, (uint32_t) 1);
+        putString(out, _srcfile);
+        put(out, (uint32_t) _tokenTable.size());
+        for (unsigned i=0; i<_tokenTable.size(); i++) {
+            put(out, _tokenTable[i].type);
+            putString(out, _tokenTable[i].source);
+        }
+        put(out, (uint32_t) _names.size());
+        for (unsigned i=0; i<_names.size(); i++) {
+            putString(out, _names[i]);
+        }
+        put(out, _count);
+        put(out, kept);
+        for (uint64_t i=_count-kept; i<_count; i++) {
+            put(out, _ring[i % _capacity]);
+        }
+    }
+
+    // a section written by write(), false at the end of the file
+    bool read(istream& in)
+    {
+        char magic[4];
+        if (!in.read(magic, 4)) {
+            return false;
+        }
+        uint32_t version, n;
+        if (string(magic, 4) != "RTRC" || !get(in, version) || version != 1) {
+            throw runtime_error("not a recognizer trace");
+        }
+        getString(in, _srcfile);
+        get(in, n);
+        _tokenTable.resize(n);
+        for (unsigned i=0; i<n; i++) {
+            get(in, _tokenTable[i].type);
+            getString(in, _tokenTable[i].source);
+        }
+        get(in, n);
+        _names.resize(n);
+        for (unsigned i=0; i<n; i++) {
+            getString(in, _names[i]);
+        }
+        uint64_t kept = 0;
+        get(in, _count);
+        get(in, kept);
+        _ring.resize(kept);
+        for (uint64_t i=0; i<kept; i++) {
+            get(in, _ring[i]);
+        }
+        if (!in) {
+            throw runtime_error("truncated recognizer trace");
+        }
+        return true;
+    }
+
+    // what read() loaded, records oldest first
+    const string&         srcfile() const { return _srcfile; }
+    const vector<Token>&  tokens() const  { return _tokenTable; }
+    const vector<string>& names() const   { return _names; }
+    const vector<Record>& records() const { return _ring; }
+
+  private:
+    RecogTrace(const RecogTrace&);
+    RecogTrace& operator= (const RecogTrace&);
+
+    void add(Kind kind, unsigned arg)
+    {
+        Record& r = _ring[_count % _capacity];
+        r.kind = kind;
+        r.unused = 0;
+        r.arg = arg;
+        r.pos = *_cursor - _tokens->begin();
+        _count++;
+    }
+
+    // rule names are string literals, so their address identifies them
+    unsigned nameId(const char* name)
+    {
+        unordered_map<const char*, unsigned>::iterator it = _nameIds.find(name);
+        if (it != _nameIds.end()) {
+            return it->second;
+        }
+        _names.push_back(name);
+        return _nameIds[name] = _names.size() - 1;
+    }
+
+    template <class T>
+    static void put(ostream& out, const T& v)
+    {
+        out.write((const char*) &v, sizeof(v));
+    }
+
+    static void putString(ostream& out, const string& s)
+    {
+        put(out, (uint32_t) s.size());
+        out.write(s.data(), s.size());
+    }
+
+    template <class T>
+    static bool get(istream& in, T& v)
+    {
+        return (bool) in.read((char*) &v, sizeof(v));
+    }
+
+    static void getString(istream& in, string& s)
+    {
+        uint32_t n = 0;
+        get(in, n);
+        s.resize(n);
+        in.read(&s[0], n);
+    }
+
+    size_t                                _capacity;
+    uint64_t                              _count;
+    vector<Record>                        _ring;
+
+    string                                _srcfile;
+    vector<PostToken>*                    _tokens;
+    const vector<PostToken>::iterator*    _cursor;
+    vector<Token>                         _tokenTable;
+    vector<string>                        _names;
+    unordered_map<const char*, unsigned>  _nameIds;
+};
@@ -0,0 +1,24 @@
+#!/bin/bash
+
+# symbol table tests: each symtab-tests/X.t must be recognized, and what
+# nsdecl -symbols declares for it, as symdump prints it, must match
+# X.expected
+
+pass=0
+fail=0
+for t in symtab-tests/*.t
+do
+	b=${t%.t}
+	{ ./nsdecl -symbols $b.symbols -o $b.out $t > /dev/null 2>&1 && grep -x "$t OK" $b.out && ./symdump $b.symbols; } > $b.my
+	if diff -q $b.expected $b.my > /dev/null
+	then
+		pass=$((pass+1))
+	else
+		echo "$t: FAIL"
+		diff $b.expected $b.my
+		fail=$((fail+1))
+	fi
+done
+
+echo "symtab tests: $pass passed, $fail failed"
+[ $fail = 0 ]
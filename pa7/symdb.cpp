@@ -0,0 +1,257 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include "symtab.cpp"
+
+using namespace std;
+
+
+// SymbolDatabase: the namespace-scope names of many translation units,
+// merged into one tree.  merge() may be called from several threads at
+// once; every namespace has a lock of its own, taken while its children
+// or names are looked up or added.  A name declared at the same place,
+// as in a header that several translation units include, is kept once.
+// An unnamed namespace, and every one inside it, is one for each file it
+// has names in: what a header declares in it is shared by the translation
+// units that include the header, and what a unit declares in its own file
+// stays apart.
+class SymbolDatabase
+{
+  public:
+    SymbolDatabase()
+        : _global(new Space( 0, SymbolLocation(), false )), _namespaces(1), _entities(0), _duplicates(0)
+    {
+    }
+
+    // the SymbolTable of one translation unit
+    void merge(const SymbolTable& table)
+    {
+        vector<Spaces> spaces( table.namespaces() );
+        for (unsigned ns=1; ns<spaces.size(); ns++) {
+            space( table, ns, table.location( ns ).file, spaces );
+        }
+
+        for (unsigned ns=0; ns<spaces.size(); ns++) {
+            const vector<SymbolTable::Declaration>& decls = table.declarations( ns );
+
+            // the spaces are found before any is locked, as child() locks
+            // the one around
+            vector<Space*> targets( decls.size() );
+            for (unsigned i=0; i<decls.size(); i++) {
+                const SymbolTable::Declaration& d = decls[i];
+                // namespace definitions are the children
+                if (!(d.sym.kind == SK_NAMESPACE && table.parent( d.sym.ns ) == ns && table.name( d.sym.ns ) == d.name)) {
+                    targets[i] = space( table, ns, d.where.file, spaces );
+                }
+            }
+
+            for (unsigned i=0; i<decls.size(); i++) {
+                if (!targets[i]) {
+                    continue;
+                }
+                const SymbolTable::Declaration& d = decls[i];
+                Space& space = *targets[i];
+                lock_guard<mutex> lock( space.lock );
+                Entity e = { &table.spelling( d.name ).str(), d.sym.kind, d.where };
+                if (space.seen.insert( e ).second) {
+                    space.entities.push_back( e );
+                    _entities++;
+                }
+                else {
+                    _duplicates++;
+                }
+            }
+        }
+    }
+
+    unsigned long namespaceCount() const {
+        return _namespaces;
+    }
+
+    unsigned long entityCount() const {
+        return _entities;
+    }
+
+    // declarations found again and kept once
+    unsigned long duplicates() const {
+        return _duplicates;
+    }
+
+    // the merged tree, once all merges are done.  Children and names are
+    // sorted, so the dump does not depend on the order of the merges.
+    void dump(ostream& out) const
+    {
+        out << _namespaces << " namespaces, " << _entities << " names, " << _duplicates << " duplicates" << endl;
+        dump( out, *_global );
+    }
+
+  private:
+    SymbolDatabase(const SymbolDatabase&);
+    SymbolDatabase& operator= (const SymbolDatabase&);
+
+    struct Entity
+    {
+        const string*  name;        // interned spelling
+        unsigned       kind;
+        SymbolLocation where;
+
+        bool operator== (const Entity& o) const {
+            return name == o.name && kind == o.kind && where.file == o.where.file && where.line == o.where.line;
+        }
+    };
+
+    struct EntityHash
+    {
+        size_t operator() (const Entity& e) const {
+            return ((hash<const void*>()( e.name ) * 31 + e.kind) * 31 + hash<const void*>()( e.where.file )) * 31 + e.where.line;
+        }
+    };
+
+    // a child namespace: its name, or the file of its names if unnamed
+    struct SpaceKey
+    {
+        const string*  name;
+        SymbolLocation where;
+
+        bool operator== (const SpaceKey& o) const {
+            return name == o.name && where.file == o.where.file && where.line == o.where.line;
+        }
+    };
+
+    struct SpaceKeyHash
+    {
+        size_t operator() (const SpaceKey& k) const {
+            return (hash<const void*>()( k.name ) * 31 + hash<const void*>()( k.where.file )) * 31 + k.where.line;
+        }
+    };
+
+    struct Space
+    {
+        Space(const string* name, const SymbolLocation& where, bool isInline)
+            : name(name), where(where), isInline(isInline)
+        {
+        }
+
+        const string*                                             name;   // 0 if unnamed
+        SymbolLocation                                            where;
+        bool                                                      isInline;
+        mutex                                                     lock;
+        unordered_map<SpaceKey, unique_ptr<Space>, SpaceKeyHash>  children;
+        unordered_set<Entity, EntityHash>                         seen;
+        vector<Entity>                                            entities;
+    };
+
+    // the spaces of the namespaces of one table, by file for unnamed ones
+    typedef unordered_map<const string*, Space*> Spaces;
+
+    // the space of namespace `ns` of `table` for the names it has in
+    // `file`; the same for every file, unless in an unnamed namespace
+    Space* space(const SymbolTable& table, unsigned ns, const string* file, vector<Spaces>& spaces)
+    {
+        if (ns == SymbolTable::GLOBAL) {
+            return _global.get();
+        }
+        const SymbolLocation& where = table.location( ns );
+        const string* name = table.name( ns ) ? &table.spelling( table.name( ns )).str() : 0;
+        if (name && !unnamed( table, table.parent( ns ))) {
+            file = where.file;
+        }
+
+        Space*& s = spaces[ns][file];
+        if (!s) {
+            Space& parent = *space( table, table.parent( ns ), file, spaces );
+            s = child( parent, name, name ? where : SymbolLocation( file, 0 ), table.isInline( ns ));
+        }
+        return s;
+    }
+
+    // `ns` is an unnamed namespace or inside one
+    static bool unnamed(const SymbolTable& table, unsigned ns)
+    {
+        for (; ns != SymbolTable::GLOBAL; ns = table.parent( ns )) {
+            if (!table.name( ns )) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Space* child(Space& parent, const string* name, const SymbolLocation& where, bool isInline)
+    {
+        SpaceKey key = { name, name ? SymbolLocation() : where };
+        lock_guard<mutex> lock( parent.lock );
+        unique_ptr<Space>& space = parent.children[key];
+        if (!space) {
+            space.reset( new Space( name, where, isInline ));
+            _namespaces++;
+        }
+        space->isInline = space->isInline || isInline;
+        return space.get();
+    }
+
+    static string str(const SymbolLocation& where)
+    {
+        return (where.file ? *where.file : string("?")) + ":" + to_string( where.line );
+    }
+
+    static bool before(const SymbolLocation& a, const SymbolLocation& b)
+    {
+        string fa = a.file ? *a.file : string();
+        string fb = b.file ? *b.file : string();
+        return fa < fb || (fa == fb && a.line < b.line);
+    }
+
+    static void dump(ostream& out, const Space& space)
+    {
+        if (space.name) {
+            out << "start namespace " << *space.name << endl;
+        }
+        else {
+            out << "start unnamed namespace" << endl;
+        }
+        if (space.isInline) {
+            out << "inline namespace" << endl;
+        }
+
+        vector<Entity> entities( space.entities );
+        sort( entities.begin(), entities.end(), []( const Entity& a, const Entity& b )
+        {
+            if (before( a.where, b.where ) || before( b.where, a.where )) {
+                return before( a.where, b.where );
+            }
+            return *a.name < *b.name || (*a.name == *b.name && a.kind < b.kind);
+        });
+        for (unsigned i=0; i<entities.size(); i++) {
+            const Entity& e = entities[i];
+            out << SymbolKindName( e.kind ) << " " << *e.name << " " << str( e.where ) << endl;
+        }
+
+        vector<const Space*> children;
+        for (auto it = space.children.begin(); it != space.children.end(); ++it) {
+            children.push_back( it->second.get() );
+        }
+        sort( children.begin(), children.end(), []( const Space* a, const Space* b )
+        {
+            string na = a->name ? *a->name : string();
+            string nb = b->name ? *b->name : string();
+            return na < nb || (na == nb && before( a->where, b->where ));
+        });
+        for (unsigned i=0; i<children.size(); i++) {
+            dump( out, *children[i] );
+        }
+        out << "end namespace" << endl;
+    }
+
+    unique_ptr<Space>       _global;
+    atomic<unsigned long>   _namespaces;
+    atomic<unsigned long>   _entities;
+    atomic<unsigned long>   _duplicates;
+};
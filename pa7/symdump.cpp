@@ -0,0 +1,65 @@
+// symdump: prints the symbol files written by `nsdecl -symbols`, the
+// namespaces of each translation unit with what is declared in them
+//
+//   symdump <symfile>
+
+#include "symfile.cpp"
+
+using namespace std;
+
+
+void DumpNamespace(const SymbolImage& image, unsigned ns, int depth)
+{
+    const SymbolImage::Namespace& n = image.ns(ns);
+    string indent(depth*2, ' ');
+
+    if (n.name == 0) {
+        cout << indent << "start unnamed namespace" << endl;
+    }
+    else {
+        cout << indent << "start namespace " << image.str(n.name) << endl;
+    }
+    if (n.flags & SymbolImageFormat::INLINE) {
+        cout << indent << "inline namespace" << endl;
+    }
+    for (unsigned i=0; i<n.usingCount; i++) {
+        const SymbolImage::Namespace& u = image.ns(image.usings(ns)[i]);
+        cout << indent << "  using namespace " << (u.name ? image.str(u.name) : "<unnamed>") << endl;
+    }
+    for (unsigned i=0; i<n.memberCount; i++) {
+        const SymbolImage::Member& m = image.members(ns)[i];
+        cout << indent << "  " << SymbolKindName(m.kind) << " " << image.str(m.name);
+        // a namespace alias
+        if (m.ns != SymbolImageFormat::NONE && (image.ns(m.ns).name != m.name || image.ns(m.ns).parent != ns)) {
+            cout << " = " << image.str(image.ns(m.ns).name);
+        }
+        cout << endl;
+    }
+    for (unsigned i=0; i<n.childCount; i++) {
+        DumpNamespace(image, image.children(ns)[i], depth + 1);
+    }
+    cout << indent << "end namespace" << endl;
+}
+
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        if (argc != 2)
+            throw logic_error("usage: symdump <symfile>");
+
+        SymbolFile file(argv[1]);
+        for (unsigned i=0; i<file.units().size(); i++)
+        {
+            const SymbolImage& image = file.units()[i];
+            cout << "symbols " << image.srcfile() << ": " << image.namespaceCount() << " namespaces" << endl;
+            DumpNamespace(image, SymbolTable::GLOBAL, 0);
+        }
+    }
+    catch (exception& e)
+    {
+        cerr << "ERROR: " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,344 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "symtab.cpp"
+
+using namespace std;
+
+
+// The SymbolTable of a translation unit as a flat binary image, made to
+// be mapped into memory and read in place.  An image is a header, the
+// namespaces, the members of all of them, an index of namespaces and a
+// string table, each an array of 32 bit words or the strings; all parts
+// are at word aligned offsets from the start of the image.  A namespace
+// has its members, child namespaces and nominated namespaces as ranges of
+// the member array and the index, so they are found without a search.
+// Images are written one after the other into a file, with `-symbols` of
+// nsdecl.
+namespace SymbolImageFormat
+{
+    enum {
+        VERSION = 1,
+        NONE    = 0xffffffff,   // no namespace, for the parent of the global one
+        INLINE  = 1             // of Namespace::flags
+    };
+
+    struct Header
+    {
+        char     magic[4];      // NSYM
+        uint32_t version;
+        uint32_t size;          // of the whole image
+        uint32_t srcfile;       // string offset
+        uint32_t namespaceCount;
+        uint32_t memberCount;
+        uint32_t indexCount;
+        uint32_t stringBytes;
+        uint32_t namespaces;    // offsets from the start of the image
+        uint32_t members;
+        uint32_t index;
+        uint32_t strings;
+    };
+
+    // namespace 0 is the global namespace; namespaces come in the order
+    // they were first defined, so a parent comes before its children
+    struct Namespace
+    {
+        uint32_t name;          // string offset, 0 for the empty name if unnamed
+        uint32_t parent;
+        uint32_t flags;
+        uint32_t firstMember;   // into the members
+        uint32_t memberCount;
+        uint32_t firstChild;    // into the index
+        uint32_t childCount;
+        uint32_t firstUsing;    // into the index
+        uint32_t usingCount;
+    };
+
+    // in the order they were first declared
+    struct Member
+    {
+        uint32_t name;          // string offset
+        uint32_t kind;          // ESymbolKind bits
+        uint32_t ns;            // the namespace a namespace name denotes, NONE otherwise
+    };
+}
+
+
+// the image of `table`, the symbols of `srcfile`
+void WriteSymbolImage(ostream& out, const string& srcfile, const SymbolTable& table)
+{
+    using namespace SymbolImageFormat;
+
+    string strings( 1, '\0' );
+    OpenHashMap<unsigned, uint32_t> offsets;        // of interned names
+    auto str = [&]( const string& s ) -> uint32_t
+    {
+        uint32_t offset = strings.size();
+        strings.append( s.c_str(), s.size() + 1 );
+        return offset;
+    };
+    auto name = [&]( unsigned id ) -> uint32_t
+    {
+        if (id == 0) {
+            return 0;
+        }
+        uint32_t& offset = offsets[id];
+        if (offset == 0) {
+            offset = str( table.spelling( id ));
+        }
+        return offset;
+    };
+
+    unsigned n = table.namespaces();
+    vector< vector<uint32_t> > children( n );
+    for (unsigned ns=1; ns<n; ns++) {
+        children[ table.parent( ns ) ].push_back( ns );
+    }
+
+    Header h;
+    memcpy( h.magic, "NSYM", 4 );
+    h.version = VERSION;
+    h.srcfile = str( srcfile );
+
+    vector<Namespace> namespaces( n );
+    vector<Member> members;
+    vector<uint32_t> index;
+    for (unsigned ns=0; ns<n; ns++) {
+        Namespace& r = namespaces[ns];
+        r.name = name( table.name( ns ));
+        r.parent = (ns == SymbolTable::GLOBAL) ? (uint32_t) NONE : table.parent( ns );
+        r.flags = table.isInline( ns ) ? INLINE : 0;
+
+        const vector<unsigned>& order = table.members( ns );
+        r.firstMember = members.size();
+        r.memberCount = order.size();
+        for (unsigned i=0; i<order.size(); i++) {
+            Symbol sym = table.declared( ns, order[i] );
+            Member m;
+            m.name = name( order[i] );
+            m.kind = sym.kind;
+            m.ns = (sym.kind == SK_NAMESPACE) ? sym.ns : (uint32_t) NONE;
+            members.push_back( m );
+        }
+
+        r.firstChild = index.size();
+        r.childCount = children[ns].size();
+        index.insert( index.end(), children[ns].begin(), children[ns].end() );
+
+        const vector<unsigned>& usings = table.usings( ns );
+        r.firstUsing = index.size();
+        r.usingCount = usings.size();
+        index.insert( index.end(), usings.begin(), usings.end() );
+    }
+    strings.resize( (strings.size() + 3) & ~3u, '\0' );
+
+    h.namespaceCount = namespaces.size();
+    h.memberCount = members.size();
+    h.indexCount = index.size();
+    h.stringBytes = strings.size();
+    h.namespaces = sizeof(Header);
+    h.members = h.namespaces + namespaces.size() * sizeof(Namespace);
+    h.index = h.members + members.size() * sizeof(Member);
+    h.strings = h.index + index.size() * sizeof(uint32_t);
+    h.size = h.strings + strings.size();
+
+    out.write( (const char*) &h, sizeof(h) );
+    out.write( (const char*) namespaces.data(), namespaces.size() * sizeof(Namespace) );
+    out.write( (const char*) members.data(), members.size() * sizeof(Member) );
+    out.write( (const char*) index.data(), index.size() * sizeof(uint32_t) );
+    out.write( strings.data(), strings.size() );
+}
+
+
+// SymbolImage: one image of WriteSymbolImage() in memory, read in place.
+// The constructor checks that the parts lie within `size` bytes; the
+// memory must outlive the SymbolImage.
+class SymbolImage
+{
+  public:
+    typedef SymbolImageFormat::Header    Header;
+    typedef SymbolImageFormat::Namespace Namespace;
+    typedef SymbolImageFormat::Member    Member;
+
+    SymbolImage(const char* data, size_t size)
+        : _data(data)
+    {
+        if (size < sizeof(Header) || memcmp( header().magic, "NSYM", 4 ) != 0) {
+            throw runtime_error("not a symbol image");
+        }
+        const Header& h = header();
+        if (h.version != SymbolImageFormat::VERSION) {
+            throw runtime_error("symbol image of another version");
+        }
+        if (h.size > size || h.size % 4 != 0 || h.namespaceCount == 0 ||
+            !inside( h.namespaces, h.namespaceCount, sizeof(Namespace) ) ||
+            !inside( h.members, h.memberCount, sizeof(Member) ) ||
+            !inside( h.index, h.indexCount, sizeof(uint32_t) ) ||
+            !inside( h.strings, h.stringBytes, 1 ) || h.stringBytes == 0 ||
+            _data[h.strings + h.stringBytes - 1] != '\0') {
+            throw runtime_error("truncated symbol image");
+        }
+        for (unsigned i=0; i<h.namespaceCount; i++) {
+            const Namespace& ns = namespaces()[i];
+            if ((uint64_t) ns.firstMember + ns.memberCount > h.memberCount ||
+                (uint64_t) ns.firstChild + ns.childCount > h.indexCount ||
+                (uint64_t) ns.firstUsing + ns.usingCount > h.indexCount) {
+                throw runtime_error("corrupt symbol image");
+            }
+        }
+        for (unsigned i=0; i<h.indexCount; i++) {
+            if (index()[i] >= h.namespaceCount) {
+                throw runtime_error("corrupt symbol image");
+            }
+        }
+        for (unsigned i=0; i<h.memberCount; i++) {
+            uint32_t ns = ((const Member*) (_data + h.members))[i].ns;
+            if (ns != SymbolImageFormat::NONE && ns >= h.namespaceCount) {
+                throw runtime_error("corrupt symbol image");
+            }
+        }
+    }
+
+    // bytes of the image, the next one follows
+    size_t size() const
+    {
+        return header().size;
+    }
+
+    const char* srcfile() const
+    {
+        return str( header().srcfile );
+    }
+
+    unsigned namespaceCount() const
+    {
+        return header().namespaceCount;
+    }
+
+    const Namespace& ns(unsigned i) const
+    {
+        return namespaces()[i];
+    }
+
+    // what is declared in namespace `i`: [first, first + count) of ns(i)
+    const Member* members(unsigned i) const
+    {
+        return (const Member*) (_data + header().members) + ns(i).firstMember;
+    }
+
+    const uint32_t* children(unsigned i) const
+    {
+        return index() + ns(i).firstChild;
+    }
+
+    const uint32_t* usings(unsigned i) const
+    {
+        return index() + ns(i).firstUsing;
+    }
+
+    // a string of the string table, such as the name of a namespace
+    const char* str(uint32_t offset) const
+    {
+        return offset < header().stringBytes ? _data + header().strings + offset : "";
+    }
+
+  private:
+    const Header& header() const
+    {
+        return *(const Header*) _data;
+    }
+
+    const Namespace* namespaces() const
+    {
+        return (const Namespace*) (_data + header().namespaces);
+    }
+
+    const uint32_t* index() const
+    {
+        return (const uint32_t*) (_data + header().index);
+    }
+
+    bool inside(uint32_t offset, uint32_t count, size_t width) const
+    {
+        return offset % 4 == 0 && offset >= sizeof(Header) && offset + (uint64_t) count * width <= header().size;
+    }
+
+    const char* _data;
+};
+
+
+// SymbolFile: the images of a file written by `nsdecl -symbols`, mapped
+// into memory
+class SymbolFile
+{
+  public:
+    explicit SymbolFile(const string& path)
+        : _data(0), _size(0)
+    {
+        int fd = ::open( path.c_str(), O_RDONLY );
+        if (fd < 0) {
+            throw runtime_error("cannot open " + path);
+        }
+        struct stat st;
+        if (fstat( fd, &st ) != 0) {
+            ::close( fd );
+            throw runtime_error("cannot stat " + path);
+        }
+        _size = st.st_size;
+        if (_size > 0) {
+            void* p = mmap( 0, _size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if (p == MAP_FAILED) {
+                ::close( fd );
+                throw runtime_error("cannot map " + path);
+            }
+            _data = (const char*) p;
+        }
+        ::close( fd );
+
+        try {
+            for (size_t offset = 0; offset < _size; offset += _units.back().size()) {
+                _units.push_back( SymbolImage( _data + offset, _size - offset ));
+            }
+        }
+        catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    ~SymbolFile()
+    {
+        unmap();
+    }
+
+    // one image per translation unit
+    const vector<SymbolImage>& units() const
+    {
+        return _units;
+    }
+
+  private:
+    SymbolFile(const SymbolFile&);
+    SymbolFile& operator= (const SymbolFile&);
+
+    void unmap()
+    {
+        if (_data) {
+            munmap( (void*) _data, _size );
+            _data = 0;
+        }
+    }
+
+    const char*         _data;
+    size_t              _size;
+    vector<SymbolImage> _units;
+};
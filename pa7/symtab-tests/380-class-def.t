@@ -0,0 +1,3 @@
+struct S { int a; };
+
+S s;
@@ -0,0 +1,3 @@
+template<class X> struct V { };
+
+V<int> v;
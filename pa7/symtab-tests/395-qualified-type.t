@@ -0,0 +1,9 @@
+struct S { typedef int T; };
+
+S::T x;
+int y = x;
+
+template<class C> struct W { };
+
+template<class X> typename W<X>::type g(X);
+int z = g<int>(1);
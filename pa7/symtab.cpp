@@ -0,0 +1,1139 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include "posttoken.cpp"
+
+using namespace std;
+
+
+// what a name stands for, a set of these bits.  Names are looked up to
+// classify identifiers, so entities of one kind need not be told apart.
+enum ESymbolKind
+{
+    SK_NAMESPACE = 1 << 0,      // a namespace or namespace alias
+    SK_CLASS     = 1 << 1,
+    SK_ENUM      = 1 << 2,
+    SK_TYPEDEF   = 1 << 3,      // also a template type parameter
+    SK_TEMPLATE  = 1 << 4,
+    SK_OBJECT    = 1 << 5       // a variable, function or enumerator
+};
+
+// the kinds of `kind`, as in "class|template"
+string SymbolKindName(unsigned kind)
+{
+    static const char* names[] = { "namespace", "class", "enum", "typedef", "template", "object" };
+    string s;
+    for (unsigned i=0; i<6; i++) {
+        if (kind & (1 << i)) {
+            s += s.empty() ? "" : "|";
+            s += names[i];
+        }
+    }
+    return s;
+}
+
+// where a name is declared, the file and line of its declarator-id
+struct SymbolLocation
+{
+    SymbolLocation()
+        : file(0), line(0)
+    {
+    }
+
+    SymbolLocation(const string* file, int line)
+        : file(file), line(line)
+    {
+    }
+
+    const string* file;     // as PostToken::fname, 0 if not known
+    int           line;
+};
+
+// what a lookup finds, a kind of 0 for nothing; `ns` is the namespace a
+// namespace name denotes
+struct Symbol
+{
+    Symbol()
+        : kind(0), ns(0)
+    {
+    }
+
+    Symbol(unsigned kind, unsigned ns)
+        : kind(kind), ns(ns)
+    {
+    }
+
+    unsigned kind;
+    unsigned ns;
+};
+
+
+inline uint64_t openHashBits(uint64_t key)
+{
+    return key;
+}
+
+inline uint64_t openHashBits(const void* key)
+{
+    return (uintptr_t) key;
+}
+
+// OpenHashMap: hash map with open addressing and linear probing, from
+// integer or pointer keys to V.  The key K() marks a free slot and cannot
+// be stored.  Nothing is ever erased.
+template <class K, class V>
+class OpenHashMap
+{
+  public:
+    OpenHashMap()
+        : _size(0), _mask(0)
+    {
+    }
+
+    const V* find(K key) const
+    {
+        if (_size == 0) {
+            return 0;
+        }
+        for (size_t i = slot(key); ; i = (i + 1) & _mask) {
+            if (_slots[i].key == key) {
+                return &_slots[i].value;
+            }
+            if (_slots[i].key == K()) {
+                return 0;
+            }
+        }
+    }
+
+    // the value of `key`, a V() put in if there was none
+    V& operator[] (K key)
+    {
+        if ((_size + 1) * 4 > _slots.size() * 3) {
+            grow();
+        }
+        size_t i = slot(key);
+        while (_slots[i].key != key && _slots[i].key != K()) {
+            i = (i + 1) & _mask;
+        }
+        if (_slots[i].key == K()) {
+            _slots[i].key = key;
+            _size++;
+        }
+        return _slots[i].value;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+  private:
+    struct Slot {
+        Slot()
+            : key(), value()
+        {
+        }
+
+        K key;
+        V value;
+    };
+
+    size_t slot(K key) const
+    {
+        return (openHashBits( key ) * 0x9e3779b97f4a7c15ull >> 32) & _mask;
+    }
+
+    void grow()
+    {
+        vector<Slot> old( max<size_t>( 16, _slots.size() * 2 ) );
+        old.swap( _slots );
+        _mask = _slots.size() - 1;
+        for (size_t i=0; i<old.size(); i++) {
+            if (old[i].key != K()) {
+                size_t j = slot( old[i].key );
+                while (_slots[j].key != K()) {
+                    j = (j + 1) & _mask;
+                }
+                _slots[j] = old[i];
+            }
+        }
+    }
+
+    vector<Slot> _slots;
+    size_t       _size;
+    size_t       _mask;
+};
+
+
+// SymbolTable: the names declared at namespace scope.  Identifiers are
+// interned to small ids, and every namespace maps the ids of its members
+// to what they are.  Inline namespaces and using-directives are kept as
+// edges between the namespaces and followed by lookup.  Namespaces are
+// referred to by their index, GLOBAL is the global namespace.
+//
+// Qualified names are interned too, as paths: a path is a name in the
+// namespace its prefix path names.  What a path names from a scope is
+// cached, together with the namespaces looked into to find it.  Every
+// namespace counts up its generation when it gains a member or an edge,
+// and every name when it is declared anywhere.  Generations only grow, so
+// a sum of them stays the same while each does.  An entry goes stale when
+// a namespace looked into gains an edge, or gains a member while a name of
+// the path has been declared.
+class SymbolTable
+{
+  public:
+    enum {
+        GLOBAL    = 0,
+        NO_PATH   = 0,      // the prefix of an unqualified name
+        ROOT_PATH = 1       // the prefix of ::name
+    };
+
+    SymbolTable()
+        : _hits(0), _misses(0), _invalidations(0)
+    {
+        _namespaces.emplace_back( new Namespace( 0, GLOBAL, 0, false, SymbolLocation() ));
+        _spellings.push_back( PostTokenSpelling() );
+        _nameGenerations.push_back( 0 );
+        _pathNodes.resize( 2 );
+    }
+
+    // the id of an identifier, from 1 on
+    unsigned intern(const PostTokenSpelling& spelling)
+    {
+        unsigned& id = _ids[ &spelling.str() ];
+        if (id == 0) {
+            id = _spellings.size();
+            _spellings.push_back( spelling );
+            _nameGenerations.push_back( 0 );
+        }
+        return id;
+    }
+
+    const PostTokenSpelling& spelling(unsigned id) const
+    {
+        return _spellings[id];
+    }
+
+    // the id of the path prefix::name, from 2 on
+    unsigned path(unsigned prefix, unsigned name)
+    {
+        unsigned& id = _pathIds[ (uint64_t) prefix << 32 | name ];
+        if (id == 0) {
+            id = _pathNodes.size();
+            _pathNodes.push_back( make_pair( prefix, name ));
+        }
+        return id;
+    }
+
+    // the namespaces, in the order they were first defined
+    unsigned namespaces() const
+    {
+        return _namespaces.size();
+    }
+
+    unsigned parent(unsigned ns) const
+    {
+        return _namespaces[ns]->parent;
+    }
+
+    // the id of its name, 0 if it has none
+    unsigned name(unsigned ns) const
+    {
+        return _namespaces[ns]->name;
+    }
+
+    bool isInline(unsigned ns) const
+    {
+        return _namespaces[ns]->isInline;
+    }
+
+    // the names declared in `ns`, in the order they were first declared
+    const vector<unsigned>& members(unsigned ns) const
+    {
+        return _namespaces[ns]->order;
+    }
+
+    // the namespaces nominated by using-directives in `ns`
+    const vector<unsigned>& usings(unsigned ns) const
+    {
+        return _namespaces[ns]->usings;
+    }
+
+    // every declaration of a name in `ns`, in order
+    struct Declaration
+    {
+        unsigned       name;
+        Symbol         sym;
+        SymbolLocation where;
+    };
+
+    const vector<Declaration>& declarations(unsigned ns) const
+    {
+        return _namespaces[ns]->declarations;
+    }
+
+    // where `ns` was first defined
+    const SymbolLocation& location(unsigned ns) const
+    {
+        return _namespaces[ns]->where;
+    }
+
+    // what `name` was declared as in `ns` itself
+    Symbol declared(unsigned ns, unsigned name) const
+    {
+        const Symbol* sym = _namespaces[ns]->members.find( name );
+        return sym ? *sym : Symbol();
+    }
+
+    // the namespace `name` defined in `ns` at `where`, new or an earlier
+    // one that this definition extends; the unnamed namespace of `ns` for
+    // name 0
+    unsigned openNamespace(unsigned ns, unsigned name, bool isInline, const SymbolLocation& where = SymbolLocation())
+    {
+        Namespace& outer = *_namespaces[ns];
+        if (name == 0) {
+            if (outer.unnamed == 0) {
+                outer.unnamed = makeNamespace( ns, 0, isInline, where );
+                usingDirective( ns, outer.unnamed );
+            }
+            return outer.unnamed;
+        }
+
+        const Symbol* sym = outer.members.find( name );
+        if (sym && sym->kind == SK_NAMESPACE) {
+            return sym->ns;
+        }
+        unsigned inner = makeNamespace( ns, name, isInline, where );
+        declare( ns, name, Symbol( SK_NAMESPACE, inner ), where );
+        return inner;
+    }
+
+    // `name` is `sym` in `ns` from now on, as declared at `where`
+    void declare(unsigned ns, unsigned name, const Symbol& sym, const SymbolLocation& where = SymbolLocation())
+    {
+        Declaration d = { name, sym, where };
+        _namespaces[ns]->declarations.push_back( d );
+        Symbol& member = _namespaces[ns]->members[name];
+        if (member.kind == 0) {
+            _namespaces[ns]->order.push_back( name );
+        }
+        if (member.kind != sym.kind || member.ns != sym.ns) {
+            member = sym;
+            _namespaces[ns]->generation++;
+            _nameGenerations[name]++;
+        }
+    }
+
+    // using namespace `nominated`; in `ns`
+    void usingDirective(unsigned ns, unsigned nominated)
+    {
+        vector<unsigned>& usings = _namespaces[ns]->usings;
+        if (find( usings.begin(), usings.end(), nominated ) == usings.end()) {
+            usings.push_back( nominated );
+            _namespaces[ns]->generation++;
+            _namespaces[ns]->edges++;
+        }
+    }
+
+    // what `name` is in `ns` itself and in its inline namespaces, which
+    // are added to `seen`
+    Symbol member(unsigned ns, unsigned name, vector<unsigned>* seen = 0) const
+    {
+        const Namespace& n = *_namespaces[ns];
+        if (seen) {
+            seen->push_back( ns );
+        }
+        const Symbol* sym = n.members.find( name );
+        if (sym) {
+            return *sym;
+        }
+        for (unsigned i=0; i<n.inlines.size(); i++) {
+            Symbol s = member( n.inlines[i], name, seen );
+            if (s.kind != 0) {
+                return s;
+            }
+        }
+        return Symbol();
+    }
+
+    // What `path` names at namespace scope `ns`: unqualified lookup of its
+    // first name (3.4.1), then qualified lookup of each following one in
+    // the namespace before it (3.4.3.2)
+    Symbol resolve(unsigned ns, unsigned path)
+    {
+        uint64_t key = (uint64_t) ns << 32 | path;
+        const PathEntry* cached = _pathCache.find( key );
+        if (cached && valid( *cached, path )) {
+            _hits++;
+            return cached->sym;
+        }
+        _misses++;
+        if (cached) {
+            _invalidations++;
+        }
+
+        PathEntry e;
+        unsigned prefix = _pathNodes[path].first;
+        unsigned name = _pathNodes[path].second;
+        if (prefix == NO_PATH) {
+            e.sym = unqualifiedLookup( ns, name, e.namespaces );
+        }
+        else {
+            Symbol scope( SK_NAMESPACE, GLOBAL );
+            if (prefix != ROOT_PATH) {
+                scope = resolve( ns, prefix );
+                const vector<unsigned>& before = _pathCache.find( (uint64_t) ns << 32 | prefix )->namespaces;
+                e.namespaces = before;
+            }
+            if (scope.kind == SK_NAMESPACE) {
+                e.sym = qualifiedLookup( scope.ns, name, e.namespaces );
+            }
+        }
+        stamp( e, path );
+        _pathCache[key] = e;
+        return e.sym;
+    }
+
+    // unqualified lookup of `name` at namespace scope `ns`
+    Symbol lookup(unsigned ns, unsigned name)
+    {
+        return resolve( ns, path( NO_PATH, name ));
+    }
+
+    // of resolve()
+    unsigned long cacheHits() const {
+        return _hits;
+    }
+
+    unsigned long cacheMisses() const {
+        return _misses;
+    }
+
+    // misses on an entry that went stale
+    unsigned long cacheInvalidations() const {
+        return _invalidations;
+    }
+
+  private:
+    SymbolTable(const SymbolTable&);
+    SymbolTable& operator= (const SymbolTable&);
+
+    struct Namespace
+    {
+        Namespace(unsigned name, unsigned parent, unsigned depth, bool isInline, const SymbolLocation& where)
+            : name(name), parent(parent), depth(depth), isInline(isInline), where(where), unnamed(0), generation(0), edges(0)
+        {
+        }
+
+        unsigned                      name;         // 0 if unnamed
+        unsigned                      parent;
+        unsigned                      depth;        // 0 for GLOBAL
+        bool                          isInline;
+        SymbolLocation                where;
+        unsigned                      unnamed;      // its unnamed namespace, 0 for none yet
+        unsigned long                 generation;
+        unsigned long                 edges;        // the generations that added an edge
+        OpenHashMap<unsigned, Symbol> members;
+        vector<unsigned>              order;        // the member names, first declared first
+        vector<Declaration>           declarations;
+        vector<unsigned>              inlines;      // its inline namespaces
+        vector<unsigned>              usings;       // nominated by its using-directives
+    };
+
+    struct PathEntry
+    {
+        PathEntry()
+            : generations(0), edges(0), names(0)
+        {
+        }
+
+        Symbol           sym;
+        vector<unsigned> namespaces;    // looked into, with repeats
+        unsigned long    generations;   // the sums of their generations
+        unsigned long    edges;
+        unsigned long    names;         // the sum of those of the names of the path
+    };
+
+    unsigned makeNamespace(unsigned parent, unsigned name, bool isInline, const SymbolLocation& where)
+    {
+        unsigned ns = _namespaces.size();
+        _namespaces.emplace_back( new Namespace( name, parent, _namespaces[parent]->depth + 1, isInline, where ));
+        if (isInline) {
+            _namespaces[parent]->inlines.push_back( ns );
+            _namespaces[parent]->generation++;
+            _namespaces[parent]->edges++;
+        }
+        return ns;
+    }
+
+    void stamp(PathEntry& e, unsigned path) const
+    {
+        e.generations = 0;
+        e.edges = 0;
+        for (unsigned i=0; i<e.namespaces.size(); i++) {
+            e.generations += _namespaces[ e.namespaces[i] ]->generation;
+            e.edges += _namespaces[ e.namespaces[i] ]->edges;
+        }
+        e.names = nameStamp( path );
+    }
+
+    bool valid(const PathEntry& e, unsigned path) const
+    {
+        unsigned long generations = 0;
+        unsigned long edges = 0;
+        for (unsigned i=0; i<e.namespaces.size(); i++) {
+            generations += _namespaces[ e.namespaces[i] ]->generation;
+            edges += _namespaces[ e.namespaces[i] ]->edges;
+        }
+        return generations == e.generations || (edges == e.edges && nameStamp( path ) == e.names);
+    }
+
+    unsigned long nameStamp(unsigned path) const
+    {
+        unsigned long sum = 0;
+        for ( ; path > ROOT_PATH; path = _pathNodes[path].first) {
+            sum += _nameGenerations[ _pathNodes[path].second ];
+        }
+        return sum;
+    }
+
+    // the nearest namespace enclosing both
+    unsigned common(unsigned a, unsigned b) const
+    {
+        while (_namespaces[a]->depth > _namespaces[b]->depth) {
+            a = parent( a );
+        }
+        while (_namespaces[b]->depth > _namespaces[a]->depth) {
+            b = parent( b );
+        }
+        while (a != b) {
+            a = parent( a );
+            b = parent( b );
+        }
+        return a;
+    }
+
+    // what the using-directives of `ns` nominate, transitively, each with
+    // where its members are found as if declared there: the nearest
+    // namespace enclosing both it and `from`, where the first directive is
+    void nominate(unsigned ns, unsigned from, vector< pair<unsigned, unsigned> >& nominated, vector<unsigned>& seen) const
+    {
+        const vector<unsigned>& usings = _namespaces[ns]->usings;
+        seen.push_back( ns );
+        for (unsigned i=0; i<usings.size(); i++) {
+            unsigned u = usings[i];
+            bool found = false;
+            for (unsigned j=0; j<nominated.size() && !found; j++) {
+                found = nominated[j].first == u;
+            }
+            if (!found) {
+                nominated.push_back( make_pair( u, common( from, u )));
+                nominate( u, from, nominated, seen );
+            }
+        }
+    }
+
+    Symbol unqualifiedLookup(unsigned ns, unsigned name, vector<unsigned>& seen) const
+    {
+        vector< pair<unsigned, unsigned> > nominated;
+        for (unsigned s = ns; ; s = parent( s )) {
+            nominate( s, s, nominated, seen );
+            if (s == GLOBAL) {
+                break;
+            }
+        }
+
+        for (unsigned s = ns; ; s = parent( s )) {
+            Symbol sym = member( s, name, &seen );
+            for (unsigned i=0; i<nominated.size() && sym.kind == 0; i++) {
+                if (nominated[i].second == s) {
+                    sym = member( nominated[i].first, name, &seen );
+                }
+            }
+            if (sym.kind != 0 || s == GLOBAL) {
+                return sym;
+            }
+        }
+    }
+
+    // `ns` first, then what its using-directives nominate, breadth first
+    Symbol qualifiedLookup(unsigned ns, unsigned name, vector<unsigned>& seen) const
+    {
+        vector<unsigned> level( 1, ns );
+        for (unsigned next = 0; next < level.size(); next++) {
+            Symbol sym = member( level[next], name, &seen );
+            if (sym.kind != 0) {
+                return sym;
+            }
+            const vector<unsigned>& usings = _namespaces[ level[next] ]->usings;
+            for (unsigned i=0; i<usings.size(); i++) {
+                if (find( level.begin(), level.end(), usings[i] ) == level.end()) {
+                    level.push_back( usings[i] );
+                }
+            }
+        }
+        return Symbol();
+    }
+
+    vector< unique_ptr<Namespace> >         _namespaces;
+    OpenHashMap<const string*, unsigned>    _ids;
+    vector<PostTokenSpelling>               _spellings;
+    vector<unsigned long>                   _nameGenerations;
+    OpenHashMap<uint64_t, unsigned>         _pathIds;
+    vector< pair<unsigned, unsigned> >      _pathNodes;     // prefix and name
+    OpenHashMap<uint64_t, PathEntry>        _pathCache;     // by scope and path
+    unsigned long                           _hits;
+    unsigned long                           _misses;
+    unsigned long                           _invalidations;
+};
+
+
+// SymbolScan: the names a translation unit declares at namespace scope,
+// found in one pass over its tokens before the parse, and what each
+// identifier token names where it stands.  Namespace definitions and
+// aliases, using-directives and -declarations, typedefs, variables,
+// functions, enumerators and the heads of classes, enums and templates
+// declare names; the bodies of classes and functions are only looked
+// into for the names they use.
+class SymbolScan
+{
+  public:
+    explicit SymbolScan(const vector<PostToken>& tokens)
+        : _tokens(tokens), _pos(0), _kinds(tokens.size())
+    {
+        while (!atEnd()) {
+            declarations( SymbolTable::GLOBAL );
+            if (at( PT_OP_RBRACE )) {
+                _pos++;
+            }
+        }
+    }
+
+    // the ESymbolKind bits of what token `i` names, 0 if it is no
+    // identifier or names nothing known
+    unsigned kind(size_t i) const
+    {
+        return _kinds[i];
+    }
+
+    const SymbolTable& table() const
+    {
+        return _table;
+    }
+
+  private:
+    SymbolScan(const SymbolScan&);
+    SymbolScan& operator= (const SymbolScan&);
+
+    // an id-expression as it was scanned; `token` is the index of its
+    // last identifier, or npos if it does not end in one.  `member` if a
+    // name before the last one is no namespace, so the last one is a
+    // member of a class or of a template parameter and not looked up.
+    struct Name
+    {
+        Name()
+            : qualified(false), member(false), token(string::npos), id(0)
+        {
+        }
+
+        bool   qualified;
+        bool   member;
+        size_t token;
+        unsigned id;
+        Symbol sym;
+    };
+
+    EPostTokenType type(size_t ahead = 0) const
+    {
+        return _pos + ahead < _tokens.size() ? _tokens[_pos + ahead].type : PT_EOF;
+    }
+
+    bool at(EPostTokenType tp, size_t ahead = 0) const
+    {
+        return type( ahead ) == tp;
+    }
+
+    bool atEnd() const
+    {
+        return at( PT_EOF );
+    }
+
+    SymbolLocation where(size_t i) const
+    {
+        return SymbolLocation( _tokens[i].fname, _tokens[i].fline );
+    }
+
+    bool atWord(const char* word) const
+    {
+        return at( PT_SIMPLE ) && _tokens[_pos].source == word;
+    }
+
+    // `>` or half of a `>>`, which closes one angle bracket each
+    bool atClosingAngle() const
+    {
+        return at( PT_OP_GT ) || at( PT_ST_RSHIFT_1 ) || at( PT_ST_RSHIFT_2 );
+    }
+
+    // the template parameter `name` in scope, if there is one
+    bool param(unsigned name, Symbol& sym) const
+    {
+        for (size_t i = _params.size(); i-- > 0; ) {
+            if (_params[i].first == name) {
+                sym = Symbol( _params[i].second, 0 );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the template parameters in scope first, then the namespaces
+    Symbol lookup(unsigned ns, unsigned name)
+    {
+        Symbol sym;
+        return param( name, sym ) ? sym : _table.lookup( ns, name );
+    }
+
+    // the declarations of namespace `ns`, up to its closing brace
+    void declarations(unsigned ns)
+    {
+        while (!atEnd() && !at( PT_OP_RBRACE )) {
+            declaration( ns );
+        }
+    }
+
+    void declaration(unsigned ns)
+    {
+        if (at( PT_OP_SEMICOLON )) {
+            _pos++;
+        }
+        else if (at( PT_KW_NAMESPACE ) || (at( PT_KW_INLINE ) && at( PT_KW_NAMESPACE, 1 ))) {
+            namespaceDefinition( ns );
+        }
+        else if (at( PT_KW_USING )) {
+            usingDeclaration( ns );
+        }
+        else if (at( PT_KW_EXTERN ) && at( PT_LITERAL_ARRAY, 1 ) && at( PT_OP_LBRACE, 2 )) {
+            // linkage-specification
+            _pos += 3;
+            declarations( ns );
+            if (at( PT_OP_RBRACE )) {
+                _pos++;
+            }
+        }
+        else if (at( PT_KW_TEMPLATE ) && at( PT_OP_LT, 1 )) {
+            size_t nparams = _params.size();
+            while (at( PT_KW_TEMPLATE ) && at( PT_OP_LT, 1 )) {
+                _pos += 2;
+                templateParameters( ns );
+            }
+            simpleDeclaration( ns, true );
+            _params.resize( nparams );
+        }
+        else {
+            simpleDeclaration( ns, false );
+        }
+    }
+
+    void namespaceDefinition(unsigned ns)
+    {
+        bool isInline = at( PT_KW_INLINE );
+        _pos += isInline ? 2 : 1;
+
+        unsigned name = 0;
+        SymbolLocation loc = where( _pos - 1 );
+        if (at( PT_SIMPLE )) {
+            loc = where( _pos );
+            name = _table.intern( _tokens[_pos].source );
+            _kinds[_pos] = _table.member( ns, name ).kind;
+            _pos++;
+        }
+        if (name != 0 && at( PT_OP_ASS )) {
+            // namespace-alias-definition
+            _pos++;
+            Name target = qualifiedName( ns );
+            if (target.sym.kind == SK_NAMESPACE) {
+                _table.declare( ns, name, target.sym, loc );
+            }
+            skipPast( ns );
+            return;
+        }
+        if (!at( PT_OP_LBRACE )) {
+            skipPast( ns );
+            return;
+        }
+        _pos++;
+        declarations( _table.openNamespace( ns, name, isInline, loc ));
+        if (at( PT_OP_RBRACE )) {
+            _pos++;
+        }
+    }
+
+    // using-directive, using-declaration or alias-declaration
+    void usingDeclaration(unsigned ns)
+    {
+        _pos++;
+        if (at( PT_KW_NAMESPACE )) {
+            _pos++;
+            Name n = qualifiedName( ns );
+            if (n.sym.kind == SK_NAMESPACE) {
+                _table.usingDirective( ns, n.sym.ns );
+            }
+        }
+        else {
+            if (at( PT_KW_TYPENAME )) {
+                _pos++;
+            }
+            Name n = qualifiedName( ns );
+            if (!n.qualified && n.token != string::npos && at( PT_OP_ASS )) {
+                skipPast( ns );
+                _table.declare( ns, n.id, Symbol( SK_TYPEDEF, 0 ), where( n.token ));
+                return;
+            }
+            if (n.qualified && n.token != string::npos && n.sym.kind != 0) {
+                _table.declare( ns, n.id, n.sym, where( n.token ));
+            }
+        }
+        skipPast( ns );
+    }
+
+    // after the `<` of a template-parameter-list, up to and past its `>`
+    void templateParameters(unsigned ns)
+    {
+        while (!atEnd() && !atClosingAngle()) {
+            unsigned kind = SK_OBJECT;
+            if (at( PT_KW_TEMPLATE ) && at( PT_OP_LT, 1 )) {
+                // the parameters of a template template parameter are
+                // not in scope after it
+                size_t nparams = _params.size();
+                _pos += 2;
+                templateParameters( ns );
+                _params.resize( nparams );
+                kind = SK_TEMPLATE;
+            }
+            else if ((at( PT_KW_CLASS ) || at( PT_KW_TYPENAME )) && !at( PT_OP_COLON2, 2 )) {
+                kind = SK_TYPEDEF;
+            }
+
+            if (kind != SK_OBJECT) {
+                _pos++;
+                if (at( PT_OP_DOTS )) {
+                    _pos++;
+                }
+                if (at( PT_SIMPLE )) {
+                    unsigned id = _table.intern( _tokens[_pos].source );
+                    _kinds[_pos] = lookup( ns, id ).kind;
+                    _params.push_back( make_pair( id, kind ));
+                    _pos++;
+                }
+            }
+            // the declarator of a non-type parameter, or a default argument:
+            // the last identifier before the end of the parameter names it
+            size_t last = string::npos;
+            while (!atEnd() && !atClosingAngle() && !at( PT_OP_COMMA )) {
+                if (at( PT_OP_ASS )) {
+                    kind = 0;
+                }
+                if (at( PT_SIMPLE ) && !at( PT_OP_COLON2, 1 ) && kind == SK_OBJECT) {
+                    last = _pos;
+                }
+                skipOver( ns );
+            }
+            if (last != string::npos) {
+                _params.push_back( make_pair( _table.intern( _tokens[last].source ), (unsigned) SK_OBJECT ));
+            }
+            if (at( PT_OP_COMMA )) {
+                _pos++;
+            }
+        }
+        if (atClosingAngle()) {
+            _pos++;
+        }
+    }
+
+    // simple-declaration or function-definition: the first name in each
+    // declarator that is not taken for the type is declared, unless it is
+    // qualified.  Before the type, a member name that was not looked up,
+    // as in S::T or typename C<X>::type, is taken for the type.
+    void simpleDeclaration(unsigned ns, bool isTemplate)
+    {
+        bool isTypedef = false;
+        bool haveType = false;
+        bool declared = false;
+        bool function = false;
+
+        while (!atEnd() && !at( PT_OP_RBRACE )) {
+            EPostTokenType tp = type();
+            if (tp == PT_OP_SEMICOLON) {
+                _pos++;
+                return;
+            }
+            else if (tp == PT_KW_TYPEDEF) {
+                isTypedef = true;
+                _pos++;
+            }
+            else if (tp == PT_KW_CLASS || tp == PT_KW_STRUCT || tp == PT_KW_UNION || tp == PT_KW_ENUM) {
+                classSpecifier( ns, isTemplate );
+                haveType = true;
+            }
+            else if (tp == PT_SIMPLE || tp == PT_OP_COLON2) {
+                Name n = qualifiedName( ns );
+                if (!haveType && (n.sym.kind & (SK_CLASS | SK_ENUM | SK_TYPEDEF | SK_TEMPLATE))) {
+                    haveType = true;
+                }
+                else if (!haveType && n.member && n.token != string::npos && !constructorName( n )) {
+                    _kinds[n.token] = SK_TYPEDEF;
+                    haveType = true;
+                }
+                else if (!declared) {
+                    // X::~X or X::operator= declare nothing either
+                    declared = true;
+                    if (!n.qualified && n.token != string::npos) {
+                        unsigned kind = isTypedef ? SK_TYPEDEF : isTemplate ? SK_TEMPLATE : SK_OBJECT;
+                        _table.declare( ns, n.id, Symbol( kind, 0 ), where( n.token ));
+                    }
+                }
+            }
+            else if (tp == PT_OP_COMMA) {
+                declared = false;
+                function = false;
+                _pos++;
+            }
+            else if (tp == PT_OP_ASS || (tp == PT_OP_LBRACE && !function)) {
+                // initializer
+                while (!atEnd() && !at( PT_OP_COMMA ) && !at( PT_OP_SEMICOLON ) && !at( PT_OP_RBRACE )) {
+                    skipOver( ns );
+                }
+            }
+            else if (tp == PT_OP_LBRACE || tp == PT_OP_COLON || tp == PT_KW_TRY) {
+                // function body, with a ctor-initializer or handlers
+                while (!atEnd() && !at( PT_OP_LBRACE )) {
+                    skipOver( ns );
+                }
+                skipOver( ns );
+                while (at( PT_KW_CATCH )) {
+                    _pos++;
+                    skipOver( ns );
+                    skipOver( ns );
+                }
+                return;
+            }
+            else if (tp == PT_KW_OPERATOR) {
+                declared = true;
+                _pos++;
+            }
+            else if (tp >= PT_KW_ALIGNAS && tp <= PT_KW_WHILE && !fundamental( tp ) && at( PT_OP_LPAREN, 1 )) {
+                // decltype, alignas, static_assert, noexcept, ... and their operand
+                haveType = haveType || tp == PT_KW_DECLTYPE;
+                _pos++;
+                skipOver( ns );
+            }
+            else if (tp == PT_OP_LPAREN && !declared) {
+                // around a declarator
+                _pos++;
+            }
+            else {
+                if (tp == PT_OP_LPAREN) {
+                    function = true;
+                }
+                haveType = haveType || tp == PT_KW_AUTO || fundamental( tp );
+                skipOver( ns );
+            }
+        }
+    }
+
+    // X::X or X<...>::X, the name of a constructor
+    bool constructorName(const Name& n) const
+    {
+        size_t i = n.token - 1;                 // the `::`
+        if (i > 0 && (_tokens[i-1].type == PT_OP_GT || _tokens[i-1].type == PT_ST_RSHIFT_2)) {
+            // back over the template arguments
+            int depth = 0;
+            while (--i > 0) {
+                EPostTokenType tp = _tokens[i].type;
+                depth += (tp == PT_OP_GT || tp == PT_ST_RSHIFT_1 || tp == PT_ST_RSHIFT_2) ? 1 : (tp == PT_OP_LT) ? -1 : 0;
+                if (depth == 0) {
+                    break;
+                }
+            }
+        }
+        return i > 0 && _tokens[i-1].type == PT_SIMPLE && _tokens[i-1].source == _tokens[n.token].source;
+    }
+
+    static bool fundamental(EPostTokenType tp)
+    {
+        return tp == PT_KW_BOOL || tp == PT_KW_CHAR || tp == PT_KW_CHAR16_T || tp == PT_KW_CHAR32_T ||
+               tp == PT_KW_DOUBLE || tp == PT_KW_FLOAT || tp == PT_KW_INT || tp == PT_KW_LONG ||
+               tp == PT_KW_SHORT || tp == PT_KW_SIGNED || tp == PT_KW_UNSIGNED || tp == PT_KW_VOID ||
+               tp == PT_KW_WCHAR_T;
+    }
+
+    // class-specifier, enum-specifier or elaborated-type-specifier.  The
+    // name is declared by a definition or forward declaration, and by an
+    // elaborated-type-specifier if it is not known yet.
+    void classSpecifier(unsigned ns, bool isTemplate)
+    {
+        bool isEnum = at( PT_KW_ENUM );
+        _pos++;
+        bool scoped = isEnum && (at( PT_KW_CLASS ) || at( PT_KW_STRUCT ));
+        if (scoped) {
+            _pos++;
+        }
+        if (at( PT_OP_LSQUARE ) && at( PT_OP_LSQUARE, 1 )) {
+            skipOver( ns );
+        }
+
+        Name n;
+        if (at( PT_SIMPLE ) || at( PT_OP_COLON2 )) {
+            n = qualifiedName( ns );
+        }
+        // X<...> is a specialization of a known template
+        bool head = at( PT_OP_LBRACE ) || at( PT_OP_COLON ) || at( PT_OP_SEMICOLON ) || atWord( "final" );
+        bool args = n.token != string::npos && n.token + 1 < _pos;
+        if (!n.qualified && n.token != string::npos && !args && (head || n.sym.kind == 0)) {
+            unsigned kind = isEnum ? SK_ENUM : isTemplate ? SK_TEMPLATE : SK_CLASS;
+            _table.declare( ns, n.id, Symbol( kind, 0 ), where( n.token ));
+            // here the name of a class template names the class too
+            _kinds[n.token] = kind | (kind == SK_TEMPLATE ? SK_CLASS : 0);
+        }
+
+        if (atWord( "final" )) {
+            _pos++;
+        }
+        if (at( PT_OP_COLON )) {
+            // base-clause or enum-base
+            while (!atEnd() && !at( PT_OP_LBRACE ) && !at( PT_OP_SEMICOLON )) {
+                skipOver( ns );
+            }
+        }
+        if (at( PT_OP_LBRACE )) {
+            if (isEnum && !scoped) {
+                enumerators( ns );
+            }
+            else {
+                skipOver( ns );
+            }
+        }
+    }
+
+    // the enumerators of an unscoped enum are declared in `ns`
+    void enumerators(unsigned ns)
+    {
+        _pos++;
+        while (!atEnd() && !at( PT_OP_RBRACE )) {
+            if (at( PT_SIMPLE )) {
+                unsigned id = _table.intern( _tokens[_pos].source );
+                _kinds[_pos] = lookup( ns, id ).kind;
+                _table.declare( ns, id, Symbol( SK_OBJECT, 0 ), where( _pos ));
+                _pos++;
+            }
+            while (!atEnd() && !at( PT_OP_COMMA ) && !at( PT_OP_RBRACE )) {
+                skipOver( ns );
+            }
+            if (at( PT_OP_COMMA )) {
+                _pos++;
+            }
+        }
+        if (at( PT_OP_RBRACE )) {
+            _pos++;
+        }
+    }
+
+    // [::] [nested-name-specifier] [template] identifier [template-arguments],
+    // every identifier of it classified.  The names up to one that is no
+    // namespace are resolved as a path, what those after it are is not
+    // known.
+    Name qualifiedName(unsigned ns)
+    {
+        Name n;
+        unsigned path = SymbolTable::NO_PATH;
+        bool known = true;
+        if (at( PT_OP_COLON2 )) {
+            n.qualified = true;
+            path = SymbolTable::ROOT_PATH;
+            _pos++;
+        }
+        for (;;) {
+            if (at( PT_KW_TEMPLATE )) {
+                _pos++;
+            }
+            if (!at( PT_SIMPLE )) {
+                n.token = string::npos;
+                n.sym = Symbol();
+                return n;
+            }
+            n.token = _pos++;
+            n.id = _table.intern( _tokens[n.token].source );
+            n.sym = Symbol();
+            if (!n.qualified && param( n.id, n.sym )) {
+                known = false;
+            }
+            else if (known) {
+                path = _table.path( path, n.id );
+                n.sym = _table.resolve( ns, path );
+            }
+            _kinds[n.token] = n.sym.kind;
+            if ((n.sym.kind & SK_TEMPLATE) && at( PT_OP_LT )) {
+                templateArguments( ns );
+            }
+            if (!at( PT_OP_COLON2 )) {
+                return n;
+            }
+            _pos++;
+            n.qualified = true;
+            known = known && n.sym.kind == SK_NAMESPACE;
+            n.member = !known;
+        }
+    }
+
+    void templateArguments(unsigned ns)
+    {
+        _pos++;
+        while (!atEnd() && !atClosingAngle()) {
+            skipOver( ns );
+        }
+        if (atClosingAngle()) {
+            _pos++;
+        }
+    }
+
+    // one token, name, or bracketed group
+    void skipOver(unsigned ns)
+    {
+        EPostTokenType tp = type();
+        if (tp == PT_SIMPLE || tp == PT_OP_COLON2) {
+            qualifiedName( ns );
+            return;
+        }
+        EPostTokenType closer = (tp == PT_OP_LPAREN) ? PT_OP_RPAREN : (tp == PT_OP_LSQUARE) ? PT_OP_RSQUARE :
+                                (tp == PT_OP_LBRACE) ? PT_OP_RBRACE : PT_INVALID;
+        _pos++;
+        if (closer != PT_INVALID) {
+            while (!atEnd() && !at( closer )) {
+                skipOver( ns );
+            }
+            if (at( closer )) {
+                _pos++;
+            }
+        }
+    }
+
+    // past the next `;` outside of brackets
+    void skipPast(unsigned ns)
+    {
+        while (!atEnd() && !at( PT_OP_SEMICOLON ) && !at( PT_OP_RBRACE )) {
+            skipOver( ns );
+        }
+        if (at( PT_OP_SEMICOLON )) {
+            _pos++;
+        }
+    }
+
+    const vector<PostToken>&          _tokens;
+    size_t                            _pos;
+    SymbolTable                       _table;
+    vector<uint8_t>                   _kinds;
+    vector< pair<unsigned, unsigned> > _params;   // template parameters in scope, id and kind
+};
@@ -0,0 +1,172 @@
+// Table driven parsing engine, included into Recognizer together with the
+// tables that `gram_gen -table` generates (pa6_table.cpp).
+//
+// It walks the grammar rows the way the recursive functions of pa6_code.cpp
+// run, building the same AST, but an alternative is only tried when the
+// current token is in its FIRST set or it can match empty.  Where one
+// alternative is left there is no backtracking at all; where several are
+// (the conflicts gram_gen counts) they are tried in grammar order as before.
+
+    enum TableTermKind {
+        TABLE_TOKEN,
+        TABLE_RULE,
+        TABLE_GROUP
+    };
+
+    enum TableRepeat {
+        TABLE_ONCE,
+        TABLE_PLUS,
+        TABLE_QUES,
+        TABLE_STAR
+    };
+
+    struct TableTerm {
+        unsigned char kind;
+        unsigned char repeat;
+        short         id;       // EPostTokenType, RuleId, or first group term
+        short         count;    // terms in a group
+    };
+
+    struct TableAlt {
+        short first;            // first term
+        short count;
+        short firstSet;
+        bool  empty;            // may match without consuming a token
+    };
+
+    struct TableRule {
+        const char* name;
+        short       first;      // first alternative
+        short       count;
+        short       firstSet;
+        bool        empty;
+    };
+
+    static const vector<TokenSet>& tableSets()
+    {
+        static const vector<TokenSet> sets = tokenSets( tableSetLists(), TABLE_SETS );
+        return sets;
+    }
+
+    CppAstRef tableRule( int rule )
+    {
+        if (!matchSet( tableSets()[ tableRules()[rule].firstSet ] )) {
+            return EMPTY_AST;
+        }
+        return memoize( rule, [this, rule]() { return tableRuleBody( rule ); } );
+    }
+
+    CppAstRef tableRuleBody( int rule )
+    {
+        const TableRule& r = tableRules()[rule];
+        Autocat ac( _trace, r.name );
+
+        PtIt bakPos = _ptIt;
+        const TokenSet& cls = tokenClass();
+        for (int i=r.first; i<r.first+r.count; i++) {
+            const TableAlt& alt = tableAlts()[i];
+            if (!alt.empty && (cls & tableSets()[alt.firstSet]).none()) {
+                continue;
+            }
+            CppAstRef ast;
+            if (tableAlt( alt, rule, i - r.first, ast )) {
+                return ast;
+            }
+            _ptIt = bakPos;
+            traceBackTo();
+        }
+        return EMPTY_AST;
+    }
+
+    bool tableAlt( const TableAlt& alt, int rule, int index, CppAstRef& out )
+    {
+        if (alt.count == 0) {
+            return false;
+        }
+        CppAstBuilder ret( _ast );
+        for (int k=alt.first; k<alt.first+alt.count; k++) {
+            const TableTerm& term = tableTerms()[k];
+            CppAstRef t;
+            if (!(term.kind == TABLE_GROUP ? tableGroup( term, t ) : tableLeaf( term, t ))) {
+                return false;
+            }
+            ret.add( t );
+        }
+        out = ret.finish( rule, index );
+        return true;
+    }
+
+    CppAstRef tableCall( const TableTerm& term )
+    {
+        if (term.kind == TABLE_TOKEN) {
+            return match( (EPostTokenType) term.id );
+        }
+        return tableRule( term.id );
+    }
+
+    // false where the generated code would break out of the enclosing
+    // alternative or group
+    bool tableLeaf( const TableTerm& term, CppAstRef& out )
+    {
+        bool mayBeEmpty = (term.kind == TABLE_RULE && tableRules()[term.id].empty);
+
+        if (term.repeat == TABLE_ONCE) {
+            out = tableCall( term );
+            return mayBeEmpty || _ast.size( out ) != 0;
+        }
+        if (term.repeat == TABLE_QUES) {
+            out = tableCall( term );
+            return true;
+        }
+
+        CppAstBuilder lst( _ast );
+        if (term.repeat == TABLE_PLUS) {
+            CppAstRef firstPtr = tableCall( term );
+            if (!mayBeEmpty && _ast.size( firstPtr ) == 0) {
+                return false;
+            }
+            lst.add( firstPtr );
+        }
+        while (true) {
+            CppAstRef iterPtr = tableCall( term );
+            if (_ast.size( iterPtr ) == 0) {
+                break;
+            }
+            lst.add( iterPtr );
+        }
+        out = lst.finish();
+        return true;
+    }
+
+    // a parenthesized group: a failed '?' group keeps what it consumed, a
+    // '*' or '+' group repeats until one of its terms fails
+    bool tableGroup( const TableTerm& term, CppAstRef& out )
+    {
+        const TableTerm* subs = tableGroupTerms() + term.id;
+        CppAstRef got[8];
+        CppAstBuilder grp( _ast );
+
+        while (true) {
+            int i = 0;
+            while (i < term.count && tableLeaf( subs[i], got[i] )) {
+                i++;
+            }
+            if (i < term.count) {
+                break;
+            }
+            for (i=0; i<term.count; i++) {
+                grp.add( got[i] );
+            }
+            if (term.repeat == TABLE_QUES) {
+                break;
+            }
+        }
+        if (term.repeat != TABLE_QUES) {
+            traceBackTo();
+        }
+        if (term.repeat == TABLE_PLUS && grp.size() == 0) {
+            return false;
+        }
+        out = grp.finish();
+        return true;
+    }
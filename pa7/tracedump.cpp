@@ -0,0 +1,82 @@
+// tracedump: prints the trace files written by `recog -trace` and
+// `nsdecl -trace` in the form the Recognizer used to print as it went
+//
+//   tracedump <tracefile>
+
+#include "recogtrace.cpp"
+#include <fstream>
+
+using namespace std;
+
+
+void DumpTrace(const RecogTrace& trace)
+{
+    const vector<RecogTrace::Record>& records = trace.records();
+    const vector<RecogTrace::Token>& tokens = trace.tokens();
+
+    cout << "trace " << trace.srcfile() << ": " << trace.count() << " events";
+    if (trace.count() > records.size()) {
+        cout << ", the first " << trace.count() - records.size() << " overwritten";
+    }
+    cout << endl;
+
+    // when the start was overwritten the nesting is not known, begin deep
+    // enough that it never goes below the first level
+    int depth = 0;
+    int lowest = 0;
+    for (unsigned i=0; i<records.size(); i++) {
+        if (records[i].kind == RecogTrace::ENTER) {
+            depth++;
+        }
+        else if (records[i].kind == RecogTrace::LEAVE) {
+            depth--;
+            lowest = min(lowest, depth);
+        }
+    }
+    depth = -lowest;
+
+    for (unsigned i=0; i<records.size(); i++) {
+        const RecogTrace::Record& r = records[i];
+        string source = (r.pos < tokens.size()) ? tokens[r.pos].source : "";
+
+        if (r.kind == RecogTrace::ENTER) {
+            depth++;
+            cout << string(depth*2, ' ') << "entering... " << trace.names().at(r.arg) << endl;
+        }
+        else if (r.kind == RecogTrace::LEAVE) {
+            cout << string(depth*2, ' ') << "leaving... " << trace.names().at(r.arg) << endl;
+            depth--;
+        }
+        else if (r.kind == RecogTrace::MATCH) {
+            cout << "MATCHED: " << PostTokenTypeToStringMap.at( (EPostTokenType) r.arg ) << " to " << source << endl;
+        }
+        else {
+            cout << "BACKTO :" << source << endl;
+        }
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        if (argc != 2)
+            throw logic_error("usage: tracedump <tracefile>");
+
+        ifstream in(argv[1], ios::binary);
+        if (!in)
+            throw runtime_error(string("cannot open ") + argv[1]);
+
+        RecogTrace trace;
+        while (trace.read(in))
+        {
+            DumpTrace(trace);
+        }
+    }
+    catch (exception& e)
+    {
+        cerr << "ERROR: " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+}
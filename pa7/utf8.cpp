@@ -48,7 +48,7 @@ public:
         _sidx = 0;
     }
 
-    UTF8Decoder (std::string* s)
+    UTF8Decoder (const std::string* s)
         : _sidx(0), _sptr(s)
     {
     } 
@@ -179,7 +179,7 @@ private:
     int                 _fileIdx;
     std::ifstream       _is;
     unsigned int        _sidx;
-    std::string*        _sptr;
+    const std::string*  _sptr;
 };
 
 
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+
+// WorkerPool: a fixed set of threads for data parallel stages.  run() hands
+// the task indices [0, n) out to the workers and to the calling thread, one
+// at a time, and returns when all of them are done.  A pool of one thread
+// starts no threads and runs everything in the caller.
+class WorkerPool
+{
+  public:
+    explicit WorkerPool(unsigned nthreads)
+        : _task(0), _ntasks(0), _next(0), _pending(0), _generation(0), _stop(false)
+    {
+        for (unsigned i=1; i<nthreads; i++)
+        {
+            _threads.push_back(std::thread(&WorkerPool::worker, this));
+        }
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (unsigned i=0; i<_threads.size(); i++)
+        {
+            _threads[i].join();
+        }
+    }
+
+    unsigned size() const
+    {
+        return _threads.size() + 1;
+    }
+
+    // call task(i) for every i in [0, n), rethrow the first exception
+    void run(size_t n, const std::function<void (size_t)>& task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _task = &task;
+            _ntasks = n;
+            _next = 0;
+            _error = std::exception_ptr();
+            _pending = _threads.size();
+            _generation++;
+        }
+        _wake.notify_all();
+
+        work();
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (_pending != 0)
+            {
+                _done.wait(lock);
+            }
+            _task = 0;
+        }
+        if (_error)
+        {
+            std::rethrow_exception(_error);
+        }
+    }
+
+  private:
+    WorkerPool(const WorkerPool&);
+    WorkerPool& operator= (const WorkerPool&);
+
+    void worker()
+    {
+        unsigned long seen = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (!_stop && _generation == seen)
+                {
+                    _wake.wait(lock);
+                }
+                if (_stop)
+                {
+                    return;
+                }
+                seen = _generation;
+            }
+
+            work();
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (--_pending == 0)
+                {
+                    _done.notify_one();
+                }
+            }
+        }
+    }
+
+    void work()
+    {
+        for (;;)
+        {
+            size_t i = _next++;
+            if (i >= _ntasks)
+            {
+                return;
+            }
+            try
+            {
+                (*_task)(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_error)
+                {
+                    _error = std::current_exception();
+                }
+                // hand out nothing more
+                _next = _ntasks;
+            }
+        }
+    }
+
+    std::vector<std::thread>                 _threads;
+    const std::function<void (size_t)>*      _task;
+    size_t                                   _ntasks;
+    std::atomic<size_t>                      _next;
+    unsigned                                 _pending;
+    unsigned long                            _generation;
+    bool                                     _stop;
+    std::exception_ptr                       _error;
+    std::mutex                               _mutex;
+    std::condition_variable                  _wake;
+    std::condition_variable                  _done;
+};